@@ -1,57 +1,144 @@
 #!/usr/bin/env python3
 """
-Convert image.jpg to grayscale 8-bit C header file
+Convert image.jpg to a grayscale binary image asset
+
+Asset layout (little-endian), matching lib/image_asset.h:
+  uint32 magic 'PIMG', uint8 version, uint8 header_size, uint8 bits_per_pixel,
+  uint8 compression, uint32 width, uint32 height, uint32 data_size
+followed by data_size payload bytes: pixels packed MSB-first at bits_per_pixel,
+optionally PackBits run-length encoded.
+Tiled assets (--tile, version 2) add uint16 tile_width, uint16 tile_height to
+the header and store the pixels tile by tile.
 """
 from PIL import Image
+import numpy as np
+import argparse
+import struct
 import sys
 
-def convert_image_to_header(input_path, output_path):
-    # Load image
-    img = Image.open(input_path)
-    
-    # Convert to grayscale
-    img_gray = img.convert('L')
-    
-    # Get dimensions
+IMAGE_ASSET_MAGIC = 0x474D4950  # "PIMG"
+IMAGE_ASSET_VERSION = 1
+IMAGE_ASSET_VERSION_TILED = 2
+IMAGE_COMPRESSION_NONE = 0
+IMAGE_COMPRESSION_RLE = 1
+HEADER_FORMAT = '<IBBBBIII'
+TILING_FORMAT = '<HH'
+
+def pack_pixels(pixels, bits_per_pixel):
+    """
+    Quantize 8-bit pixels to bits_per_pixel and pack them MSB-first
+    """
+    values = np.asarray(pixels, dtype=np.uint8) >> (8 - bits_per_pixel)
+    shifts = np.arange(bits_per_pixel - 1, -1, -1, dtype=np.uint8)
+    bits = (values[:, None] >> shifts) & 1
+    return np.packbits(bits.ravel()).tobytes()
+
+def tile_order(img_array, tile_width, tile_height):
+    """
+    Reorder a 2D pixel array tile by tile (tiles left to right, top to bottom,
+    each tile in raster order, edge tiles clipped)
+    """
+    height, width = img_array.shape
+    tiles = []
+    for y in range(0, height, tile_height):
+        for x in range(0, width, tile_width):
+            tiles.append(img_array[y:y + tile_height, x:x + tile_width].ravel())
+    return np.concatenate(tiles)
+
+def packbits_encode(data):
+    """
+    PackBits run-length encoding (runs of 3+ bytes are encoded as repeats)
+    """
+    out = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        # Measure run starting at i
+        run = 1
+        while i + run < n and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            out.append((257 - run) & 0xFF)  # -(run-1) as int8
+            out.append(data[i])
+            i += run
+            continue
+        # Literal block until next run of 3+
+        start = i
+        while i < n and i - start < 128:
+            if i + 2 < n and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out.extend(data[start:i])
+    return bytes(out)
+
+def convert_image_to_asset(input_path, output_path, bits_per_pixel=8, rle=False,
+                           tile=None, size=None):
+    img_gray = Image.open(input_path).convert('L')
+    if size:
+        img_gray = img_gray.resize(size, Image.BILINEAR)
     width, height = img_gray.size
-    
-    # Get pixel data as 8-bit values (0-255)
-    pixels = list(img_gray.getdata())
-    
-    # Write C header file
-    with open(output_path, 'w') as f:
-        f.write("// Auto-generated from image.jpg\n")
-        f.write("#ifndef IMAGE_DATA_H\n")
-        f.write("#define IMAGE_DATA_H\n\n")
-        f.write("#include <stdint.h>\n\n")
-        f.write(f"#define IMAGE_WIDTH {width}\n")
-        f.write(f"#define IMAGE_HEIGHT {height}\n")
-        f.write(f"#define IMAGE_SIZE {len(pixels)}\n\n")
-        f.write("// Grayscale pixel data (8-bit per pixel)\n")
-        f.write("const uint8_t image_data[IMAGE_SIZE] = {\n")
-        
-        # Write pixels in rows of 16 for readability
-        for i in range(0, len(pixels), 16):
-            row = pixels[i:i+16]
-            f.write("    ")
-            f.write(", ".join(f"0x{p:02X}" for p in row))
-            if i + 16 < len(pixels):
-                f.write(",")
-            f.write("\n")
-        
-        f.write("};\n\n")
-        f.write("#endif // IMAGE_DATA_H\n")
-    
+    img_array = np.asarray(img_gray, dtype=np.uint8)
+    pixels = tile_order(img_array, *tile) if tile else img_array.ravel()
+
+    payload = pack_pixels(pixels, bits_per_pixel)
+    compression = IMAGE_COMPRESSION_NONE
+    if rle:
+        encoded = packbits_encode(payload)
+        if len(encoded) < len(payload):
+            payload = encoded
+            compression = IMAGE_COMPRESSION_RLE
+        else:
+            print("RLE does not shrink this image, storing uncompressed")
+
+    version = IMAGE_ASSET_VERSION_TILED if tile else IMAGE_ASSET_VERSION
+    header_size = struct.calcsize(HEADER_FORMAT)
+    if tile:
+        header_size += struct.calcsize(TILING_FORMAT)
+    header = struct.pack(HEADER_FORMAT, IMAGE_ASSET_MAGIC, version,
+                         header_size, bits_per_pixel, compression,
+                         width, height, len(payload))
+    if tile:
+        header += struct.pack(TILING_FORMAT, *tile)
+    with open(output_path, 'wb') as f:
+        f.write(header)
+        f.write(payload)
+
     print(f"Converted {input_path} to {output_path}")
     print(f"Image dimensions: {width}x{height} = {len(pixels)} pixels")
-    print(f"Grayscale 8-bit values (0-255)")
+    print(f"Grayscale {bits_per_pixel}-bit, "
+          f"{'RLE' if compression == IMAGE_COMPRESSION_RLE else 'uncompressed'}, "
+          f"{header_size + len(payload)} bytes")
+    if tile:
+        print(f"Tiled {tile[0]}x{tile[1]}")
+
+def parse_size(text):
+    """
+    Parse a WxH size argument
+    """
+    try:
+        w, h = (int(v) for v in text.lower().split('x'))
+    except ValueError:
+        raise argparse.ArgumentTypeError(f"expected WxH, got '{text}'")
+    if w < 1 or h < 1 or w > 65535 or h > 65535:
+        raise argparse.ArgumentTypeError(f"size out of range: '{text}'")
+    return w, h
 
 if __name__ == "__main__":
-    input_file = "image.jpg"
-    output_file = "lib/image_data.h"
-    
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('input', nargs='?', default='image.jpg')
+    parser.add_argument('-o', '--output', default='image.pimg', help='Output path (default: image.pimg)')
+    parser.add_argument('--bpp', type=int, default=8, choices=range(1, 9),
+                        help='Bits per pixel stored in the asset (default: 8)')
+    parser.add_argument('--rle', action='store_true', help='PackBits-compress the asset payload')
+    parser.add_argument('--tile', type=parse_size, metavar='WxH',
+                        help='Store the asset tile by tile (e.g. 64x64, at most 4096 pixels per tile)')
+    parser.add_argument('--resize', type=parse_size, metavar='WxH',
+                        help='Resize the image first (e.g. 6000x4000 for a large test asset)')
+    args = parser.parse_args()
+
     try:
-        convert_image_to_header(input_file, output_file)
+        convert_image_to_asset(args.input, args.output, args.bpp, args.rle, args.tile, args.resize)
     except Exception as e:
         print(f"Error: {e}")
         sys.exit(1)
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""
+Export DTFT complex spectra from Pico serial output to a binary .dtfs file
+Reads the "DTFT COMPLEX VALUES FOR MATLAB" blocks (DEBUG builds) and writes
+the format read by host/idtft_decode (see host/spectrum_file.h)
+"""
+import re
+import struct
+import sys
+
+SPECTRUM_FILE_MAGIC = 0x53465444  # "DTFS"
+SPECTRUM_FILE_VERSION = 1
+
+def parse_complex_blocks(input_file):
+    """
+    Return a list of (real, imag) lists, one per MATLAB block
+    """
+    with open(input_file, 'r', encoding='utf-8', errors='ignore') as f:
+        content = f.read()
+
+    blocks = re.findall(r'dtft_real = \[(.*?)\];\s*dtft_imag = \[(.*?)\];', content, re.DOTALL)
+    spectra = []
+    for real_text, imag_text in blocks:
+        real = [float(v) for v in re.findall(r'-?\d+\.?\d*(?:[eE][-+]?\d+)?', real_text)]
+        imag = [float(v) for v in re.findall(r'-?\d+\.?\d*(?:[eE][-+]?\d+)?', imag_text)]
+        if len(real) != len(imag):
+            print(f"Warning: skipping block with {len(real)} real / {len(imag)} imag values")
+            continue
+        spectra.append((real, imag))
+    return spectra
+
+def write_spectrum_file(spectra, output_file, signal_len, pattern_len):
+    num_points = len(spectra[0][0])
+    spectra = [s for s in spectra if len(s[0]) == num_points]
+    with open(output_file, 'wb') as f:
+        f.write(struct.pack('<6I', SPECTRUM_FILE_MAGIC, SPECTRUM_FILE_VERSION,
+                            num_points, signal_len, pattern_len, len(spectra)))
+        for real, imag in spectra:
+            interleaved = [v for pair in zip(real, imag) for v in pair]
+            f.write(struct.pack(f'<{len(interleaved)}f', *interleaved))
+    return len(spectra), num_points
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("Usage: python3 export_spectra.py <pico_output.txt> <spectra.dtfs> [signal_len] [pattern_len]")
+        sys.exit(1)
+
+    signal_len = int(sys.argv[3]) if len(sys.argv) > 3 else 80
+    pattern_len = int(sys.argv[4]) if len(sys.argv) > 4 else 8
+
+    spectra = parse_complex_blocks(sys.argv[1])
+    if not spectra:
+        print("Error: no dtft_real/dtft_imag blocks found (build the firmware with DEBUG=1)")
+        sys.exit(1)
+
+    count, num_points = write_spectrum_file(spectra, sys.argv[2], signal_len, pattern_len)
+    print(f"Wrote {count} spectra ({num_points} points each) to {sys.argv[2]}")
+    print(f"Decode with: build-host/idtft_decode {sys.argv[2]}")
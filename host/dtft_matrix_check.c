@@ -0,0 +1,152 @@
+// Checks the DFT-matrix engine (lib/dtft_matrix.c) against calculate_dtft_zoh()
+// for every 8-bit pattern and sample divisor, in each entry format, and
+// compares its GEMV and blocked GEMM time per pixel with the per-sample LUT
+// kernel (compute_dtft_magnitude()) and the compile-time specialized kernel.
+
+#include "dtft.h"
+#include "dtft_matrix.h"
+#include "lut.h"
+#include "signal.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#define NUM_BINS 41
+#define REPS 10
+#define TIMING_ROUNDS 200
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Held signal and sampled bits as the receiver records them
+static void hold_pattern(int value, int divisor, uint8_t *held, uint8_t *samples) {
+    int num_samples = 0;
+    uint8_t bit = 0;
+    for (int n = 0; n < 8; n++) {
+        if (n % divisor == 0) {
+            bit = (value >> (7 - n)) & 1;
+            samples[num_samples++] = bit;
+        }
+        held[n] = bit;
+    }
+}
+
+static uint8_t decode(const float *spectrum) {
+    float magnitudes[NUM_BINS];
+    for (int k = 0; k < NUM_BINS; k++) {
+        magnitudes[k] = spectrum[2*k] * spectrum[2*k] + spectrum[2*k + 1] * spectrum[2*k + 1];
+    }
+    return reconstruct_pixel_value_seeded(magnitudes, spectrum, 0);
+}
+
+int main(void) {
+    static const int divisors[] = {1, 2, 3, 4, 8};
+    static const dtft_matrix_format_t formats[] = {DTFT_MATRIX_F32, DTFT_MATRIX_F16, DTFT_MATRIX_Q15};
+    // Largest error allowed, relative to the largest bin magnitude
+    static const double tolerance[] = {1e-5, 2e-3, 1e-3};
+    int failures = 0;
+
+    init_trig_lut();
+    init_matcher_tables();
+
+    static uint8_t held[256][8];
+    static uint8_t sampled[256][8];
+    static float reference[256][NUM_BINS * 2];
+    static float spectra[256][NUM_BINS * 2];
+
+    printf("divisor  format  bytes  max err/peak  decode agree  gemv ns  gemm ns\n");
+    for (unsigned d = 0; d < sizeof(divisors) / sizeof(divisors[0]); d++) {
+        const int divisor = divisors[d];
+        for (int value = 0; value < 256; value++) {
+            hold_pattern(value, divisor, held[value], sampled[value]);
+            calculate_dtft_zoh(sampled[value], 8, divisor, REPS, NUM_BINS, reference[value]);
+        }
+        double peak = 0.0;
+        for (int value = 0; value < 256; value++) {
+            for (int k = 0; k < NUM_BINS; k++) {
+                double mag = hypot(reference[value][2*k], reference[value][2*k + 1]);
+                if (mag > peak) peak = mag;
+            }
+        }
+
+        // Baselines: per-sample LUT magnitudes over the held signal, specialized kernel
+        volatile float sink = 0.0f;
+        double t0 = now_s();
+        for (int round = 0; round < TIMING_ROUNDS; round++) {
+            for (int value = 0; value < 256; value++) {
+                static uint8_t signal[8 * REPS];
+                for (int n = 0; n < 8 * REPS; n++) {
+                    signal[n] = held[value][n % 8];
+                }
+                for (int k = 0; k < NUM_BINS; k++) {
+                    sink += compute_dtft_magnitude(signal, 8 * REPS, (float)M_PI * k / (NUM_BINS - 1));
+                }
+            }
+        }
+        double t1 = now_s();
+        for (int round = 0; round < TIMING_ROUNDS; round++) {
+            for (int value = 0; value < 256; value++) {
+                calculate_dtft_zoh(sampled[value], 8, divisor, REPS, NUM_BINS, spectra[value]);
+                sink += spectra[value][2];
+            }
+        }
+        double t2 = now_s();
+        printf("%7d  %-6s  %5s  %12s  %12s  %7.1f\n", divisor, "lut", "-", "-", "-",
+               (t1 - t0) * 1e9 / (TIMING_ROUNDS * 256));
+        printf("%7d  %-6s  %5s  %12s  %12s  %7.1f\n", divisor, "fixed", "-", "-", "-",
+               (t2 - t1) * 1e9 / (TIMING_ROUNDS * 256));
+
+        for (unsigned f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+            dtft_matrix_t matrix;
+            if (!dtft_matrix_init(&matrix, 8, divisor, REPS, NUM_BINS, formats[f])) {
+                return 1;
+            }
+
+            // GEMV and GEMM must give the same spectra
+            double max_err = 0.0;
+            int agree = 0;
+            bool gemm_same = true;
+            dtft_matrix_gemm(&matrix, &sampled[0][0], 8, 256, &spectra[0][0]);
+            for (int value = 0; value < 256; value++) {
+                float single[NUM_BINS * 2];
+                dtft_matrix_gemv(&matrix, sampled[value], single);
+                for (int i = 0; i < NUM_BINS * 2; i++) {
+                    double err = fabs(single[i] - reference[value][i]);
+                    if (err > max_err) max_err = err;
+                    if (fabsf(single[i] - spectra[value][i]) > 1e-4f * (float)peak) gemm_same = false;
+                }
+                agree += decode(single) == decode(reference[value]);
+            }
+
+            t0 = now_s();
+            for (int round = 0; round < TIMING_ROUNDS; round++) {
+                for (int value = 0; value < 256; value++) {
+                    dtft_matrix_gemv(&matrix, sampled[value], spectra[value]);
+                    sink += spectra[value][2];
+                }
+            }
+            t1 = now_s();
+            for (int round = 0; round < TIMING_ROUNDS; round++) {
+                dtft_matrix_gemm(&matrix, &sampled[0][0], 8, 256, &spectra[0][0]);
+                sink += spectra[0][2];
+            }
+            t2 = now_s();
+
+            printf("%7d  %-6s  %5zu  %12.2e  %8d/256  %7.1f  %7.1f%s\n", divisor,
+                   dtft_matrix_format_name(formats[f]), dtft_matrix_bytes(&matrix), max_err / peak,
+                   agree, (t1 - t0) * 1e9 / (TIMING_ROUNDS * 256), (t2 - t1) * 1e9 / (TIMING_ROUNDS * 256),
+                   gemm_same ? "" : "  GEMM DIFFERS");
+            if (max_err / peak > tolerance[f] || !gemm_same || (formats[f] == DTFT_MATRIX_F32 && agree != 256)) {
+                failures++;
+            }
+            dtft_matrix_free(&matrix);
+        }
+        (void)sink;
+    }
+
+    printf("%s\n", failures ? "MISMATCH" : "OK: matrix engine matches calculate_dtft_zoh()");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,157 @@
+/**
+ * dtft_table_check - compare the constexpr-generated DTFT table with the
+ * checked-in literal lib/dtft_lookup_n10.h
+ *
+ * Reports exact matches, the largest relative error on significant bins and
+ * the residue the literal carries in bins that are analytically zero, and
+ * checks that both tables group values into the same magnitude classes
+ * (the decisions the matcher depends on). The complement-pair layout
+ * (DtftComplementTable) is checked against the full generated table, and the
+ * reduced bit depth tables (DtftHarmonicTable) against a direct DTFT.
+ */
+#include "dtft_table.hpp"
+#include "dtft_lookup_n10.h"
+#include <cmath>
+#include <cstdio>
+
+static constexpr DtftLookupTable<DTFT_BIT_DEPTH, DTFT_N, DTFT_NUM_FREQUENCIES> generated{};
+static constexpr DtftComplementTable<DTFT_BIT_DEPTH, DTFT_N, DTFT_NUM_FREQUENCIES> pairs{};
+
+/**
+ * Largest complex error of the complement-pair layout against the full table,
+ * relative to the largest amplitude; counts bit-identical squared magnitudes
+ */
+static double check_complement_pairs(int *exact_magnitude) {
+    double max_error = 0.0, max_amplitude = 0.0;
+    *exact_magnitude = 0;
+    for (int v = 0; v < DTFT_NUM_VALUES; v++) {
+        const int rep = dtft_table_representative(v);
+        const double sign = v & DTFT_NUM_PAIRS ? -1.0 : 1.0;
+        for (int k = 0; k < DTFT_NUM_FREQUENCIES; k++) {
+            const DTFTPoint &full = generated.entries[v][k];
+            const DTFTPoint &row = pairs.entries[rep][k];
+            double magnitude = k == 0 ? pairs.dc_magnitude[v] : row.magnitude;
+            double a = std::sqrt(magnitude);
+            double re = k == 0 ? a : sign * a * std::cos(row.phase);
+            double im = k == 0 ? 0.0 : sign * a * std::sin(row.phase);
+            double full_a = std::sqrt((double)full.magnitude);
+            double err = std::hypot(re - full_a * std::cos(full.phase), im - full_a * std::sin(full.phase));
+            *exact_magnitude += (float)magnitude == full.magnitude;
+            if (err > max_error) max_error = err;
+            if (full_a > max_amplitude) max_amplitude = full_a;
+        }
+    }
+    return max_error / max_amplitude;
+}
+
+/**
+ * Reduced depth table against a direct double DTFT of every value repeated
+ * DTFT_N times on all bins of its grid; bins between the harmonics must be
+ * zero for the stored harmonics to hold the whole spectrum
+ * @param residue Output: largest amplitude outside the harmonics, relative
+ * @return Largest complex error on the harmonics, relative to the largest amplitude
+ */
+template <int Width>
+static double check_harmonics(double *residue) {
+    static constexpr DtftHarmonicTable<Width, DTFT_N> table{};
+    constexpr int bins = DtftHarmonicTable<Width, DTFT_N>::kBins;
+    double max_error = 0.0, max_residue = 0.0, max_amplitude = 0.0;
+    for (int v = 0; v < (1 << Width); v++) {
+        for (int k = 0; k < bins; k++) {
+            double re = 0.0, im = 0.0;
+            for (int n = 0; n < Width * DTFT_N; n++) {
+                if ((v >> (Width - 1 - n % Width)) & 1) {
+                    re += std::cos(M_PI * k * n / (bins - 1));
+                    im -= std::sin(M_PI * k * n / (bins - 1));
+                }
+            }
+            max_amplitude = std::fmax(max_amplitude, std::hypot(re, im));
+            if (k % DTFT_N == 0) {
+                const float *entry = table.entries[v][k / DTFT_N];
+                max_error = std::fmax(max_error, std::hypot(re - entry[0], im - entry[1]));
+            } else {
+                max_residue = std::fmax(max_residue, std::hypot(re, im));
+            }
+        }
+    }
+    *residue = max_residue / max_amplitude;
+    return max_error / max_amplitude;
+}
+
+template <int Width>
+static bool report_harmonics() {
+    double residue;
+    double error = check_harmonics<Width>(&residue);
+    printf("%5d %6d %9d %9zu %14.3g %12.3g\n", Width, DtftHarmonicTable<Width, DTFT_N>::kBins,
+           DtftHarmonicTable<Width, DTFT_N>::kHarmonics, sizeof(DtftHarmonicTable<Width, DTFT_N>),
+           error, residue);
+    return error < 1e-6 && residue < 1e-9;
+}
+
+static float magnitude_distance(const DTFTPoint (*table)[DTFT_NUM_FREQUENCIES], int a, int b) {
+    float sum = 0.0f;
+    for (int k = 0; k < DTFT_NUM_FREQUENCIES; k++) {
+        float diff = table[a][k].magnitude - table[b][k].magnitude;
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+int main() {
+    int exact_magnitude = 0, exact_phase = 0, exact_frequency = 0, significant = 0;
+    double max_rel = 0.0, max_residue = 0.0, max_phase_err = 0.0;
+    const int total = DTFT_NUM_VALUES * DTFT_NUM_FREQUENCIES;
+
+    for (int v = 0; v < DTFT_NUM_VALUES; v++) {
+        for (int k = 0; k < DTFT_NUM_FREQUENCIES; k++) {
+            const DTFTPoint &lit = dtft_lookup_n10_data[v][k];
+            const DTFTPoint &gen = generated.entries[v][k];
+            exact_magnitude += lit.magnitude == gen.magnitude;
+            exact_phase += lit.phase == gen.phase;
+            exact_frequency += lit.frequency == gen.frequency;
+
+            if (gen.magnitude > 1e-3f) {
+                significant++;
+                double rel = std::fabs(lit.magnitude - gen.magnitude) / gen.magnitude;
+                double dphase = std::remainder((double)lit.phase - gen.phase, 2.0 * M_PI);
+                if (rel > max_rel) max_rel = rel;
+                if (std::fabs(dphase) > max_phase_err) max_phase_err = std::fabs(dphase);
+            } else if (lit.magnitude > max_residue) {
+                max_residue = lit.magnitude;
+            }
+        }
+    }
+
+    int class_mismatch = 0;
+    for (int a = 0; a < DTFT_NUM_VALUES; a++) {
+        for (int b = 0; b < a; b++) {
+            bool tie_lit = magnitude_distance(dtft_lookup_n10_data, a, b) < 1.0f;
+            bool tie_gen = magnitude_distance(generated.entries, a, b) < 1.0f;
+            class_mismatch += tie_lit != tie_gen;
+        }
+    }
+
+    printf("Entries: %d (%d significant bins)\n", total, significant);
+    printf("Bit-identical: magnitude %d, phase %d, frequency %d\n",
+           exact_magnitude, exact_phase, exact_frequency);
+    printf("Significant bins: max relative magnitude error %.3g, max phase error %.3g rad\n",
+           max_rel, max_phase_err);
+    printf("Analytically zero bins: literal residue up to %.3g (generated: 0)\n", max_residue);
+    printf("Magnitude-class disagreements: %d\n", class_mismatch);
+
+    int pair_exact = 0;
+    double pair_error = check_complement_pairs(&pair_exact);
+    printf("\nComplement pairs: %zu bytes vs %zu (%.1f%%), rows scanned %d vs %d\n",
+           sizeof(pairs), sizeof(generated.entries), 100.0 * sizeof(pairs) / sizeof(generated.entries),
+           DTFT_NUM_PAIRS, DTFT_NUM_VALUES);
+    printf("Complement pairs vs full table: bit-identical magnitudes %d/%d, max complex error %.3g "
+           "(relative to the largest amplitude)\n", pair_exact, total, pair_error);
+
+    printf("\nReduced depth tables vs direct DTFT (errors relative to the largest amplitude)\n");
+    printf("%5s %6s %9s %9s %14s %12s\n", "Bits", "Bins", "Harmonics", "Bytes", "Harmonic err",
+           "Other bins");
+    bool depth_ok = report_harmonics<1>() & report_harmonics<2>() & report_harmonics<3>() &
+                    report_harmonics<4>() & report_harmonics<5>() & report_harmonics<6>() &
+                    report_harmonics<7>();
+    return class_mismatch == 0 && max_rel < 1e-5 && pair_error < 1e-6 && depth_ok ? 0 : 1;
+}
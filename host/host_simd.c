@@ -0,0 +1,75 @@
+#include "host_simd.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *const level_names[HOST_SIMD_COUNT] = {"scalar", "neon", "avx2", "avx512"};
+
+static host_simd_t current_level;
+static pthread_once_t current_once = PTHREAD_ONCE_INIT;
+
+bool host_simd_supported(host_simd_t level) {
+    switch (level) {
+    case HOST_SIMD_SCALAR:
+        return true;
+#if defined(__aarch64__)
+    case HOST_SIMD_NEON:
+        return true;    // Part of the aarch64 base ISA
+#endif
+#if defined(__x86_64__)
+    // __builtin_cpu_supports also checks that the OS saves the wider registers
+    case HOST_SIMD_AVX2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case HOST_SIMD_AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+        return false;
+    }
+}
+
+host_simd_t host_simd_best(void) {
+    for (int level = HOST_SIMD_COUNT - 1; level > HOST_SIMD_SCALAR; level--) {
+        if (host_simd_supported((host_simd_t)level)) {
+            return (host_simd_t)level;
+        }
+    }
+    return HOST_SIMD_SCALAR;
+}
+
+static void init_current_level(void) {
+    current_level = host_simd_best();
+}
+
+host_simd_t host_simd_current(void) {
+    pthread_once(&current_once, init_current_level);
+    return current_level;
+}
+
+bool host_simd_set(host_simd_t level) {
+    pthread_once(&current_once, init_current_level);
+    if (level < 0 || level >= HOST_SIMD_COUNT || !host_simd_supported(level)) {
+        printf("Error: %s is not supported on this CPU or build\n", host_simd_name(level));
+        return false;
+    }
+    current_level = level;
+    return true;
+}
+
+const char* host_simd_name(host_simd_t level) {
+    return level >= 0 && level < HOST_SIMD_COUNT ? level_names[level] : "unknown";
+}
+
+bool host_simd_parse(const char *name, host_simd_t *level) {
+    if (!strcmp(name, "best")) {
+        *level = host_simd_best();
+        return true;
+    }
+    for (int i = 0; i < HOST_SIMD_COUNT; i++) {
+        if (!strcmp(name, level_names[i])) {
+            *level = (host_simd_t)i;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,53 @@
+#ifndef HOST_SIMD_H
+#define HOST_SIMD_H
+
+#include <stdbool.h>
+
+// Instruction set used by the host kernels (idtft.h), chosen at run time
+//
+// Every level computes the same sums as the scalar reference, in a different
+// order, so results agree up to float rounding: a sample within rounding of
+// the threshold or two table entries within rounding of each other may decide
+// differently. The level defaults to the best one the CPU supports.
+
+typedef enum {
+    HOST_SIMD_SCALAR,    // Plain C (auto-vectorized with HOST_NATIVE)
+    HOST_SIMD_NEON,      // aarch64 Advanced SIMD, 4 lanes
+    HOST_SIMD_AVX2,      // x86-64 AVX2 + FMA, 8 lanes
+    HOST_SIMD_AVX512,    // x86-64 AVX-512F, 16 lanes
+    HOST_SIMD_COUNT
+} host_simd_t;
+
+/**
+ * Whether this build and CPU can run a level
+ */
+bool host_simd_supported(host_simd_t level);
+
+/**
+ * Widest supported level
+ */
+host_simd_t host_simd_best(void);
+
+/**
+ * Level the kernels use (host_simd_best() until host_simd_set())
+ */
+host_simd_t host_simd_current(void);
+
+/**
+ * Select the level for later calls; not while a batch is running
+ * @return false (message printed) if the level is not supported
+ */
+bool host_simd_set(host_simd_t level);
+
+/**
+ * Short name: "scalar", "neon", "avx2" or "avx512"
+ */
+const char* host_simd_name(host_simd_t level);
+
+/**
+ * Level from its name, or "best"
+ * @return false if the name is unknown
+ */
+bool host_simd_parse(const char *name, host_simd_t *level);
+
+#endif // HOST_SIMD_H
@@ -0,0 +1,311 @@
+#include "idtft.h"
+#include "idtft_kernels.h"
+#include "host_simd.h"
+#include <float.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Upper bound on padded frequency points handled with stack buffers
+#define IDTFT_MAX_STRIDE 1024
+#define IDTFT_MAX_THREADS 256
+
+idtft_plan_t* idtft_plan_create(int num_points, int signal_len, int pattern_len) {
+    if (num_points < 2 || pattern_len < 1 || pattern_len > 16 || signal_len < pattern_len ||
+        signal_len > IDTFT_MAX_SAMPLES) {
+        return NULL;
+    }
+
+    int stride = (num_points + 7) & ~7;
+    if (stride > IDTFT_MAX_STRIDE) {
+        return NULL;
+    }
+
+    idtft_plan_t *plan = calloc(1, sizeof(idtft_plan_t));
+    if (!plan) return NULL;
+
+    plan->num_points = num_points;
+    plan->signal_len = signal_len;
+    plan->pattern_len = pattern_len;
+    plan->stride = stride;
+    plan->sample_stride = (signal_len + 15) & ~15;
+
+    // 32-byte aligned rows so the k loop maps onto whole AVX registers,
+    // 64-byte aligned transposed rows for AVX-512
+    size_t bytes = (size_t)signal_len * stride * sizeof(float);
+    size_t by_bin_bytes = (size_t)num_points * plan->sample_stride * sizeof(float);
+    if (posix_memalign((void **)&plan->cos_matrix, 32, bytes) != 0 ||
+        posix_memalign((void **)&plan->sin_matrix, 32, bytes) != 0 ||
+        posix_memalign((void **)&plan->cos_by_bin, 64, by_bin_bytes) != 0 ||
+        posix_memalign((void **)&plan->sin_by_bin, 64, by_bin_bytes) != 0) {
+        idtft_plan_destroy(plan);
+        return NULL;
+    }
+    memset(plan->cos_matrix, 0, bytes);
+    memset(plan->sin_matrix, 0, bytes);
+
+    // Re{X e^{jωn}} = re*cos(ωn) - im*sin(ωn); DC and π are their own conjugates
+    // and count once, every other bin stands for itself and its mirror image
+    for (int n = 0; n < signal_len; n++) {
+        for (int k = 0; k < num_points; k++) {
+            double omega = M_PI * k / (num_points - 1);
+            double weight = (k == 0 || k == num_points - 1 ? 1.0 : 2.0) / signal_len;
+            plan->cos_matrix[n * stride + k] = (float)(weight * cos(omega * n));
+            plan->sin_matrix[n * stride + k] = (float)(-weight * sin(omega * n));
+        }
+    }
+    for (int k = 0; k < num_points; k++) {
+        for (int n = 0; n < plan->sample_stride; n++) {
+            int sample = n < signal_len ? n : 0;
+            plan->cos_by_bin[k * plan->sample_stride + n] = plan->cos_matrix[sample * stride + k];
+            plan->sin_by_bin[k * plan->sample_stride + n] = plan->sin_matrix[sample * stride + k];
+        }
+    }
+
+    return plan;
+}
+
+void idtft_plan_destroy(idtft_plan_t *plan) {
+    if (!plan) return;
+    free(plan->cos_matrix);
+    free(plan->sin_matrix);
+    free(plan->cos_by_bin);
+    free(plan->sin_by_bin);
+    free(plan);
+}
+
+static uint16_t decode_one_scalar(const idtft_plan_t *plan, const float *spectrum) {
+    const int stride = plan->stride;
+    const int N = plan->signal_len;
+
+    // Split into zero-padded real/imag vectors for contiguous, unit-stride dot products
+    float re[IDTFT_MAX_STRIDE] __attribute__((aligned(32)));
+    float im[IDTFT_MAX_STRIDE] __attribute__((aligned(32)));
+    for (int k = 0; k < plan->num_points; k++) {
+        re[k] = spectrum[2*k];
+        im[k] = spectrum[2*k + 1];
+    }
+    for (int k = plan->num_points; k < stride; k++) {
+        re[k] = 0.0f;
+        im[k] = 0.0f;
+    }
+
+    float head[16];
+    float max_value = -INFINITY;
+    for (int n = 0; n < N; n++) {
+        const float * restrict c = &plan->cos_matrix[n * stride];
+        const float * restrict s = &plan->sin_matrix[n * stride];
+        float sum = 0.0f;
+        for (int k = 0; k < stride; k++) {
+            sum += re[k] * c[k] + im[k] * s[k];
+        }
+        if (n < plan->pattern_len) head[n] = sum;
+        if (sum > max_value) max_value = sum;
+    }
+
+    return idtft_pack_head(head, plan->pattern_len, max_value);
+}
+
+void idtft_decode_scalar(const idtft_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns) {
+    const size_t record = (size_t)plan->num_points * 2;
+    for (size_t i = 0; i < count; i++) {
+        patterns[i] = decode_one_scalar(plan, &spectra[i * record]);
+    }
+}
+
+idtft_match_plan_t* idtft_match_plan_create(int num_points, int signal_len, int pattern_len) {
+    if (num_points < 2 || pattern_len < 1 || pattern_len > IDTFT_MATCH_MAX_BITS || signal_len < pattern_len) {
+        return NULL;
+    }
+
+    idtft_match_plan_t *plan = calloc(1, sizeof(idtft_match_plan_t));
+    if (!plan) return NULL;
+
+    plan->num_points = num_points;
+    plan->signal_len = signal_len;
+    plan->pattern_len = pattern_len;
+    plan->num_values = 1 << pattern_len;
+    plan->value_stride = (plan->num_values + 15) & ~15;
+
+    // Entries in double, [value][component], to find the components that matter
+    const int num_components = num_points * 2;
+    double *entries = malloc((size_t)plan->num_values * num_components * sizeof(double));
+    plan->dims = malloc(num_components * sizeof(int));
+    if (!entries || !plan->dims ||
+        posix_memalign((void **)&plan->table, 64,
+                       (size_t)num_components * plan->value_stride * sizeof(float)) != 0) {
+        free(entries);
+        idtft_match_plan_destroy(plan);
+        return NULL;
+    }
+
+    double largest = 0.0;
+    for (int value = 0; value < plan->num_values; value++) {
+        double *entry = &entries[(size_t)value * num_components];
+        for (int k = 0; k < num_points; k++) {
+            double omega = M_PI * k / (num_points - 1);
+            double re = 0.0, im = 0.0;
+            for (int n = 0; n < signal_len; n++) {
+                if ((value >> (pattern_len - 1 - n % pattern_len)) & 1) {
+                    re += cos(omega * n);
+                    im -= sin(omega * n);
+                }
+            }
+            entry[2*k] = re;
+            entry[2*k + 1] = im;
+            largest = fmax(largest, fmax(fabs(re), fabs(im)));
+        }
+    }
+
+    // Keep the components some entry has above rounding; padding values sit
+    // far from any spectrum so they never match
+    for (int c = 0; c < num_components; c++) {
+        bool used = false;
+        for (int value = 0; value < plan->num_values && !used; value++) {
+            used = fabs(entries[(size_t)value * num_components + c]) > 1e-9 * largest;
+        }
+        if (!used) continue;
+        float *row = &plan->table[(size_t)plan->num_dims * plan->value_stride];
+        for (int value = 0; value < plan->value_stride; value++) {
+            row[value] = value < plan->num_values ? (float)entries[(size_t)value * num_components + c] : 1e18f;
+        }
+        plan->dims[plan->num_dims++] = c;
+    }
+
+    free(entries);
+    return plan;
+}
+
+void idtft_match_plan_destroy(idtft_match_plan_t *plan) {
+    if (!plan) return;
+    free(plan->dims);
+    free(plan->table);
+    free(plan);
+}
+
+void idtft_match_scalar(const idtft_match_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns) {
+    const size_t record = (size_t)plan->num_points * 2;
+    for (size_t i = 0; i < count; i++) {
+        const float *spectrum = &spectra[i * record];
+        float min_distance = FLT_MAX;
+        uint16_t best_match = 0;
+        for (int value = 0; value < plan->num_values; value++) {
+            float distance = 0.0f;
+            for (int d = 0; d < plan->num_dims; d++) {
+                float diff = spectrum[plan->dims[d]] - plan->table[(size_t)d * plan->value_stride + value];
+                distance += diff * diff;
+            }
+            if (distance < min_distance) {
+                min_distance = distance;
+                best_match = (uint16_t)value;
+            }
+        }
+        patterns[i] = best_match;
+    }
+}
+
+typedef struct {
+    idtft_decode_kernel_t decode;
+    idtft_match_kernel_t match;
+} idtft_kernels_t;
+
+static const idtft_kernels_t kernels[HOST_SIMD_COUNT] = {
+    [HOST_SIMD_SCALAR] = {idtft_decode_scalar, idtft_match_scalar},
+#if defined(__aarch64__)
+    [HOST_SIMD_NEON] = {idtft_decode_neon, idtft_match_neon},
+#endif
+#if defined(__x86_64__)
+    [HOST_SIMD_AVX2] = {idtft_decode_avx2, idtft_match_avx2},
+    [HOST_SIMD_AVX512] = {idtft_decode_avx512, idtft_match_avx512},
+#endif
+};
+
+uint16_t idtft_decode_one(const idtft_plan_t *plan, const float *spectrum) {
+    uint16_t pattern;
+    kernels[host_simd_current()].decode(plan, spectrum, 1, &pattern);
+    return pattern;
+}
+
+uint16_t idtft_match_one(const idtft_match_plan_t *plan, const float *spectrum) {
+    uint16_t pattern;
+    kernels[host_simd_current()].match(plan, spectrum, 1, &pattern);
+    return pattern;
+}
+
+typedef struct {
+    const idtft_plan_t *plan;
+    const idtft_match_plan_t *match_plan;
+    const idtft_kernels_t *kernels;
+    const float *spectra;
+    uint16_t *patterns;
+    size_t begin;
+    size_t end;
+} idtft_job_t;
+
+static void* idtft_worker(void *arg) {
+    idtft_job_t *job = arg;
+    if (job->begin >= job->end) {
+        return NULL;
+    }
+    if (job->plan) {
+        const size_t record = (size_t)job->plan->num_points * 2;
+        job->kernels->decode(job->plan, &job->spectra[job->begin * record], job->end - job->begin,
+                             &job->patterns[job->begin]);
+    } else {
+        const size_t record = (size_t)job->match_plan->num_points * 2;
+        job->kernels->match(job->match_plan, &job->spectra[job->begin * record], job->end - job->begin,
+                            &job->patterns[job->begin]);
+    }
+    return NULL;
+}
+
+// Either plan or match_plan; ranges run with the kernels of the current level
+static void run_batch(const idtft_plan_t *plan, const idtft_match_plan_t *match_plan, const float *spectra,
+                      size_t count, uint16_t *patterns, int num_threads) {
+    if (num_threads <= 0) {
+        num_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (num_threads < 1) num_threads = 1;
+    if (num_threads > IDTFT_MAX_THREADS) num_threads = IDTFT_MAX_THREADS;
+    if ((size_t)num_threads > count) num_threads = count > 0 ? (int)count : 1;
+
+    idtft_job_t jobs[IDTFT_MAX_THREADS];
+    pthread_t threads[IDTFT_MAX_THREADS];
+    size_t per_thread = (count + num_threads - 1) / num_threads;
+
+    for (int t = 0; t < num_threads; t++) {
+        jobs[t].plan = plan;
+        jobs[t].match_plan = match_plan;
+        jobs[t].kernels = &kernels[host_simd_current()];
+        jobs[t].spectra = spectra;
+        jobs[t].patterns = patterns;
+        jobs[t].begin = t * per_thread < count ? t * per_thread : count;
+        jobs[t].end = (t + 1) * per_thread < count ? (t + 1) * per_thread : count;
+    }
+
+    // Thread 0 work runs on the calling thread
+    int launched = 1;
+    for (int t = 1; t < num_threads; t++, launched++) {
+        if (pthread_create(&threads[t], NULL, idtft_worker, &jobs[t]) != 0) {
+            // Fall back to doing the remaining ranges inline
+            for (int r = t; r < num_threads; r++) idtft_worker(&jobs[r]);
+            break;
+        }
+    }
+    idtft_worker(&jobs[0]);
+    for (int t = 1; t < launched; t++) {
+        pthread_join(threads[t], NULL);
+    }
+}
+
+void idtft_decode_batch(const idtft_plan_t *plan, const float *spectra, size_t count,
+                        uint16_t *patterns, int num_threads) {
+    run_batch(plan, NULL, spectra, count, patterns, num_threads);
+}
+
+void idtft_match_batch(const idtft_match_plan_t *plan, const float *spectra, size_t count,
+                       uint16_t *patterns, int num_threads) {
+    run_batch(NULL, plan, spectra, count, patterns, num_threads);
+}
@@ -0,0 +1,115 @@
+#ifndef IDTFT_H
+#define IDTFT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Host-side batch inverse DTFT, the C counterpart of inverse_dtft_complex.m
+//
+// Each spectrum holds num_points complex values at ω_k = πk/(num_points-1).
+// The signal is recovered as
+//   x[n] = (Re X_0 + 2 * Σ_{0<k<K-1} Re{X_k e^{jω_k n}} + Re{X_{K-1} e^{jπn}}) / signal_len
+// then thresholded at max(x)/2 and the first pattern_len samples are packed
+// MSB-first into the returned pattern. Unlike the MATLAB script, the π bin is
+// weighted once, which makes the inverse exact for N = 2*(num_points-1).
+//
+// The idtft_match_* functions decode the same spectra by nearest table entry
+// instead. Both run on the instruction set selected in host_simd.h.
+
+typedef struct {
+    int num_points;
+    int signal_len;
+    int pattern_len;
+    int stride;          // num_points padded to a multiple of 8 floats (SIMD lanes)
+    float *cos_matrix;   // [signal_len][stride], weights and 1/N folded in
+    float *sin_matrix;   // [signal_len][stride], weights, sign and 1/N folded in
+    int sample_stride;   // signal_len padded to a multiple of 16 samples
+    float *cos_by_bin;   // [num_points][sample_stride], cos_matrix transposed for the SIMD
+    float *sin_by_bin;   // kernels; padding samples repeat sample 0 so the max is unchanged
+} idtft_plan_t;
+
+// Largest pattern the nearest-entry decoder searches exhaustively
+#define IDTFT_MATCH_MAX_BITS 12
+
+typedef struct {
+    int num_points;
+    int signal_len;
+    int pattern_len;
+    int num_values;      // 1 << pattern_len
+    int value_stride;    // num_values padded to a multiple of 16 (padding never matches)
+    int num_dims;        // Spectrum components where some entry is nonzero
+    int *dims;           // [num_dims] index of each into the record (2k real, 2k+1 imag)
+    float *table;        // [num_dims][value_stride], entry values along each component
+} idtft_match_plan_t;
+
+/**
+ * Precompute the cos/sin matrices for one configuration
+ * @param num_points Frequency points from 0 to π (41 for the n10 table)
+ * @param signal_len Length of the transformed signal (80)
+ * @param pattern_len Bits per pattern (1-16)
+ * @return Plan (free with idtft_plan_destroy), or NULL on error
+ */
+idtft_plan_t* idtft_plan_create(int num_points, int signal_len, int pattern_len);
+
+/**
+ * Free a plan
+ * @param plan Plan from idtft_plan_create (NULL is ignored)
+ */
+void idtft_plan_destroy(idtft_plan_t *plan);
+
+/**
+ * Inverse-transform one spectrum and threshold it into a pattern
+ * @param plan Precomputed plan
+ * @param spectrum Complex values [real0, imag0, real1, imag1, ...]
+ * @return Packed pattern, first sample in the MSB
+ */
+uint16_t idtft_decode_one(const idtft_plan_t *plan, const float *spectrum);
+
+/**
+ * Decode a batch of spectra, split across threads
+ * @param plan Precomputed plan
+ * @param spectra count spectra of num_points complex values each, back to back
+ * @param count Number of spectra
+ * @param patterns Output: count packed patterns
+ * @param num_threads Worker threads (<= 0 uses all online CPUs)
+ */
+void idtft_decode_batch(const idtft_plan_t *plan, const float *spectra, size_t count,
+                        uint16_t *patterns, int num_threads);
+
+/**
+ * Precompute the spectrum of every pattern repeated over signal_len samples
+ * Components that are zero in every entry add the same distance to all of
+ * them and are left out of the search (8 of 82 remain for the n10 table).
+ * @param num_points Frequency points from 0 to π
+ * @param signal_len Length of the transformed signal
+ * @param pattern_len Bits per pattern (1-IDTFT_MATCH_MAX_BITS)
+ * @return Plan (free with idtft_match_plan_destroy), or NULL on error
+ */
+idtft_match_plan_t* idtft_match_plan_create(int num_points, int signal_len, int pattern_len);
+
+/**
+ * Free a match plan
+ * @param plan Plan from idtft_match_plan_create (NULL is ignored)
+ */
+void idtft_match_plan_destroy(idtft_match_plan_t *plan);
+
+/**
+ * Pattern whose spectrum is nearest (squared distance) to one spectrum
+ * @param plan Precomputed match plan
+ * @param spectrum Complex values [real0, imag0, real1, imag1, ...]
+ * @return Pattern; the lowest one on a tie
+ */
+uint16_t idtft_match_one(const idtft_match_plan_t *plan, const float *spectrum);
+
+/**
+ * Match a batch of spectra, split across threads
+ * @param plan Precomputed match plan
+ * @param spectra count spectra of num_points complex values each, back to back
+ * @param count Number of spectra
+ * @param patterns Output: count patterns
+ * @param num_threads Worker threads (<= 0 uses all online CPUs)
+ */
+void idtft_match_batch(const idtft_match_plan_t *plan, const float *spectra, size_t count,
+                       uint16_t *patterns, int num_threads);
+
+#endif // IDTFT_H
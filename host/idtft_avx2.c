@@ -0,0 +1,150 @@
+// AVX2 + FMA kernels (8 lanes), built for every x86-64 host and only called
+// when host_simd_supported(HOST_SIMD_AVX2)
+#if defined(__x86_64__)
+
+#include "idtft_kernels.h"
+#include <immintrin.h>
+
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+
+AVX2_TARGET static inline float max_lanes(__m256 v) {
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+    return _mm_cvtss_f32(m);
+}
+
+AVX2_TARGET static inline float min_lanes(__m256 v) {
+    __m128 m = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    m = _mm_min_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_min_ss(m, _mm_shuffle_ps(m, m, 1));
+    return _mm_cvtss_f32(m);
+}
+
+AVX2_TARGET void idtft_decode_avx2(const idtft_plan_t *plan, const float *spectra, size_t count,
+                                   uint16_t *patterns) {
+    const int num_points = plan->num_points;
+    const int S = plan->sample_stride;
+    const size_t record = (size_t)num_points * 2;
+    float samples[IDTFT_MAX_SAMPLES] __attribute__((aligned(32)));
+
+    for (size_t i = 0; i < count; i++) {
+        const float *spectrum = &spectra[i * record];
+        int n = 0;
+
+        // 32 samples per pass over the bins; the re and im products go to
+        // separate accumulators so eight FMA chains are in flight
+        for (; n + 32 <= S; n += 32) {
+            const float *c = &plan->cos_by_bin[n];
+            const float *s = &plan->sin_by_bin[n];
+            __m256 r0 = _mm256_setzero_ps(), r1 = r0, r2 = r0, r3 = r0;
+            __m256 i0 = r0, i1 = r0, i2 = r0, i3 = r0;
+            for (int k = 0; k < num_points; k++, c += S, s += S) {
+                const __m256 re = _mm256_broadcast_ss(&spectrum[2*k]);
+                const __m256 im = _mm256_broadcast_ss(&spectrum[2*k + 1]);
+                r0 = _mm256_fmadd_ps(re, _mm256_load_ps(c), r0);
+                r1 = _mm256_fmadd_ps(re, _mm256_load_ps(c + 8), r1);
+                r2 = _mm256_fmadd_ps(re, _mm256_load_ps(c + 16), r2);
+                r3 = _mm256_fmadd_ps(re, _mm256_load_ps(c + 24), r3);
+                i0 = _mm256_fmadd_ps(im, _mm256_load_ps(s), i0);
+                i1 = _mm256_fmadd_ps(im, _mm256_load_ps(s + 8), i1);
+                i2 = _mm256_fmadd_ps(im, _mm256_load_ps(s + 16), i2);
+                i3 = _mm256_fmadd_ps(im, _mm256_load_ps(s + 24), i3);
+            }
+            _mm256_store_ps(&samples[n], _mm256_add_ps(r0, i0));
+            _mm256_store_ps(&samples[n + 8], _mm256_add_ps(r1, i1));
+            _mm256_store_ps(&samples[n + 16], _mm256_add_ps(r2, i2));
+            _mm256_store_ps(&samples[n + 24], _mm256_add_ps(r3, i3));
+        }
+        // Remaining registers one at a time, four bins per step so the
+        // accumulator chains stay as many
+        for (; n < S; n += 8) {
+            const float *c = &plan->cos_by_bin[n];
+            const float *s = &plan->sin_by_bin[n];
+            __m256 r0 = _mm256_setzero_ps(), r1 = r0, r2 = r0, r3 = r0;
+            __m256 i0 = r0, i1 = r0, i2 = r0, i3 = r0;
+            int k = 0;
+            for (; k + 4 <= num_points; k += 4, c += 4 * S, s += 4 * S) {
+                r0 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k]), _mm256_load_ps(c), r0);
+                r1 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k + 2]), _mm256_load_ps(c + S), r1);
+                r2 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k + 4]), _mm256_load_ps(c + 2 * S), r2);
+                r3 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k + 6]), _mm256_load_ps(c + 3 * S), r3);
+                i0 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k + 1]), _mm256_load_ps(s), i0);
+                i1 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k + 3]), _mm256_load_ps(s + S), i1);
+                i2 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k + 5]), _mm256_load_ps(s + 2 * S), i2);
+                i3 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k + 7]), _mm256_load_ps(s + 3 * S), i3);
+            }
+            for (; k < num_points; k++, c += S, s += S) {
+                r0 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k]), _mm256_load_ps(c), r0);
+                i0 = _mm256_fmadd_ps(_mm256_broadcast_ss(&spectrum[2*k + 1]), _mm256_load_ps(s), i0);
+            }
+            _mm256_store_ps(&samples[n], _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(r0, i0), _mm256_add_ps(r1, i1)),
+                                          _mm256_add_ps(_mm256_add_ps(r2, i2), _mm256_add_ps(r3, i3))));
+        }
+
+        // Padding samples repeat sample 0, so the max runs over whole registers
+        __m256 max = _mm256_load_ps(samples);
+        for (n = 8; n < S; n += 8) {
+            max = _mm256_max_ps(max, _mm256_load_ps(&samples[n]));
+        }
+        patterns[i] = idtft_pack_head(samples, plan->pattern_len, max_lanes(max));
+    }
+}
+
+AVX2_TARGET void idtft_match_avx2(const idtft_match_plan_t *plan, const float *spectra, size_t count,
+                                  uint16_t *patterns) {
+    const int V = plan->value_stride;
+    const int num_dims = plan->num_dims;
+    const size_t record = (size_t)plan->num_points * 2;
+    float distances[IDTFT_MATCH_MAX_VALUES] __attribute__((aligned(32)));
+
+    for (size_t i = 0; i < count; i++) {
+        const float *spectrum = &spectra[i * record];
+        int v = 0;
+
+        // 32 values per pass over the components
+        for (; v + 32 <= V; v += 32) {
+            const float *t = &plan->table[v];
+            __m256 d0 = _mm256_setzero_ps(), d1 = d0, d2 = d0, d3 = d0;
+            for (int d = 0; d < num_dims; d++, t += V) {
+                const __m256 x = _mm256_broadcast_ss(&spectrum[plan->dims[d]]);
+                const __m256 e0 = _mm256_sub_ps(x, _mm256_load_ps(t));
+                const __m256 e1 = _mm256_sub_ps(x, _mm256_load_ps(t + 8));
+                const __m256 e2 = _mm256_sub_ps(x, _mm256_load_ps(t + 16));
+                const __m256 e3 = _mm256_sub_ps(x, _mm256_load_ps(t + 24));
+                d0 = _mm256_fmadd_ps(e0, e0, d0);
+                d1 = _mm256_fmadd_ps(e1, e1, d1);
+                d2 = _mm256_fmadd_ps(e2, e2, d2);
+                d3 = _mm256_fmadd_ps(e3, e3, d3);
+            }
+            _mm256_store_ps(&distances[v], d0);
+            _mm256_store_ps(&distances[v + 8], d1);
+            _mm256_store_ps(&distances[v + 16], d2);
+            _mm256_store_ps(&distances[v + 24], d3);
+        }
+        for (; v < V; v += 8) {
+            const float *t = &plan->table[v];
+            __m256 d0 = _mm256_setzero_ps();
+            for (int d = 0; d < num_dims; d++, t += V) {
+                const __m256 e0 = _mm256_sub_ps(_mm256_broadcast_ss(&spectrum[plan->dims[d]]), _mm256_load_ps(t));
+                d0 = _mm256_fmadd_ps(e0, e0, d0);
+            }
+            _mm256_store_ps(&distances[v], d0);
+        }
+
+        __m256 min = _mm256_load_ps(distances);
+        for (v = 8; v < V; v += 8) {
+            min = _mm256_min_ps(min, _mm256_load_ps(&distances[v]));
+        }
+        const __m256 target = _mm256_set1_ps(min_lanes(min));
+        for (v = 0; ; v += 8) {
+            int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_load_ps(&distances[v]), target, _CMP_EQ_OQ));
+            if (mask) {
+                patterns[i] = (uint16_t)(v + __builtin_ctz(mask));
+                break;
+            }
+        }
+    }
+}
+
+#endif // __x86_64__
@@ -0,0 +1,135 @@
+// AVX-512F kernels (16 lanes), built for every x86-64 host and only called
+// when host_simd_supported(HOST_SIMD_AVX512)
+#if defined(__x86_64__)
+
+#include "idtft_kernels.h"
+#include <immintrin.h>
+
+#define AVX512_TARGET __attribute__((target("avx512f")))
+
+AVX512_TARGET void idtft_decode_avx512(const idtft_plan_t *plan, const float *spectra, size_t count,
+                                       uint16_t *patterns) {
+    const int num_points = plan->num_points;
+    const int S = plan->sample_stride;
+    const size_t record = (size_t)num_points * 2;
+    float samples[IDTFT_MAX_SAMPLES] __attribute__((aligned(64)));
+
+    for (size_t i = 0; i < count; i++) {
+        const float *spectrum = &spectra[i * record];
+        int n = 0;
+
+        // 64 samples per pass over the bins, re and im products accumulated apart
+        for (; n + 64 <= S; n += 64) {
+            const float *c = &plan->cos_by_bin[n];
+            const float *s = &plan->sin_by_bin[n];
+            __m512 r0 = _mm512_setzero_ps(), r1 = r0, r2 = r0, r3 = r0;
+            __m512 i0 = r0, i1 = r0, i2 = r0, i3 = r0;
+            for (int k = 0; k < num_points; k++, c += S, s += S) {
+                const __m512 re = _mm512_set1_ps(spectrum[2*k]);
+                const __m512 im = _mm512_set1_ps(spectrum[2*k + 1]);
+                r0 = _mm512_fmadd_ps(re, _mm512_load_ps(c), r0);
+                r1 = _mm512_fmadd_ps(re, _mm512_load_ps(c + 16), r1);
+                r2 = _mm512_fmadd_ps(re, _mm512_load_ps(c + 32), r2);
+                r3 = _mm512_fmadd_ps(re, _mm512_load_ps(c + 48), r3);
+                i0 = _mm512_fmadd_ps(im, _mm512_load_ps(s), i0);
+                i1 = _mm512_fmadd_ps(im, _mm512_load_ps(s + 16), i1);
+                i2 = _mm512_fmadd_ps(im, _mm512_load_ps(s + 32), i2);
+                i3 = _mm512_fmadd_ps(im, _mm512_load_ps(s + 48), i3);
+            }
+            _mm512_store_ps(&samples[n], _mm512_add_ps(r0, i0));
+            _mm512_store_ps(&samples[n + 16], _mm512_add_ps(r1, i1));
+            _mm512_store_ps(&samples[n + 32], _mm512_add_ps(r2, i2));
+            _mm512_store_ps(&samples[n + 48], _mm512_add_ps(r3, i3));
+        }
+        // Remaining registers one at a time, four bins per step so the
+        // accumulator chains stay as many
+        for (; n < S; n += 16) {
+            const float *c = &plan->cos_by_bin[n];
+            const float *s = &plan->sin_by_bin[n];
+            __m512 r0 = _mm512_setzero_ps(), r1 = r0, r2 = r0, r3 = r0;
+            __m512 i0 = r0, i1 = r0, i2 = r0, i3 = r0;
+            int k = 0;
+            for (; k + 4 <= num_points; k += 4, c += 4 * S, s += 4 * S) {
+                r0 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k]), _mm512_load_ps(c), r0);
+                r1 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k + 2]), _mm512_load_ps(c + S), r1);
+                r2 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k + 4]), _mm512_load_ps(c + 2 * S), r2);
+                r3 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k + 6]), _mm512_load_ps(c + 3 * S), r3);
+                i0 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k + 1]), _mm512_load_ps(s), i0);
+                i1 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k + 3]), _mm512_load_ps(s + S), i1);
+                i2 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k + 5]), _mm512_load_ps(s + 2 * S), i2);
+                i3 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k + 7]), _mm512_load_ps(s + 3 * S), i3);
+            }
+            for (; k < num_points; k++, c += S, s += S) {
+                r0 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k]), _mm512_load_ps(c), r0);
+                i0 = _mm512_fmadd_ps(_mm512_set1_ps(spectrum[2*k + 1]), _mm512_load_ps(s), i0);
+            }
+            _mm512_store_ps(&samples[n], _mm512_add_ps(_mm512_add_ps(_mm512_add_ps(r0, i0), _mm512_add_ps(r1, i1)),
+                                          _mm512_add_ps(_mm512_add_ps(r2, i2), _mm512_add_ps(r3, i3))));
+        }
+
+        // Padding samples repeat sample 0, so the max runs over whole registers
+        __m512 max = _mm512_load_ps(samples);
+        for (n = 16; n < S; n += 16) {
+            max = _mm512_max_ps(max, _mm512_load_ps(&samples[n]));
+        }
+        patterns[i] = idtft_pack_head(samples, plan->pattern_len, _mm512_reduce_max_ps(max));
+    }
+}
+
+AVX512_TARGET void idtft_match_avx512(const idtft_match_plan_t *plan, const float *spectra, size_t count,
+                                      uint16_t *patterns) {
+    const int V = plan->value_stride;
+    const int num_dims = plan->num_dims;
+    const size_t record = (size_t)plan->num_points * 2;
+    float distances[IDTFT_MATCH_MAX_VALUES] __attribute__((aligned(64)));
+
+    for (size_t i = 0; i < count; i++) {
+        const float *spectrum = &spectra[i * record];
+        int v = 0;
+
+        // 64 values per pass over the components
+        for (; v + 64 <= V; v += 64) {
+            const float *t = &plan->table[v];
+            __m512 d0 = _mm512_setzero_ps(), d1 = d0, d2 = d0, d3 = d0;
+            for (int d = 0; d < num_dims; d++, t += V) {
+                const __m512 x = _mm512_set1_ps(spectrum[plan->dims[d]]);
+                const __m512 e0 = _mm512_sub_ps(x, _mm512_load_ps(t));
+                const __m512 e1 = _mm512_sub_ps(x, _mm512_load_ps(t + 16));
+                const __m512 e2 = _mm512_sub_ps(x, _mm512_load_ps(t + 32));
+                const __m512 e3 = _mm512_sub_ps(x, _mm512_load_ps(t + 48));
+                d0 = _mm512_fmadd_ps(e0, e0, d0);
+                d1 = _mm512_fmadd_ps(e1, e1, d1);
+                d2 = _mm512_fmadd_ps(e2, e2, d2);
+                d3 = _mm512_fmadd_ps(e3, e3, d3);
+            }
+            _mm512_store_ps(&distances[v], d0);
+            _mm512_store_ps(&distances[v + 16], d1);
+            _mm512_store_ps(&distances[v + 32], d2);
+            _mm512_store_ps(&distances[v + 48], d3);
+        }
+        for (; v < V; v += 16) {
+            const float *t = &plan->table[v];
+            __m512 d0 = _mm512_setzero_ps();
+            for (int d = 0; d < num_dims; d++, t += V) {
+                const __m512 e0 = _mm512_sub_ps(_mm512_set1_ps(spectrum[plan->dims[d]]), _mm512_load_ps(t));
+                d0 = _mm512_fmadd_ps(e0, e0, d0);
+            }
+            _mm512_store_ps(&distances[v], d0);
+        }
+
+        __m512 min = _mm512_load_ps(distances);
+        for (v = 16; v < V; v += 16) {
+            min = _mm512_min_ps(min, _mm512_load_ps(&distances[v]));
+        }
+        const __m512 target = _mm512_set1_ps(_mm512_reduce_min_ps(min));
+        for (v = 0; ; v += 16) {
+            __mmask16 mask = _mm512_cmp_ps_mask(_mm512_load_ps(&distances[v]), target, _CMP_EQ_OQ);
+            if (mask) {
+                patterns[i] = (uint16_t)(v + __builtin_ctz(mask));
+                break;
+            }
+        }
+    }
+}
+
+#endif // __x86_64__
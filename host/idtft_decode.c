@@ -0,0 +1,246 @@
+/**
+ * idtft_decode - bulk inverse-DTFT decoder for binary spectrum exports
+ *
+ * Usage:
+ *   idtft_decode [-t threads] [-o patterns.bin] [--hex] [--truth file] [--match]
+ *                [--simd LEVEL] spectra.dtfs
+ *   idtft_decode --synthesize COUNT [--noise SIGMA] spectra.dtfs
+ *
+ * Decoded patterns are written as one byte each (two bytes, little-endian,
+ * for patterns wider than 8 bits). --synthesize writes COUNT spectra of
+ * random 8-bit patterns (n10 configuration) plus a <file>.truth pattern file.
+ * --match decodes each spectrum to the nearest repeated pattern's spectrum
+ * instead of thresholding its inverse; --simd picks the instruction set
+ * (scalar, neon, avx2, avx512; default the best the CPU has).
+ */
+#include "idtft.h"
+#include "host_simd.h"
+#include "spectrum_file.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Spectra decoded per read, bounds memory for multi-million record files
+#define DECODE_CHUNK 65536
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint64_t rng_next(void) {
+    // xorshift64*
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static double rng_gaussian(void) {
+    double u1 = ((rng_next() >> 11) + 1.0) / 9007199254740993.0;
+    double u2 = (rng_next() >> 11) / 9007199254740992.0;
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static int synthesize(const char *path, long count, double noise) {
+    const int num_points = 41, signal_len = 80, pattern_len = 8;
+
+    // Exact spectra of every repeated pattern, computed once in double
+    static float spectra[256][41 * 2];
+    for (int value = 0; value < 256; value++) {
+        for (int k = 0; k < num_points; k++) {
+            double omega = M_PI * k / (num_points - 1);
+            double re = 0.0, im = 0.0;
+            for (int n = 0; n < signal_len; n++) {
+                int bit = (value >> (pattern_len - 1 - n % pattern_len)) & 1;
+                re += bit * cos(-omega * n);
+                im += bit * sin(-omega * n);
+            }
+            spectra[value][2*k] = (float)re;
+            spectra[value][2*k + 1] = (float)im;
+        }
+    }
+
+    char truth_path[4096];
+    snprintf(truth_path, sizeof(truth_path), "%s.truth", path);
+    FILE *out = fopen(path, "wb");
+    FILE *truth = fopen(truth_path, "wb");
+    if (!out || !truth) {
+        fprintf(stderr, "Error: cannot create %s\n", out ? truth_path : path);
+        if (out) fclose(out);
+        if (truth) fclose(truth);
+        return 1;
+    }
+
+    spectrum_file_header_t header = {
+        .num_points = num_points, .signal_len = signal_len,
+        .pattern_len = pattern_len, .count = (uint32_t)count,
+    };
+    spectrum_file_write_header(out, &header);
+
+    float record[41 * 2];
+    for (long i = 0; i < count; i++) {
+        uint8_t value = (uint8_t)(rng_next() >> 56);
+        memcpy(record, spectra[value], sizeof(record));
+        if (noise > 0.0) {
+            for (int j = 0; j < num_points * 2; j++) {
+                record[j] += (float)(noise * rng_gaussian());
+            }
+        }
+        fwrite(record, sizeof(record), 1, out);
+        fputc(value, truth);
+    }
+
+    fclose(out);
+    fclose(truth);
+    printf("Wrote %ld spectra to %s (truth: %s)\n", count, path, truth_path);
+    return 0;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "Usage: idtft_decode [-t threads] [-o patterns.bin] [--hex] [--truth file] [--match]\n"
+            "                    [--simd scalar|neon|avx2|avx512|best] spectra.dtfs\n"
+            "       idtft_decode --synthesize COUNT [--noise SIGMA] spectra.dtfs\n");
+}
+
+int main(int argc, char **argv) {
+    const char *input = NULL;
+    const char *output = NULL;
+    const char *truth_path = NULL;
+    int threads = 0;
+    int hex = 0;
+    int match = 0;
+    long synth_count = -1;
+    double noise = 0.0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+            output = argv[++i];
+        } else if (!strcmp(argv[i], "--hex")) {
+            hex = 1;
+        } else if (!strcmp(argv[i], "--match")) {
+            match = 1;
+        } else if (!strcmp(argv[i], "--simd") && i + 1 < argc) {
+            host_simd_t level;
+            if (!host_simd_parse(argv[++i], &level)) {
+                usage();
+                return 1;
+            }
+            if (!host_simd_set(level)) {
+                return 1;
+            }
+        } else if (!strcmp(argv[i], "--truth") && i + 1 < argc) {
+            truth_path = argv[++i];
+        } else if (!strcmp(argv[i], "--synthesize") && i + 1 < argc) {
+            synth_count = atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--noise") && i + 1 < argc) {
+            noise = atof(argv[++i]);
+        } else if (argv[i][0] != '-' && !input) {
+            input = argv[i];
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (!input) {
+        usage();
+        return 1;
+    }
+    if (synth_count >= 0) {
+        return synthesize(input, synth_count, noise);
+    }
+
+    FILE *in = fopen(input, "rb");
+    if (!in) {
+        fprintf(stderr, "Error: cannot open %s\n", input);
+        return 1;
+    }
+    spectrum_file_header_t header;
+    if (spectrum_file_read_header(in, &header) != 0) {
+        fclose(in);
+        return 1;
+    }
+
+    idtft_plan_t *plan = NULL;
+    idtft_match_plan_t *match_plan = NULL;
+    if (match) {
+        match_plan = idtft_match_plan_create(header.num_points, header.signal_len, header.pattern_len);
+    } else {
+        plan = idtft_plan_create(header.num_points, header.signal_len, header.pattern_len);
+    }
+    FILE *out = output ? fopen(output, "wb") : NULL;
+    FILE *truth = truth_path ? fopen(truth_path, "rb") : NULL;
+    const size_t record = (size_t)header.num_points * 2;
+    float *spectra = malloc(DECODE_CHUNK * record * sizeof(float));
+    uint16_t *patterns = malloc(DECODE_CHUNK * sizeof(uint16_t));
+    if ((!plan && !match_plan) || !spectra || !patterns || (output && !out) || (truth_path && !truth)) {
+        fprintf(stderr, "Error: setup failed (plan, buffers or output files)\n");
+        return 1;
+    }
+
+    printf("Decoding %u spectra (%u points, N=%u, %u-bit patterns, %s, %s)\n",
+           header.count, header.num_points, header.signal_len, header.pattern_len,
+           match ? "nearest entry" : "threshold", host_simd_name(host_simd_current()));
+
+    size_t decoded = 0, correct = 0;
+    double decode_time = 0.0;
+    while (decoded < header.count) {
+        size_t want = header.count - decoded;
+        if (want > DECODE_CHUNK) want = DECODE_CHUNK;
+        size_t got = fread(spectra, record * sizeof(float), want, in);
+        if (got == 0) {
+            fprintf(stderr, "Warning: file ended after %zu spectra\n", decoded);
+            break;
+        }
+
+        double t0 = now_seconds();
+        if (match) {
+            idtft_match_batch(match_plan, spectra, got, patterns, threads);
+        } else {
+            idtft_decode_batch(plan, spectra, got, patterns, threads);
+        }
+        decode_time += now_seconds() - t0;
+
+        for (size_t i = 0; i < got; i++) {
+            if (out) {
+                uint8_t bytes[2] = { (uint8_t)patterns[i], (uint8_t)(patterns[i] >> 8) };
+                fwrite(bytes, header.pattern_len > 8 ? 2 : 1, 1, out);
+            }
+            if (hex) {
+                printf("%02X", patterns[i]);
+                printf(((decoded + i + 1) % 16 == 0) ? "\n" : " ");
+            }
+            if (truth) {
+                int expected = fgetc(truth);
+                if (header.pattern_len > 8) expected |= fgetc(truth) << 8;
+                correct += (expected == patterns[i]);
+            }
+        }
+        decoded += got;
+    }
+    if (hex && decoded % 16 != 0) printf("\n");
+
+    printf("Decoded %zu spectra in %.3f s (%.2f M spectra/s)\n",
+           decoded, decode_time, decode_time > 0 ? decoded / decode_time / 1e6 : 0.0);
+    if (truth) {
+        printf("Correct: %zu/%zu (%.2f%%)\n", correct, decoded,
+               decoded ? 100.0 * correct / decoded : 0.0);
+        fclose(truth);
+    }
+
+    if (out) fclose(out);
+    fclose(in);
+    free(spectra);
+    free(patterns);
+    idtft_plan_destroy(plan);
+    idtft_match_plan_destroy(match_plan);
+    return 0;
+}
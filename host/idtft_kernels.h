@@ -0,0 +1,57 @@
+#ifndef IDTFT_KERNELS_H
+#define IDTFT_KERNELS_H
+
+#include "idtft.h"
+
+// Per-instruction-set kernels behind idtft.c's dispatch (one file per set,
+// each compiled with its own target attribute). A kernel decodes count
+// consecutive spectra; idtft.c splits batches across threads.
+
+// Largest padded signal and value count the kernels keep on the stack
+#define IDTFT_MAX_SAMPLES 4096
+#define IDTFT_MATCH_MAX_VALUES (1 << IDTFT_MATCH_MAX_BITS)
+
+typedef void (*idtft_decode_kernel_t)(const idtft_plan_t *plan, const float *spectra,
+                                      size_t count, uint16_t *patterns);
+typedef void (*idtft_match_kernel_t)(const idtft_match_plan_t *plan, const float *spectra,
+                                     size_t count, uint16_t *patterns);
+
+void idtft_decode_scalar(const idtft_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns);
+void idtft_match_scalar(const idtft_match_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns);
+
+#if defined(__x86_64__)
+void idtft_decode_avx2(const idtft_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns);
+void idtft_match_avx2(const idtft_match_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns);
+void idtft_decode_avx512(const idtft_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns);
+void idtft_match_avx512(const idtft_match_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns);
+#endif
+
+#if defined(__aarch64__)
+void idtft_decode_neon(const idtft_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns);
+void idtft_match_neon(const idtft_match_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns);
+#endif
+
+/**
+ * Threshold the reconstructed signal at max/2 and pack its head MSB first
+ */
+static inline uint16_t idtft_pack_head(const float *samples, int pattern_len, float max_value) {
+    const float threshold = max_value / 2.0f;
+    uint16_t pattern = 0;
+    for (int n = 0; n < pattern_len; n++) {
+        pattern = (uint16_t)((pattern << 1) | (samples[n] > threshold));
+    }
+    return pattern;
+}
+
+/**
+ * First value at the minimum distance (the scalar search's tie rule)
+ */
+static inline uint16_t idtft_first_min(const float *distances, int num_values, float min_distance) {
+    int value = 0;
+    while (value < num_values - 1 && distances[value] != min_distance) {
+        value++;
+    }
+    return (uint16_t)value;
+}
+
+#endif // IDTFT_KERNELS_H
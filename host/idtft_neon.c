@@ -0,0 +1,88 @@
+// Advanced SIMD kernels (4 lanes) for aarch64, where NEON is always present
+#if defined(__aarch64__)
+
+#include "idtft_kernels.h"
+#include <arm_neon.h>
+
+void idtft_decode_neon(const idtft_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns) {
+    const int num_points = plan->num_points;
+    const int S = plan->sample_stride;
+    const size_t record = (size_t)num_points * 2;
+    float samples[IDTFT_MAX_SAMPLES] __attribute__((aligned(16)));
+
+    for (size_t i = 0; i < count; i++) {
+        const float *spectrum = &spectra[i * record];
+
+        // 16 samples per pass over the bins (S is a multiple of 16), re and
+        // im products accumulated apart
+        for (int n = 0; n < S; n += 16) {
+            const float *c = &plan->cos_by_bin[n];
+            const float *s = &plan->sin_by_bin[n];
+            float32x4_t r0 = vdupq_n_f32(0.0f), r1 = r0, r2 = r0, r3 = r0;
+            float32x4_t i0 = r0, i1 = r0, i2 = r0, i3 = r0;
+            for (int k = 0; k < num_points; k++, c += S, s += S) {
+                const float32x4_t re = vdupq_n_f32(spectrum[2*k]);
+                const float32x4_t im = vdupq_n_f32(spectrum[2*k + 1]);
+                r0 = vfmaq_f32(r0, re, vld1q_f32(c));
+                r1 = vfmaq_f32(r1, re, vld1q_f32(c + 4));
+                r2 = vfmaq_f32(r2, re, vld1q_f32(c + 8));
+                r3 = vfmaq_f32(r3, re, vld1q_f32(c + 12));
+                i0 = vfmaq_f32(i0, im, vld1q_f32(s));
+                i1 = vfmaq_f32(i1, im, vld1q_f32(s + 4));
+                i2 = vfmaq_f32(i2, im, vld1q_f32(s + 8));
+                i3 = vfmaq_f32(i3, im, vld1q_f32(s + 12));
+            }
+            vst1q_f32(&samples[n], vaddq_f32(r0, i0));
+            vst1q_f32(&samples[n + 4], vaddq_f32(r1, i1));
+            vst1q_f32(&samples[n + 8], vaddq_f32(r2, i2));
+            vst1q_f32(&samples[n + 12], vaddq_f32(r3, i3));
+        }
+
+        // Padding samples repeat sample 0, so the max runs over whole registers
+        float32x4_t max = vld1q_f32(samples);
+        for (int n = 4; n < S; n += 4) {
+            max = vmaxq_f32(max, vld1q_f32(&samples[n]));
+        }
+        patterns[i] = idtft_pack_head(samples, plan->pattern_len, vmaxvq_f32(max));
+    }
+}
+
+void idtft_match_neon(const idtft_match_plan_t *plan, const float *spectra, size_t count, uint16_t *patterns) {
+    const int V = plan->value_stride;
+    const int num_dims = plan->num_dims;
+    const size_t record = (size_t)plan->num_points * 2;
+    float distances[IDTFT_MATCH_MAX_VALUES] __attribute__((aligned(16)));
+
+    for (size_t i = 0; i < count; i++) {
+        const float *spectrum = &spectra[i * record];
+
+        // 16 values per pass over the components (V is a multiple of 16)
+        for (int v = 0; v < V; v += 16) {
+            const float *t = &plan->table[v];
+            float32x4_t d0 = vdupq_n_f32(0.0f), d1 = d0, d2 = d0, d3 = d0;
+            for (int d = 0; d < num_dims; d++, t += V) {
+                const float32x4_t x = vdupq_n_f32(spectrum[plan->dims[d]]);
+                const float32x4_t e0 = vsubq_f32(x, vld1q_f32(t));
+                const float32x4_t e1 = vsubq_f32(x, vld1q_f32(t + 4));
+                const float32x4_t e2 = vsubq_f32(x, vld1q_f32(t + 8));
+                const float32x4_t e3 = vsubq_f32(x, vld1q_f32(t + 12));
+                d0 = vfmaq_f32(d0, e0, e0);
+                d1 = vfmaq_f32(d1, e1, e1);
+                d2 = vfmaq_f32(d2, e2, e2);
+                d3 = vfmaq_f32(d3, e3, e3);
+            }
+            vst1q_f32(&distances[v], d0);
+            vst1q_f32(&distances[v + 4], d1);
+            vst1q_f32(&distances[v + 8], d2);
+            vst1q_f32(&distances[v + 12], d3);
+        }
+
+        float32x4_t min = vld1q_f32(distances);
+        for (int v = 4; v < V; v += 4) {
+            min = vminq_f32(min, vld1q_f32(&distances[v]));
+        }
+        patterns[i] = idtft_first_min(distances, plan->num_values, vminvq_f32(min));
+    }
+}
+
+#endif // __aarch64__
@@ -0,0 +1,75 @@
+// Checks the lazy coarse-to-fine matcher (process_pattern_lazy_return_value)
+// against the full-spectrum matcher for every 8-bit pattern and sample
+// divisor, and reports the average number of DTFT bins computed per pixel.
+
+#include "signal.h"
+#include <stdio.h>
+#include <time.h>
+
+#define TIMING_ROUNDS 50
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Record as send_receive_data() builds it: [len, held bits...]
+static void hold_pattern(int value, int divisor, uint8_t *record) {
+    uint8_t held = 0;
+    record[0] = 8;
+    for (int n = 0; n < 8; n++) {
+        if (n % divisor == 0) {
+            held = (value >> (7 - n)) & 1;
+        }
+        record[1 + n] = held;
+    }
+}
+
+int main(void) {
+    static const int divisors[] = {1, 2, 4, 8};
+    int failures = 0;
+
+    printf("divisor  agree     bins/pixel  full us  lazy us\n");
+    for (unsigned d = 0; d < sizeof(divisors) / sizeof(divisors[0]); d++) {
+        const int divisor = divisors[d];
+        uint8_t records[256][9];
+        int agree = 0;
+
+        lazy_match_reset_stats();
+        for (int value = 0; value < 256; value++) {
+            hold_pattern(value, divisor, records[value]);
+            if (process_pattern_lazy_return_value(records[value], divisor) ==
+                process_pattern_zoh_return_value(records[value], divisor)) {
+                agree++;
+            }
+        }
+        uint32_t pixels, bins;
+        lazy_match_get_stats(&pixels, &bins);
+
+        volatile unsigned sink = 0;
+        double t0 = now_s();
+        for (int round = 0; round < TIMING_ROUNDS; round++) {
+            for (int value = 0; value < 256; value++) {
+                sink += process_pattern_zoh_return_value(records[value], divisor);
+            }
+        }
+        double t1 = now_s();
+        for (int round = 0; round < TIMING_ROUNDS; round++) {
+            for (int value = 0; value < 256; value++) {
+                sink += process_pattern_lazy_return_value(records[value], divisor);
+            }
+        }
+        double t2 = now_s();
+        (void)sink;
+
+        printf("%7d  %3d/256  %10.2f  %7.2f  %7.2f\n", divisor, agree, (double)bins / pixels,
+               (t1 - t0) * 1e6 / (TIMING_ROUNDS * 256), (t2 - t1) * 1e6 / (TIMING_ROUNDS * 256));
+        if (agree != 256) {
+            failures++;
+        }
+    }
+
+    printf("%s\n", failures ? "MISMATCH" : "OK: lazy matcher agrees with the full matcher");
+    return failures ? 1 : 0;
+}
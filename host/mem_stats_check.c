@@ -0,0 +1,248 @@
+// Heap and stack footprint of each decode stage (lib/mem_stats.h).
+//
+// Runs the stages of the firmware over the simulated link: building the
+// matcher tables, every 8-bit matcher on every value, the soft matcher on
+// oversampled counts, 9-16 bit widths through the width table cache, the
+// dual-core DTFT and the terminal spectrum plot. For each stage it reports
+// heap allocations and bytes per pixel, the stage's peak heap above what was
+// live before it, bytes left allocated, and the deepest stack use of Core0 in
+// the stage (painted again before each one) and of Core1 since its worker
+// started. The host simulator counts stack depth from the painting frame, and
+// glibc's printf makes host stacks deeper than the Pico's.
+//
+// Per-pixel stages must free everything they allocate and the dual-core stage
+// must show Core1 stack use; --max-peak and --max-stack also fail the check
+// when a stage's peak heap or either core's stack use grows past a limit, so
+// memory regressions show up here. -n sets the pixels
+// per stage, -v prints each stage's call sites.
+
+#include "pico/stdlib.h"
+#include "sim_clock.h"
+#include "sim_noise.h"
+#include "gpio_control.h"
+#include "dtft.h"
+#include "lut.h"
+#include "signal.h"
+#include "output.h"
+#include "width_table.h"
+#include "mem_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !MEM_STATS
+#error "mem_stats_check needs the pico_sim library built with MEM_STATS"
+#endif
+
+#define SOFT_OVERSAMPLE 4
+
+typedef enum {
+    STAGE_TABLES,
+    STAGE_FULL,
+    STAGE_ZOH,
+    STAGE_LAZY,
+    STAGE_SEEDED,
+    STAGE_SOFT,
+    STAGE_WIDTH,
+    STAGE_DUAL_CORE,
+    STAGE_PLOT,
+    STAGE_COUNT
+} stage_t;
+
+static const char *stage_names[STAGE_COUNT] = {
+    "matcher tables", "full matcher", "zoh matcher", "lazy matcher", "seeded matcher",
+    "soft matcher", "9-16 bit widths", "dual-core DTFT", "spectrum plot",
+};
+
+// Stages that keep what they allocate (tables built once)
+static bool stage_keeps_memory(stage_t stage) {
+    return stage == STAGE_TABLES;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-n PIXELS] [--max-peak BYTES] [--max-stack BYTES] [-v]\n"
+            "  -n           pixels per stage (default 256)\n"
+            "  --max-peak   fail if a stage's peak heap exceeds BYTES\n"
+            "  --max-stack  fail if a stage's Core0 or Core1 stack use exceeds BYTES\n"
+            "  -v           print each stage's allocation call sites\n",
+            prog);
+}
+
+/**
+ * Run one stage over num_pixels pixels
+ * @return Pixels decoded correctly (the table, DTFT and plot stages count every pixel)
+ */
+static uint32_t run_stage(stage_t stage, uint32_t num_pixels) {
+    uint32_t correct = 0;
+    switch (stage) {
+    case STAGE_TABLES:
+        init_matcher_tables();
+        return num_pixels;
+    case STAGE_SOFT:
+        for (uint32_t i = 0; i < num_pixels; i++) {
+            uint8_t value = (uint8_t)i;
+            uint8_t *counts = send_receive_data_soft(value, 8, SOFT_OVERSAMPLE);
+            if (!counts) break;
+            float confidence;
+            correct += process_pattern_soft_return_value(counts, SOFT_OVERSAMPLE, &confidence) == value;
+            MEM_FREE(counts);
+        }
+        return correct;
+    case STAGE_WIDTH:
+        for (uint32_t i = 0; i < num_pixels; i++) {
+            int width = WIDTH_TABLE_MIN_BITS + i % (WIDTH_TABLE_MAX_BITS - WIDTH_TABLE_MIN_BITS + 1);
+            uint16_t value = (uint16_t)((i * 2654435761u) >> (32 - width));
+            uint8_t *bits_recv = send_receive_data(value, (uint8_t)width, 1);
+            if (!bits_recv) break;
+            correct += process_pattern_width_return_value(bits_recv, 1) == value;
+            MEM_FREE(bits_recv);
+        }
+        width_table_clear();
+        return correct;
+    case STAGE_DUAL_CORE:
+        for (uint32_t i = 0; i < num_pixels; i++) {
+            uint8_t signal[80];
+            for (int n = 0; n < 80; n++) {
+                signal[n] = (i >> (7 - n % 8)) & 1;
+            }
+            float *spectrum = calculate_dtft_complex(signal, 80, 80);
+            correct += spectrum != NULL;
+            MEM_FREE(spectrum);
+        }
+        return correct;
+    case STAGE_PLOT: {
+        // Output goes to /dev/null; only the stack matters
+        fflush(stdout);
+        FILE *saved = stdout;
+        stdout = fopen("/dev/null", "w");
+        float magnitudes[41];
+        for (uint32_t i = 0; i < num_pixels && stdout; i++) {
+            for (int k = 0; k < 41; k++) {
+                magnitudes[k] = (float)((i + k * 7) % 41);
+            }
+            plot_dtft_spectrum(magnitudes, 41);
+            correct++;
+        }
+        if (stdout) fclose(stdout);
+        stdout = saved;
+        return correct;
+    }
+    default:
+        break;
+    }
+
+    for (uint32_t i = 0; i < num_pixels; i++) {
+        uint8_t value = (uint8_t)i;
+        uint8_t *bits_recv = send_receive_data(value, 8, 1);
+        if (!bits_recv) break;
+        uint8_t decoded = 0;
+        switch (stage) {
+        case STAGE_FULL:
+            decoded = process_pattern_return_value(bits_recv);
+            break;
+        case STAGE_ZOH:
+            decoded = process_pattern_zoh_return_value(bits_recv, 1);
+            break;
+        case STAGE_LAZY:
+            decoded = process_pattern_lazy_return_value(bits_recv, 1);
+            break;
+        default:
+            decoded = process_pattern_seeded_return_value(bits_recv, 1, (uint8_t)(value - 1));
+            break;
+        }
+        correct += decoded == value;
+        MEM_FREE(bits_recv);
+    }
+    return correct;
+}
+
+int main(int argc, char **argv) {
+    uint32_t num_pixels = 256;
+    long max_peak = -1;
+    long max_stack = -1;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+            num_pixels = (uint32_t)atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--max-peak") == 0) {
+            max_peak = atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--max-stack") == 0) {
+            max_stack = atol(argv[++i]);
+        } else if (strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (num_pixels == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    mem_stack_paint();
+    sim_clock_set_mode(SIM_CLOCK_VIRTUAL, 0.0);
+    init_core1_dtft();
+    init_trig_lut();
+    init_signal_gpio();
+    sim_noise_t noise;
+    sim_noise_init(&noise, 0.0f, 0.0f, 0.0f, 1);
+    sim_link_set_rx_model(sim_noise_rx_model, &noise);
+
+    int failures = 0;
+    printf("stage            pixels  correct  allocs/px  bytes/px  peak heap  left  core0 stack  core1 stack\n");
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        mem_stack_paint();
+        mem_stats_reset();
+        mem_heap_stats_t before;
+        mem_stats_get_heap(&before);
+
+        uint32_t correct = run_stage((stage_t)stage, num_pixels);
+
+        mem_heap_stats_t after;
+        mem_stack_stats_t stack[2];
+        mem_stats_get_heap(&after);
+        for (int core = 0; core < 2; core++) {
+            if (!mem_stack_get(core, &stack[core])) {
+                stack[core].used = 0;
+            }
+        }
+        const uint32_t peak = after.peak_bytes - before.live_bytes;
+        const int32_t left = (int32_t)(after.live_bytes - before.live_bytes);
+
+        const char *verdict = "";
+        if (left != 0 && !stage_keeps_memory((stage_t)stage)) {
+            verdict = "  LEAK";
+        } else if (max_peak >= 0 && peak > (uint32_t)max_peak) {
+            verdict = "  PEAK";
+        } else if (max_stack >= 0 &&
+                   (stack[0].used > (uint32_t)max_stack || stack[1].used > (uint32_t)max_stack)) {
+            verdict = "  STACK";
+        } else if (stage == STAGE_DUAL_CORE && stack[1].used == 0) {
+            verdict = "  NO CORE1 STACK";
+        } else if (after.failures) {
+            verdict = "  ALLOC FAILED";
+        } else if (correct != num_pixels) {
+            verdict = "  WRONG";
+        }
+        failures += verdict[0] != '\0';
+
+        printf("%-15s  %6lu  %7lu  %9.2f  %8.1f  %9lu  %4ld  %11lu  %11lu%s\n", stage_names[stage],
+               (unsigned long)num_pixels, (unsigned long)correct, (double)after.allocations / num_pixels,
+               (double)after.bytes_requested / num_pixels, (unsigned long)peak, (long)left,
+               (unsigned long)stack[0].used, (unsigned long)stack[1].used, verdict);
+        if (verbose) {
+            mem_stats_print();
+            printf("\n");
+        }
+    }
+
+    mem_heap_stats_t heap;
+    mem_stats_get_heap(&heap);
+    printf("Live at exit: %lu blocks, %lu bytes (matcher tables); allocator arena %lu bytes\n",
+           (unsigned long)heap.live_blocks, (unsigned long)heap.live_bytes, (unsigned long)heap.arena_bytes);
+    printf("%s\n", failures ? "FAILED" : "OK: every stage frees what it allocates and stays within the limits");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,103 @@
+// Checks that every pixel order (lib/pixel_order.c) visits each pixel of an
+// image exactly once, for square, non-square, odd and power-of-two sizes, and
+// reports iteration time. --dump prints one order as "x y" lines for
+// pixel_order.py --verify.
+
+#include "pixel_order.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int order_from_name(const char *name) {
+    for (int order = 0; order < PIXEL_ORDER_COUNT; order++) {
+        if (strcmp(name, pixel_order_name(order)) == 0) {
+            return order;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @return true if the order is a permutation of the image's pixels
+ */
+static bool check_order(int order, uint32_t width, uint32_t height, double *ns_per_pixel) {
+    const uint32_t num_pixels = width * height;
+    uint8_t *seen = calloc(num_pixels, 1);
+    if (!seen) {
+        return false;
+    }
+    pixel_order_iter_t iter;
+    if (!pixel_order_begin(&iter, order, width, height)) {
+        free(seen);
+        return false;
+    }
+
+    uint32_t visited = 0;
+    bool ok = true;
+    uint32_t x, y;
+    double start = now_s();
+    while (pixel_order_next(&iter, &x, &y)) {
+        if (x >= width || y >= height || seen[y * width + x]) {
+            ok = false;
+            break;
+        }
+        seen[y * width + x] = 1;
+        visited++;
+    }
+    *ns_per_pixel = (now_s() - start) * 1e9 / num_pixels;
+    free(seen);
+    return ok && visited == num_pixels;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 5 && strcmp(argv[1], "--dump") == 0) {
+        int order = order_from_name(argv[2]);
+        pixel_order_iter_t iter;
+        if (order < 0 || !pixel_order_begin(&iter, order, (uint32_t)atol(argv[3]), (uint32_t)atol(argv[4]))) {
+            fprintf(stderr, "usage: %s [--dump ORDER WIDTH HEIGHT]\n", argv[0]);
+            return 1;
+        }
+        uint32_t x, y;
+        while (pixel_order_next(&iter, &x, &y)) {
+            printf("%lu %lu\n", (unsigned long)x, (unsigned long)y);
+        }
+        return 0;
+    }
+    if (argc != 1) {
+        fprintf(stderr, "usage: %s [--dump ORDER WIDTH HEIGHT]\n", argv[0]);
+        return 1;
+    }
+
+    static const uint32_t sizes[][2] = {
+        {1, 1}, {1, 9}, {7, 3}, {8, 8}, {90, 90}, {100, 37}, {64, 200}, {1920, 1080},
+    };
+    const int num_sizes = sizeof(sizes) / sizeof(sizes[0]);
+    int failures = 0;
+
+    printf("%-8s", "order");
+    for (int s = 0; s < num_sizes; s++) {
+        char name[2 * 10 + 2];  // Two uint32_t sizes and the x
+        snprintf(name, sizeof(name), "%lux%lu", (unsigned long)sizes[s][0], (unsigned long)sizes[s][1]);
+        printf(" %9s", name);
+    }
+    printf(" %12s\n", "ns/px (HD)");
+    for (int order = 0; order < PIXEL_ORDER_COUNT; order++) {
+        printf("%-8s", pixel_order_name(order));
+        double ns_per_pixel = 0.0;
+        for (int s = 0; s < num_sizes; s++) {
+            bool ok = check_order(order, sizes[s][0], sizes[s][1], &ns_per_pixel);
+            printf(" %9s", ok ? "ok" : "FAIL");
+            failures += !ok;
+        }
+        printf(" %12.1f\n", ns_per_pixel);
+    }
+    printf("%s\n", failures ? "MISMATCH" : "OK: every order visits each pixel once");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,152 @@
+// Checks that decoding with set_decode_repetitions() gives the same decisions
+// as the table's own DTFT_N repetitions: every matcher on every 8-bit pattern
+// and sample divisor, the reduced depth matcher on every level, and the soft
+// matcher on random receiver counts (between table entries, where decisions
+// are closest). Counts exactly halfway between two entries (confidence 0) tie
+// to float rounding and are skipped. Reports the ZOH matcher's time per pixel
+// for each count.
+
+#include "signal.h"
+#include "dtft_table.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TIMING_ROUNDS 50
+#define SOFT_TRIALS 2000
+#define SOFT_OVERSAMPLE 8
+#define SOFT_TIE 1e-4f      // Reference confidence below which two entries tie
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Record as send_receive_data() builds it: [len, held bits...]
+static void hold_pattern(int value, int bits, int divisor, uint8_t *record) {
+    uint8_t held = 0;
+    record[0] = bits;
+    for (int n = 0; n < bits; n++) {
+        if (n % divisor == 0) {
+            held = (value >> (bits - 1 - n)) & 1;
+        }
+        record[1 + n] = held;
+    }
+}
+
+// Decisions of every matcher, in a fixed order
+#define NUM_DIVISORS 5
+#define NUM_DECISIONS (NUM_DIVISORS * 256 * 4 + 256 + DTFT_DEPTH_MAX_BITS * 128 + SOFT_TRIALS)
+
+// Soft trials whose reference decision is a tie
+static bool soft_tie[SOFT_TRIALS];
+
+static int decode_all(uint8_t *decisions, bool reference) {
+    static const int divisors[NUM_DIVISORS] = {1, 2, 3, 4, 8};
+    int n = 0;
+    uint8_t record[9];
+
+    for (int d = 0; d < NUM_DIVISORS; d++) {
+        uint8_t batch[SIGNAL_MAX_BATCH * 9];
+        for (int value = 0; value < 256; value++) {
+            hold_pattern(value, 8, divisors[d], record);
+            decisions[n++] = process_pattern_zoh_return_value(record, divisors[d]);
+            decisions[n++] = process_pattern_seeded_return_value(record, divisors[d], value ^ 0x5A);
+            decisions[n++] = process_pattern_lazy_return_value(record, divisors[d]);
+            hold_pattern(value, 8, divisors[d], &batch[(value % SIGNAL_MAX_BATCH) * 9]);
+            if (value % SIGNAL_MAX_BATCH == SIGNAL_MAX_BATCH - 1) {
+                process_patterns_batch(batch, SIGNAL_MAX_BATCH, divisors[d], &decisions[n]);
+                n += SIGNAL_MAX_BATCH;
+            }
+        }
+    }
+    for (int value = 0; value < 256; value++) {
+        hold_pattern(value, 8, 1, record);
+        decisions[n++] = process_pattern_return_value(record);
+    }
+    for (int bits = DTFT_DEPTH_MIN_BITS; bits <= DTFT_DEPTH_MAX_BITS; bits++) {
+        for (int level = 0; level < 128; level++) {
+            hold_pattern(level % (1 << bits), bits, 1, record);
+            decisions[n++] = process_pattern_depth_return_value(record, 1);
+        }
+    }
+    srand(1);
+    for (int trial = 0; trial < SOFT_TRIALS; trial++) {
+        uint8_t counts[9] = {8};
+        for (int i = 1; i <= 8; i++) {
+            counts[i] = rand() % (SOFT_OVERSAMPLE + 1);
+        }
+        float confidence;
+        decisions[n++] = process_pattern_soft_return_value(counts, SOFT_OVERSAMPLE, &confidence);
+        if (reference) {
+            soft_tie[trial] = confidence < SOFT_TIE;
+        }
+    }
+    return n;
+}
+
+int main(void) {
+    static const int repetitions[] = {1, 2, 3, 5, 20};
+    static uint8_t reference[NUM_DECISIONS];
+    static uint8_t decisions[NUM_DECISIONS];
+    int failures = 0;
+
+    init_matcher_tables();
+    if (!set_decode_repetitions(DTFT_N)) {
+        return 1;
+    }
+    const int num_decisions = decode_all(reference, true);
+    int ties = 0;
+    for (int trial = 0; trial < SOFT_TRIALS; trial++) {
+        ties += soft_tie[trial];
+    }
+    const int soft_start = num_decisions - SOFT_TRIALS;
+    printf("%d of %d soft trials tie and are skipped\n", ties, SOFT_TRIALS);
+
+    printf("repetitions  agree          zoh us/pixel\n");
+    for (unsigned r = 0; r <= sizeof(repetitions) / sizeof(repetitions[0]); r++) {
+        // Last row: the reference itself, for its timing
+        const int reps = r < sizeof(repetitions) / sizeof(repetitions[0]) ? repetitions[r] : DTFT_N;
+        if (!set_decode_repetitions(reps)) {
+            printf("%11d  rejected\n", reps);
+            failures++;
+            continue;
+        }
+        decode_all(decisions, false);
+        int agree = 0;
+        for (int i = 0; i < num_decisions; i++) {
+            if (i >= soft_start && soft_tie[i - soft_start]) continue;
+            agree += decisions[i] == reference[i];
+        }
+
+        uint8_t records[256][9];
+        for (int value = 0; value < 256; value++) {
+            hold_pattern(value, 8, 4, records[value]);
+        }
+        volatile unsigned sink = 0;
+        double t0 = now_s();
+        for (int round = 0; round < TIMING_ROUNDS; round++) {
+            for (int value = 0; value < 256; value++) {
+                sink += process_pattern_zoh_return_value(records[value], 4);
+            }
+        }
+        double t1 = now_s();
+        (void)sink;
+
+        printf("%11d  %5d/%d  %12.2f\n", reps, agree, num_decisions - ties,
+               (t1 - t0) * 1e6 / (TIMING_ROUNDS * 256));
+        if (agree != num_decisions - ties) {
+            failures++;
+        }
+    }
+
+    if (set_decode_repetitions(0)) {
+        printf("0 repetitions accepted\n");
+        failures++;
+    }
+
+    printf("%s\n", failures ? "MISMATCH" : "OK: decisions match the n10 path at every repetition count");
+    return failures ? 1 : 0;
+}
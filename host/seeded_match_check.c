@@ -0,0 +1,116 @@
+// Checks the seeded candidate search (process_pattern_seeded_return_value)
+// against the full 0-255 scan and reports the average number of candidates
+// evaluated per pixel on the image asset, for several seed predictors.
+
+#include "signal.h"
+#include "image_asset.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+enum { SEED_ZERO, SEED_LEFT, SEED_ABOVE, SEED_LEFT_OR_ABOVE, NUM_SEEDS };
+static const char *seed_names[NUM_SEEDS] = {"fixed (seed 0)", "previous pixel", "pixel above",
+                                            "previous, above at row start"};
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Record as send_receive_data() builds it at full rate: [len, bits...]
+static void bit_record(int value, uint8_t *record) {
+    record[0] = 8;
+    for (int n = 0; n < 8; n++) {
+        record[1 + n] = (value >> (7 - n)) & 1;
+    }
+}
+
+static uint8_t predict(int mode, const uint8_t *decoded, uint32_t i, uint32_t width) {
+    const uint32_t col = i % width;
+    switch (mode) {
+        case SEED_LEFT:
+            return i > 0 ? decoded[i - 1] : 0;
+        case SEED_ABOVE:
+            return i >= width ? decoded[i - width] : (col > 0 ? decoded[i - 1] : 0);
+        case SEED_LEFT_OR_ABOVE:
+            return col > 0 ? decoded[i - 1] : (i >= width ? decoded[i - width] : 0);
+        default:
+            return 0;
+    }
+}
+
+int main(void) {
+    int failures = 0;
+
+    // Every pattern from every seed
+    int agree = 0;
+    for (int value = 0; value < 256; value++) {
+        uint8_t record[9];
+        bit_record(value, record);
+        uint8_t expected = process_pattern_zoh_return_value(record, 1);
+        for (int seed = 0; seed < 256; seed++) {
+            agree += process_pattern_seeded_return_value(record, 1, (uint8_t)seed) == expected;
+        }
+    }
+    printf("All patterns x all seeds: %d/65536 agree with the full scan\n\n", agree);
+    if (agree != 65536) {
+        failures++;
+    }
+
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return 1;
+    }
+    const uint32_t width = reader.header.width;
+    const uint32_t num_pixels = width * reader.header.height;
+    uint8_t *source = malloc(num_pixels);
+    uint8_t *records = malloc(num_pixels * 9);
+    uint8_t *decoded = malloc(num_pixels);
+    if (!source || !records || !decoded || image_reader_read(&reader, source, num_pixels) != num_pixels) {
+        return 1;
+    }
+    for (uint32_t i = 0; i < num_pixels; i++) {
+        bit_record(source[i], &records[i * 9]);
+    }
+
+    // Full scan reference and timing
+    volatile unsigned sink = 0;
+    double t0 = now_s();
+    for (uint32_t i = 0; i < num_pixels; i++) {
+        sink += process_pattern_zoh_return_value(&records[i * 9], 1);
+    }
+    double full_us = (now_s() - t0) * 1e6 / num_pixels;
+    (void)sink;
+
+    printf("Image: %lux%lu\n", (unsigned long)width, (unsigned long)reader.header.height);
+    printf("%-30s %9s %14s %8s\n", "seed", "agree", "candidates/px", "us/px");
+    printf("%-30s %9s %14d %8.2f\n", "full scan 0-255", "-", 256, full_us);
+    for (int mode = 0; mode < NUM_SEEDS; mode++) {
+        seeded_match_reset_stats();
+        uint32_t correct = 0;
+        double start = now_s();
+        for (uint32_t i = 0; i < num_pixels; i++) {
+            decoded[i] = process_pattern_seeded_return_value(&records[i * 9], 1,
+                                                             predict(mode, decoded, i, width));
+            correct += decoded[i] == source[i];
+        }
+        double seeded_us = (now_s() - start) * 1e6 / num_pixels;
+        uint32_t pixels, candidates;
+        seeded_match_get_stats(&pixels, &candidates);
+
+        printf("%-30s %4lu/%lu %14.2f %8.2f\n", seed_names[mode], (unsigned long)correct,
+               (unsigned long)num_pixels, (double)candidates / pixels, seeded_us);
+        if (correct != num_pixels) {
+            failures++;
+        }
+    }
+
+    free(source);
+    free(records);
+    free(decoded);
+    printf("%s\n", failures ? "MISMATCH" : "OK: seeded search agrees with the full scan");
+    return failures ? 1 : 0;
+}
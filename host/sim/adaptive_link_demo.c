@@ -0,0 +1,205 @@
+// Adaptive bit period / sampling divisor in the firmware simulator.
+//
+// The simulated line is band-limited (sim_noise.c settle time): a receiver
+// read shortly after SIGNAL_GPIO changes may still see the old level, so short
+// bit periods cost accuracy. The image is sent with every fixed bit period of
+// the ladder at full sampling rate, then with the closed-loop controller
+// (lib/link_adapt.c). --degrade slows the line part way through every run to
+// show the controller backing off. Controller decisions go to the log file.
+//
+// Host decode is far faster than the RP2350, so -s stretches decode time by
+// the given factor; only then does a larger sampling divisor save time. Without
+// -s the controller stays at divisor 1, as it should: a coarser divisor costs
+// accuracy and saves nothing.
+//
+// Exits non-zero if the adaptive run misses the error target.
+
+#include "pico/stdlib.h"
+#include "sim_noise.h"
+#include "gpio_control.h"
+#include "signal.h"
+#include "link_adapt.h"
+#include "image_asset.h"
+#include "mem_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef struct {
+    sim_noise_t *noise;
+    float decode_scale;
+    uint32_t transfers;
+    uint32_t degrade_after;  // Transfers before the line slows down (0 = never)
+    float settle_us;
+    float degraded_settle_us;
+} demo_ctx_t;
+
+// Each run starts on the same line
+static void start_run(demo_ctx_t *demo, image_reader_t *reader) {
+    demo->transfers = 0;
+    sim_noise_set_settle(demo->noise, demo->settle_us);
+    image_reader_rewind(reader);
+}
+
+static uint8_t transfer_pixel(uint8_t value, int sample_divisor, void *ctx) {
+    demo_ctx_t *demo = ctx;
+    if (++demo->transfers == demo->degrade_after) {
+        sim_noise_set_settle(demo->noise, demo->degraded_settle_us);
+    }
+
+    uint8_t *bits_recv = send_receive_data(value, 8, (uint8_t)sample_divisor);
+    if (!bits_recv) {
+        return 0;
+    }
+    uint64_t decode_start = time_us_64();
+    uint8_t reconstructed = process_pattern_lazy_return_value(bits_recv, sample_divisor);
+    if (demo->decode_scale > 1.0f) {
+        sleep_us((uint64_t)((time_us_64() - decode_start) * (demo->decode_scale - 1.0f)));
+    }
+    MEM_FREE(bits_recv);
+    return reconstructed;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-n PIXELS] [-t TARGET] [-s DECODE_SCALE] [--settle US] [--degrade PIXEL US]\n"
+            "          [-o LOG]\n"
+            "  -n  pixels from the image asset (default 2700)\n"
+            "  -t  mean absolute probe error target in pixel levels (default 1)\n"
+            "  -s  stretch decode time by this factor to model a slower core (default 1)\n"
+            "  --settle   line time constant in us (default 3)\n"
+            "  --degrade  change the time constant after PIXEL transfers of each run\n"
+            "  -o  controller log (default adapt_log.txt)\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    uint32_t num_pixels = 2700;
+    float target = 1.0f;
+    demo_ctx_t demo = {.decode_scale = 1.0f, .settle_us = 3.0f};
+    const char *log_path = "adapt_log.txt";
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+            num_pixels = (uint32_t)atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-t") == 0) {
+            target = (float)atof(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-s") == 0) {
+            demo.decode_scale = (float)atof(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--settle") == 0) {
+            demo.settle_us = (float)atof(argv[++i]);
+        } else if (i + 2 < argc && strcmp(argv[i], "--degrade") == 0) {
+            demo.degrade_after = (uint32_t)atol(argv[++i]);
+            demo.degraded_settle_us = (float)atof(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-o") == 0) {
+            log_path = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (num_pixels < 1 || demo.decode_scale < 1.0f) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return 1;
+    }
+    uint32_t image_pixels = reader.header.width * reader.header.height;
+    if (num_pixels > image_pixels) {
+        num_pixels = image_pixels;
+    }
+    uint8_t *reconstructed = malloc(num_pixels);
+    if (!reconstructed) {
+        return 1;
+    }
+
+    init_signal_gpio();
+    sim_noise_t noise;
+    sim_noise_init(&noise, 0.0f, 0.0f, 0.0f, 1);
+    sim_link_set_rx_model(sim_noise_rx_model, &noise);
+    demo.noise = &noise;
+
+    const link_adapt_config_t config = {
+        .periods_us = {200, 100, 60, 40, 30, 20, 10, 0},
+        .num_periods = 8,
+        .divisors = {1, 2, 4, 8},
+        .num_divisors = 4,
+        .error_target = target,
+        .probes = 16,
+        .interval_rows = 3,
+    };
+
+    // Warm-up: builds the matcher tables outside the timed runs
+    start_run(&demo, &reader);
+    transfer_pixel(0, 1, &demo);
+
+    if (demo.degrade_after) {
+        printf("Line settle changes to %.1f us after %lu transfers\n",
+               demo.degraded_settle_us, (unsigned long)demo.degrade_after);
+    }
+    printf("Pixels: %lu (%lu per row), line settle: %.1f us, target: %.2f, decode scale: %.1fx\n\n",
+           (unsigned long)num_pixels, (unsigned long)reader.header.width, demo.settle_us, target,
+           demo.decode_scale);
+    printf("%-22s %9s %10s %9s %12s\n", "Setting", "Accuracy", "Mean err", "Time (s)", "Goodput/s");
+
+    // Fixed settings: every bit period at full sampling rate
+    for (int p = 0; p < config.num_periods; p++) {
+        start_run(&demo, &reader);
+        set_bit_period_us(config.periods_us[p]);
+        uint32_t correct = 0;
+        uint64_t abs_error = 0;
+        uint64_t start_us = time_us_64();
+        for (uint32_t i = 0; i < num_pixels; i++) {
+            uint8_t value;
+            image_reader_read(&reader, &value, 1);
+            uint8_t decoded = transfer_pixel(value, 1, &demo);
+            correct += decoded == value;
+            abs_error += abs((int)decoded - value);
+        }
+        float seconds = (time_us_64() - start_us) / 1000000.0f;
+        char name[32];
+        snprintf(name, sizeof(name), "Fixed %lu us, 1/1", (unsigned long)config.periods_us[p]);
+        printf("%-22s %8.2f%% %10.2f %9.2f %12.1f\n", name, 100.0f * correct / num_pixels,
+               (float)abs_error / num_pixels, seconds, correct / seconds);
+    }
+
+    // Adaptive run; controller log lines go to the log file
+    fflush(stdout);
+    int saved_stdout = dup(STDOUT_FILENO);
+    if (!freopen(log_path, "w", stdout)) {
+        perror(log_path);
+        return 1;
+    }
+    start_run(&demo, &reader);
+    link_adapt_t adapt;
+    if (!link_adapt_init(&adapt, &config)) {
+        return 1;
+    }
+    link_adapt_image_stats_t stats;
+    link_adapt_image(&adapt, &reader, num_pixels, transfer_pixel, &demo, reconstructed, &stats);
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+
+    float seconds = stats.time_us / 1000000.0f;
+    printf("%-22s %8.2f%% %10.2f %9.2f %12.1f\n", "Adaptive", 100.0f * stats.correct / stats.pixels,
+           (float)stats.abs_error / stats.pixels, seconds, stats.correct / seconds);
+    printf("\n");
+    link_adapt_print_stats(&adapt, &stats);
+    printf("Decisions logged to %s\n", log_path);
+    free(reconstructed);
+
+    float mean_error = (float)stats.abs_error / stats.pixels;
+    if (mean_error > target) {
+        printf("FAILED: adaptive mean abs error %.2f is over the target %.2f\n", mean_error, target);
+        return 1;
+    }
+    printf("OK: adaptive mean abs error %.2f is within the target %.2f\n", mean_error, target);
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Blocking vs cooperative transmit in the firmware simulator.
+//
+// Sends the image asset both ways (lib/coop_image.c): blocking decodes, formats
+// and drains the output after each transfer; cooperative runs that work as
+// protothreads in the transmitter's waits (lib/coop_sched.c). Both must decode
+// the same pixels and no cooperative edge may be late. Reports time, pixels/s,
+// Core0 utilization and how late the cooperative edges were.
+//
+// Runs on the virtual clock (sim_clock.h) with computation counted -c times
+// host speed (default 1; larger values model a slower core), or on the real
+// clock with --real. -p sets the bit period, -o writes both IMAGE_DATA blocks.
+
+#include "pico/stdlib.h"
+#include "sim_clock.h"
+#include "sim_noise.h"
+#include "gpio_control.h"
+#include "coop_image.h"
+#include "image_asset.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-n PIXELS] [-p PERIOD_US] [-d DIVISOR] [-c SCALE | --real] [-o FILE]\n"
+            "  -n  pixels from the image asset (default: whole image)\n"
+            "  -p  bit period in us (default 20)\n"
+            "  -d  receiver sampling divisor (default 1)\n"
+            "  -c  virtual clock: simulated us per host us of computation (default 1)\n"
+            "  --real  real clock and sleeps instead of the virtual clock\n"
+            "  -o  write the IMAGE_DATA output of both runs (default: formatted and discarded)\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    uint32_t num_pixels = 0;
+    uint32_t period_us = 20;
+    int divisor = 1;
+    double scale = 1.0;
+    bool real_clock = false;
+    const char *out_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+            num_pixels = (uint32_t)atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-p") == 0) {
+            period_us = (uint32_t)atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-d") == 0) {
+            divisor = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-c") == 0) {
+            scale = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--real") == 0) {
+            real_clock = true;
+        } else if (i + 1 < argc && strcmp(argv[i], "-o") == 0) {
+            out_path = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (divisor < 1 || divisor > 8 || scale < 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+    sim_clock_set_mode(real_clock ? SIM_CLOCK_REAL : SIM_CLOCK_VIRTUAL, scale);
+
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return 1;
+    }
+    const uint32_t image_pixels = reader.header.width * reader.header.height;
+    if (num_pixels == 0 || num_pixels > image_pixels) {
+        num_pixels = image_pixels;
+    }
+    uint8_t *reconstructed[2] = {malloc(num_pixels), malloc(num_pixels)};
+    if (!reconstructed[0] || !reconstructed[1]) {
+        return 1;
+    }
+    FILE *sink = NULL;
+    if (out_path && !(sink = fopen(out_path, "w"))) {
+        perror(out_path);
+        return 1;
+    }
+
+    init_signal_gpio();
+    sim_noise_t noise;
+    sim_noise_init(&noise, 0.0f, 0.0f, 0.0f, 1);
+    sim_link_set_rx_model(sim_noise_rx_model, &noise);
+    set_bit_period_us(period_us);
+
+    printf("Image: %lux%lu, %lu pixels, bit period %lu us, sampling 1/%d, %s clock",
+           (unsigned long)reader.header.width, (unsigned long)reader.header.height,
+           (unsigned long)num_pixels, (unsigned long)period_us, divisor, sim_clock_name(sim_clock_mode()));
+    if (!real_clock) {
+        printf(" (computation x%g)", scale);
+    }
+    printf("\n");
+
+    coop_image_stats_t stats[2];
+    for (int cooperative = 0; cooperative < 2; cooperative++) {
+        image_reader_rewind(&reader);
+        if (!coop_image_transfer(&reader, num_pixels, divisor, cooperative, sink,
+                                 reconstructed[cooperative], &stats[cooperative])) {
+            return 1;
+        }
+    }
+    coop_image_print_header();
+    coop_image_print_stats(&stats[0]);
+    coop_image_print_stats(&stats[1]);
+
+    bool same = memcmp(reconstructed[0], reconstructed[1], num_pixels) == 0;
+    printf("Speedup %.2fx; decoded pixels %s\n",
+           stats[1].time_us > 0 ? (double)stats[0].time_us / stats[1].time_us : 0.0,
+           same ? "identical" : "DIFFER");
+
+    if (stats[1].late_edges > 0) {
+        printf("FAILED: %lu late edges (max %lu us)\n", (unsigned long)stats[1].late_edges,
+               (unsigned long)stats[1].max_late_us);
+    }
+
+    if (sink) {
+        fclose(sink);
+    }
+    free(reconstructed[0]);
+    free(reconstructed[1]);
+    return same && stats[1].late_edges == 0 ? 0 : 1;
+}
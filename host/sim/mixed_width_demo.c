@@ -0,0 +1,176 @@
+// Mixed pattern widths in the firmware simulator.
+//
+// Every value of every width from 1 to 16 bits (a random sample of the widths
+// above 12) is first sent over a clean link and must decode exactly with
+// process_pattern_width_return_value(). A stream of random widths and values
+// then runs through the link; the 9-16 bit tables are generated on first use
+// into the RAM cache (lib/width_table.c) and evicted least recently used once
+// the budget is exceeded. Reports errors and decode time per width and the
+// cache's hits, misses, evictions and peak RAM.
+//
+// Runs on the virtual clock. -n sets the stream length, -d the receiver
+// divisor, -b the cache budget in bytes, -f the per-read flip probability.
+
+#include "pico/stdlib.h"
+#include "sim_clock.h"
+#include "sim_noise.h"
+#include "gpio_control.h"
+#include "signal.h"
+#include "width_table.h"
+#include "mem_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MIN_WIDTH 1
+#define MAX_WIDTH 16
+#define EXHAUSTIVE_MAX_WIDTH 12
+#define SAMPLED_VALUES 4096
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-n TRANSFERS] [-d DIVISOR] [-b BUDGET] [-f FLIP]\n"
+            "  -n  transfers in the mixed-width stream (default 20000)\n"
+            "  -d  receiver sampling divisor (default 1)\n"
+            "  -b  width table cache budget in bytes (default %d)\n"
+            "  -f  per-read flip probability of the link in the stream (default 0)\n",
+            prog, WIDTH_TABLE_DEFAULT_BUDGET);
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Value the receiver sees: each sampled bit held until the next sample
+static uint16_t held_value(uint16_t value, int width, int divisor) {
+    uint16_t held = 0;
+    int bit = 0;
+    for (int n = 0; n < width; n++) {
+        if (n % divisor == 0) {
+            bit = (value >> (width - 1 - n)) & 1;
+        }
+        held = (uint16_t)(held << 1) | bit;
+    }
+    return held;
+}
+
+/**
+ * Send one value and decode it
+ * @param decode_s Output: time spent decoding (host clock)
+ * @return false on transfer failure
+ */
+static bool transfer(uint16_t value, int width, int divisor, uint16_t *decoded, double *decode_s) {
+    uint8_t *bits_recv = send_receive_data(value, (uint8_t)width, (uint8_t)divisor);
+    if (!bits_recv) {
+        return false;
+    }
+    double t0 = now_s();
+    *decoded = process_pattern_width_return_value(bits_recv, divisor);
+    *decode_s = now_s() - t0;
+    MEM_FREE(bits_recv);
+    return true;
+}
+
+static void print_cache_stats(void) {
+    width_table_stats_t stats;
+    width_table_get_stats(&stats);
+    printf("Width table cache: budget %zu bytes, %lu hits, %lu misses, %lu evictions, "
+           "%zu bytes held, peak %zu\n", width_table_budget(), (unsigned long)stats.hits,
+           (unsigned long)stats.misses, (unsigned long)stats.evictions, stats.bytes, stats.peak_bytes);
+}
+
+int main(int argc, char **argv) {
+    uint32_t num_transfers = 20000;
+    int divisor = 1;
+    size_t budget = WIDTH_TABLE_DEFAULT_BUDGET;
+    float flip = 0.0f;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+            num_transfers = (uint32_t)atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-d") == 0) {
+            divisor = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-b") == 0) {
+            budget = (size_t)atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-f") == 0) {
+            flip = (float)atof(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (divisor < 1 || divisor > 8) {
+        usage(argv[0]);
+        return 1;
+    }
+    sim_clock_set_mode(SIM_CLOCK_VIRTUAL, 0.0);
+
+    init_signal_gpio();
+    sim_noise_t noise;
+    sim_noise_init(&noise, 0.0f, 0.0f, 0.0f, 1);
+    sim_link_set_rx_model(sim_noise_rx_model, &noise);
+    width_table_set_budget(budget);
+    srand(1);
+
+    // Clean link: every value comes back as the receiver sampled it
+    int failures = 0;
+    printf("width  values  exact   decode us\n");
+    for (int width = MIN_WIDTH; width <= MAX_WIDTH; width++) {
+        const uint32_t num_values = width <= EXHAUSTIVE_MAX_WIDTH ? 1u << width : SAMPLED_VALUES;
+        uint32_t exact = 0;
+        double decode_s = 0.0;
+        for (uint32_t i = 0; i < num_values; i++) {
+            uint16_t value = width <= EXHAUSTIVE_MAX_WIDTH ? (uint16_t)i
+                                                            : (uint16_t)(rand() & ((1u << width) - 1));
+            uint16_t decoded;
+            double t;
+            if (!transfer(value, width, divisor, &decoded, &t)) {
+                return 1;
+            }
+            decode_s += t;
+            exact += decoded == held_value(value, width, divisor);
+        }
+        printf("%5d  %6lu  %5s  %10.2f\n", width, (unsigned long)num_values,
+               exact == num_values ? "yes" : "NO", decode_s * 1e6 / num_values);
+        failures += exact != num_values;
+    }
+    print_cache_stats();
+
+    // Mixed stream: widths in random order
+    width_table_reset_stats();
+    sim_noise_init(&noise, flip, 0.0f, 0.0f, 1);
+    uint32_t sent[MAX_WIDTH + 1] = {0};
+    uint32_t errors[MAX_WIDTH + 1] = {0};
+    double decode_s[MAX_WIDTH + 1] = {0.0};
+    for (uint32_t i = 0; i < num_transfers; i++) {
+        int width = MIN_WIDTH + rand() % (MAX_WIDTH - MIN_WIDTH + 1);
+        uint16_t value = (uint16_t)(rand() & ((1u << width) - 1));
+        uint16_t decoded;
+        double t;
+        if (!transfer(value, width, divisor, &decoded, &t)) {
+            return 1;
+        }
+        sent[width]++;
+        errors[width] += decoded != held_value(value, width, divisor);
+        decode_s[width] += t;
+    }
+
+    printf("\nMixed stream: %lu transfers, sampling 1/%d, flip %.3f\n", (unsigned long)num_transfers,
+           divisor, flip);
+    printf("width  sent   errors  decode us\n");
+    for (int width = MIN_WIDTH; width <= MAX_WIDTH; width++) {
+        printf("%5d  %5lu  %6lu  %9.2f\n", width, (unsigned long)sent[width],
+               (unsigned long)errors[width], sent[width] ? decode_s[width] * 1e6 / sent[width] : 0.0);
+        if (flip == 0.0f && errors[width]) {
+            failures++;
+        }
+    }
+    print_cache_stats();
+
+    width_table_clear();
+    printf("%s\n", failures ? "MISMATCH" : "OK: every width decodes exactly on a clean link");
+    return failures ? 1 : 0;
+}
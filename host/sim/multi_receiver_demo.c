@@ -0,0 +1,139 @@
+// Multi-receiver throughput in the firmware simulator.
+//
+// Every receiver channel is an independent link carrying its own pixel stream
+// from the image asset; all channels are clocked by CLOCK_GPIO, sampled
+// together and decoded as one batch (lib/receiver.c). For K = 1..max the
+// pixel rate is measured end to end, with link timing from gpio_control.c.
+//
+// Host decode is far faster than the RP2350, so -s stretches every batch
+// decode by the given factor to show where compute saturates.
+
+#include "pico/stdlib.h"
+#include "sim_link.h"
+#include "receiver.h"
+#include "image_asset.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    uint8_t values[MAX_RECEIVERS];  // Pattern each channel carries this transfer
+} link_patterns_t;
+
+static bool independent_links(unsigned int gpio, const sim_link_state_t *link, void *ctx) {
+    const link_patterns_t *patterns = ctx;
+    if (!link->tx_active || link->bit_index < 0 || link->bit_index > 7) {
+        return false;
+    }
+    for (int c = 0; c < MAX_RECEIVERS; c++) {
+        if (receiver_gpios[c] == gpio) {
+            return (patterns->values[c] >> (7 - link->bit_index)) & 1;
+        }
+    }
+    return false;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-c MAX_CHANNELS] [-n TRANSFERS] [-d DIVISOR] [-s DECODE_SCALE]\n"
+            "  -c  largest receiver count to measure (1-%d, default %d)\n"
+            "  -n  transfers per receiver count (default 200)\n"
+            "  -d  sampling rate divisor (default 1)\n"
+            "  -s  stretch batch decode time by this factor to model a slower core (default 1)\n",
+            prog, MAX_RECEIVERS, MAX_RECEIVERS);
+}
+
+int main(int argc, char **argv) {
+    int max_channels = MAX_RECEIVERS;
+    int transfers = 200;
+    int divisor = 1;
+    float decode_scale = 1.0f;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-c") == 0) {
+            max_channels = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+            transfers = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-d") == 0) {
+            divisor = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-s") == 0) {
+            decode_scale = (float)atof(argv[++i]);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (max_channels < 1 || max_channels > MAX_RECEIVERS || transfers < 1 || divisor < 1 ||
+        decode_scale < 1.0f) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return 1;
+    }
+
+    init_signal_gpio();
+    link_patterns_t patterns;
+    memset(&patterns, 0, sizeof(patterns));
+    sim_link_set_rx_model(independent_links, &patterns);
+
+    // Warm-up transfer: builds the matcher's magnitude classes outside the timed runs
+    receiver_set_t warmup;
+    if (!receiver_set_init(&warmup, 1, (uint8_t)divisor) ||
+        !receiver_set_transfer(&warmup, 0, 8, NULL, NULL)) {
+        return 1;
+    }
+
+    printf("Transfers per run: %d, divisor: %d, decode scale: %.1fx\n\n", transfers, divisor, decode_scale);
+    printf("  K   pixels/s  speedup  link us/xfer  decode us/xfer  decode share  errors\n");
+
+    double base_rate = 0.0;
+    for (int k = 1; k <= max_channels; k++) {
+        receiver_set_t receivers;
+        if (!receiver_set_init(&receivers, k, (uint8_t)divisor)) {
+            return 1;
+        }
+
+        uint64_t start_us = time_us_64();
+        for (int t = 0; t < transfers; t++) {
+            for (int c = 0; c < k; c++) {
+                if (image_reader_read(&reader, &patterns.values[c], 1) == 0) {
+                    image_reader_rewind(&reader);
+                    image_reader_read(&reader, &patterns.values[c], 1);
+                }
+            }
+
+            uint64_t decode_before = receivers.decode_time_us;
+            if (!receiver_set_transfer(&receivers, patterns.values[0], 8, patterns.values, NULL)) {
+                return 1;
+            }
+            if (decode_scale > 1.0f) {
+                uint64_t decode_us = receivers.decode_time_us - decode_before;
+                uint64_t extra_us = (uint64_t)(decode_us * (decode_scale - 1.0f));
+                sleep_us(extra_us);
+                receivers.decode_time_us += extra_us;
+            }
+        }
+        uint64_t elapsed_us = time_us_64() - start_us;
+
+        uint32_t errors = 0;
+        for (int c = 0; c < k; c++) {
+            errors += receivers.channels[c].mismatches;
+        }
+        double rate = (double)transfers * k * 1e6 / elapsed_us;
+        if (k == 1) {
+            base_rate = rate;
+        }
+        double decode_per_transfer = (double)receivers.decode_time_us / transfers;
+        double link_per_transfer = (double)elapsed_us / transfers - decode_per_transfer;
+        printf("%3d %10.0f %7.2fx %13.1f %15.1f %12.0f%% %7u\n",
+               k, rate, rate / base_rate, link_per_transfer, decode_per_transfer,
+               100.0 * decode_per_transfer / ((double)elapsed_us / transfers), errors);
+    }
+
+    return 0;
+}
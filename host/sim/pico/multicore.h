@@ -0,0 +1,20 @@
+#ifndef SIM_PICO_MULTICORE_H
+#define SIM_PICO_MULTICORE_H
+
+// Core1 runs as a host thread
+
+#include "pico/stdlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void multicore_launch_core1(void (*entry)(void));
+void multicore_reset_core1(void);
+unsigned int get_core_num(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_PICO_MULTICORE_H
@@ -0,0 +1,41 @@
+#ifndef SIM_PICO_STDLIB_H
+#define SIM_PICO_STDLIB_H
+
+// Host implementation of the pico SDK calls used by lib/ (see pico_sim.c).
+// GPIO inputs are driven by the link model in sim_link.h.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <assert.h>
+#include "pico/time.h"
+
+#define PICO_OK 0
+#define PICO_DEFAULT_LED_PIN 25
+
+#define GPIO_OUT 1
+#define GPIO_IN 0
+
+#define hard_assert(x) assert(x)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void gpio_init(unsigned int gpio);
+void gpio_set_dir(unsigned int gpio, bool out);
+void gpio_pull_down(unsigned int gpio);
+void gpio_put(unsigned int gpio, bool value);
+bool gpio_get(unsigned int gpio);
+uint32_t gpio_get_all(void);
+
+bool stdio_init_all(void);
+
+static inline void tight_loop_contents(void) {}
+static inline void __dmb(void) { __sync_synchronize(); }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_PICO_STDLIB_H
@@ -0,0 +1,33 @@
+#ifndef SIM_PICO_TIME_H
+#define SIM_PICO_TIME_H
+
+// Microsecond time of the simulator clock (sim_clock.h): host time since the
+// first read with blocking sleeps, or a virtual clock that sleeps advance
+
+#include <stdint.h>
+
+typedef uint64_t absolute_time_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint64_t time_us_64(void);
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+
+static inline uint32_t time_us_32(void) { return (uint32_t)time_us_64(); }
+static inline absolute_time_t get_absolute_time(void) { return time_us_64(); }
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) {
+    return (int64_t)(to - from);
+}
+static inline absolute_time_t make_timeout_time_us(uint64_t us) { return time_us_64() + us; }
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms) { return time_us_64() + ms * 1000ull; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_PICO_TIME_H
@@ -0,0 +1,285 @@
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "sim_link.h"
+#include "sim_clock.h"
+#include "gpio_control.h"
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_NUM_GPIOS 32
+
+static bool gpio_output[SIM_NUM_GPIOS];
+static bool gpio_level[SIM_NUM_GPIOS];
+static sim_link_state_t link_state = {.bit_index = -1};
+static sim_rx_model_t rx_model = NULL;
+static void *rx_model_ctx = NULL;
+
+// ---- Link model ----
+
+void sim_link_set_rx_model(sim_rx_model_t model, void *ctx) {
+    rx_model = model;
+    rx_model_ctx = ctx;
+}
+
+void sim_link_get_state(sim_link_state_t *state) {
+    *state = link_state;
+}
+
+static bool read_input(unsigned int gpio) {
+    if (rx_model) {
+        return rx_model(gpio, &link_state, rx_model_ctx);
+    }
+    return link_state.tx_level;
+}
+
+// ---- GPIO ----
+
+void gpio_init(unsigned int gpio) {
+    if (gpio >= SIM_NUM_GPIOS) return;
+    gpio_output[gpio] = false;
+    gpio_level[gpio] = false;
+}
+
+void gpio_set_dir(unsigned int gpio, bool out) {
+    if (gpio >= SIM_NUM_GPIOS) return;
+    gpio_output[gpio] = out;
+}
+
+void gpio_pull_down(unsigned int gpio) {
+    (void)gpio;
+}
+
+void gpio_put(unsigned int gpio, bool value) {
+    if (gpio >= SIM_NUM_GPIOS) return;
+    bool rising = value && !gpio_level[gpio];
+    gpio_level[gpio] = value;
+
+    if (gpio == SIGNAL_GPIO) {
+        if (value != link_state.tx_level) {
+            link_state.tx_prev_level = link_state.tx_level;
+            link_state.tx_change_us = time_us_64();
+        }
+        link_state.tx_level = value;
+    } else if (gpio == TX_ACTIVE_GPIO) {
+        link_state.tx_active = value;
+        if (rising) {
+            link_state.bit_index = -1;
+            link_state.transfer++;
+        }
+    } else if (gpio == CLOCK_GPIO && rising && link_state.tx_active) {
+        link_state.bit_index++;
+    }
+}
+
+bool gpio_get(unsigned int gpio) {
+    if (gpio >= SIM_NUM_GPIOS) return false;
+    return gpio_output[gpio] ? gpio_level[gpio] : read_input(gpio);
+}
+
+uint32_t gpio_get_all(void) {
+    uint32_t levels = 0;
+    for (unsigned int gpio = 0; gpio < SIM_NUM_GPIOS; gpio++) {
+        if (gpio_get(gpio)) {
+            levels |= 1u << gpio;
+        }
+    }
+    return levels;
+}
+
+bool stdio_init_all(void) {
+    return true;
+}
+
+// ---- Time ----
+
+static pthread_mutex_t clock_lock = PTHREAD_MUTEX_INITIALIZER;
+static bool clock_ready = false;
+static sim_clock_mode_t clock_mode = SIM_CLOCK_REAL;
+static double compute_scale = 0.0;
+static uint64_t boot_us = 0;         // Host time of the first read
+static uint64_t virtual_us = 0;      // Simulated time (virtual clock)
+static uint64_t host_last_us = 0;    // Host time of the last clock event (virtual clock)
+static double compute_carry_us = 0.0;
+static uint64_t slept_us = 0;
+
+static uint64_t monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ull + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+/**
+ * Choose the clock from the environment on first use (clock_lock held)
+ */
+static void clock_resolve(void) {
+    if (clock_ready) return;
+    const char *mode = getenv("PICO_SIM_CLOCK");
+    if (mode && strcmp(mode, "virtual") == 0) {
+        clock_mode = SIM_CLOCK_VIRTUAL;
+        const char *scale = getenv("PICO_SIM_COMPUTE_SCALE");
+        compute_scale = scale ? atof(scale) : 0.0;
+    } else if (mode && strcmp(mode, "real") != 0) {
+        fprintf(stderr, "Warning: unknown PICO_SIM_CLOCK '%s', using the real clock\n", mode);
+    }
+    boot_us = host_last_us = monotonic_us();
+    clock_ready = true;
+}
+
+// Host time a thread was not running (preempted by another process) is not
+// computation. Gaps between clock events longer than CLOCK_STALL_US are checked
+// against the thread's CPU time, which is too slow to read on every event; the
+// reference point is renewed at least every CLOCK_CPU_MARK_US.
+#define CLOCK_STALL_US 20
+#define CLOCK_CPU_MARK_US 1000
+
+static __thread uint64_t cpu_mark_us = 0;        // Thread CPU time at the reference point
+static __thread uint64_t cpu_mark_host_us = 0;   // Host time at the reference point
+
+static uint64_t thread_cpu_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ull + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+/**
+ * Host time since the last event less the time this thread did not run
+ */
+static uint64_t computed_since(uint64_t last_us, uint64_t now) {
+    uint64_t computed = now - last_us;
+    if (cpu_mark_host_us == 0 || computed > CLOCK_STALL_US ||
+        now - cpu_mark_host_us >= CLOCK_CPU_MARK_US) {
+        uint64_t cpu = thread_cpu_us();
+        if (cpu_mark_host_us != 0 && computed > CLOCK_STALL_US) {
+            uint64_t ran = cpu - cpu_mark_us;
+            uint64_t stalled = now - cpu_mark_host_us > ran ? now - cpu_mark_host_us - ran : 0;
+            computed -= stalled < computed ? stalled : computed;
+        }
+        cpu_mark_us = cpu;
+        cpu_mark_host_us = now;
+    }
+    return computed;
+}
+
+/**
+ * Virtual clock: add the scaled host time since the last event (clock_lock held)
+ */
+static void clock_charge_compute(void) {
+    uint64_t now = monotonic_us();
+    if (compute_scale > 0.0) {
+        compute_carry_us += computed_since(host_last_us, now) * compute_scale;
+        uint64_t whole = (uint64_t)compute_carry_us;
+        virtual_us += whole;
+        compute_carry_us -= whole;
+    }
+    host_last_us = now;
+}
+
+bool sim_clock_set_mode(sim_clock_mode_t mode, double scale) {
+    pthread_mutex_lock(&clock_lock);
+    bool ok = !clock_ready;
+    if (ok) {
+        clock_mode = mode;
+        compute_scale = scale;
+        boot_us = host_last_us = monotonic_us();
+        clock_ready = true;
+    }
+    pthread_mutex_unlock(&clock_lock);
+    return ok;
+}
+
+sim_clock_mode_t sim_clock_mode(void) {
+    pthread_mutex_lock(&clock_lock);
+    clock_resolve();
+    sim_clock_mode_t mode = clock_mode;
+    pthread_mutex_unlock(&clock_lock);
+    return mode;
+}
+
+uint64_t sim_clock_slept_us(void) {
+    pthread_mutex_lock(&clock_lock);
+    uint64_t us = slept_us;
+    pthread_mutex_unlock(&clock_lock);
+    return us;
+}
+
+const char *sim_clock_name(sim_clock_mode_t mode) {
+    return mode == SIM_CLOCK_VIRTUAL ? "virtual" : "real";
+}
+
+uint64_t time_us_64(void) {
+    pthread_mutex_lock(&clock_lock);
+    clock_resolve();
+    uint64_t now;
+    if (clock_mode == SIM_CLOCK_VIRTUAL) {
+        clock_charge_compute();
+        now = virtual_us;
+    } else {
+        now = monotonic_us() - boot_us;
+    }
+    pthread_mutex_unlock(&clock_lock);
+    return now;
+}
+
+void sleep_us(uint64_t us) {
+    if (!us) return;
+    pthread_mutex_lock(&clock_lock);
+    clock_resolve();
+    slept_us += us;
+    if (clock_mode == SIM_CLOCK_VIRTUAL) {
+        // Wake-up is the next event: jump to it
+        clock_charge_compute();
+        virtual_us += us;
+        pthread_mutex_unlock(&clock_lock);
+        return;
+    }
+    pthread_mutex_unlock(&clock_lock);
+
+    // Short sleeps spin like the SDK does; nanosleep would overshoot by tens of us
+    if (us < 100) {
+        uint64_t end = time_us_64() + us;
+        while (time_us_64() < end) {
+        }
+        return;
+    }
+    struct timespec ts = {
+        .tv_sec = (time_t)(us / 1000000u),
+        .tv_nsec = (long)(us % 1000000u) * 1000,
+    };
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR) {
+    }
+}
+
+void sleep_ms(uint32_t ms) {
+    sleep_us((uint64_t)ms * 1000u);
+}
+
+// ---- Multicore ----
+
+static pthread_t core1_thread;
+static bool core1_running = false;
+static __thread unsigned int core_num = 0;
+
+static void *core1_main(void *arg) {
+    core_num = 1;
+    ((void (*)(void))arg)();
+    return NULL;
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+    if (core1_running) return;
+    core1_running = pthread_create(&core1_thread, NULL, core1_main, (void *)entry) == 0;
+    if (core1_running) {
+        pthread_detach(core1_thread);
+    }
+}
+
+void multicore_reset_core1(void) {
+    // Core1 workers loop forever; the thread is abandoned at process exit
+}
+
+unsigned int get_core_num(void) {
+    return core_num;
+}
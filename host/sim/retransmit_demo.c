@@ -0,0 +1,238 @@
+// Selective retransmission in the firmware simulator.
+//
+// Sends the first pixels of the image asset over a noisy simulated link
+// (sim_noise.c: random read errors plus bursts that corrupt whole bit periods)
+// and compares, on the same channel:
+//   - a single soft-decoded pass
+//   - blanket redundancy: every pixel sent R times, receiver counts combined
+//   - confidence-gated retransmission (lib/retransmit.c) at several thresholds
+// reporting accuracy, transfers per pixel and goodput (correct pixels/s), then
+// the transfers per pixel gating needs to reach each blanket scheme's accuracy
+// (the lowest threshold, in steps of THRESHOLD_STEP, that does).
+
+#include "pico/stdlib.h"
+#include "sim_noise.h"
+#include "gpio_control.h"
+#include "signal.h"
+#include "retransmit.h"
+#include "image_asset.h"
+#include "mem_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_RETRIES 3
+#define THRESHOLD_STEP 0.05f
+#define THRESHOLD_MAX 2.0f
+
+typedef struct {
+    uint32_t pixels;
+    uint32_t correct;
+    uint32_t transfers;
+    int64_t time_us;
+} run_result_t;
+
+static uint32_t count_correct(image_reader_t *reader, const uint8_t *reconstructed, uint32_t num_pixels) {
+    image_reader_rewind(reader);
+    uint32_t correct = 0;
+    for (uint32_t i = 0; i < num_pixels; i++) {
+        uint8_t value;
+        image_reader_read(reader, &value, 1);
+        correct += value == reconstructed[i];
+    }
+    return correct;
+}
+
+// Every pixel sent `copies` times back to back, counts summed before decoding
+static bool run_blanket(image_reader_t *reader, uint32_t num_pixels, int copies, int oversample,
+                        uint8_t *reconstructed, run_result_t *result) {
+    image_reader_rewind(reader);
+    absolute_time_t start_time = get_absolute_time();
+    memset(result, 0, sizeof(*result));
+
+    for (uint32_t i = 0; i < num_pixels; i++) {
+        uint8_t value;
+        if (image_reader_read(reader, &value, 1) != 1) {
+            return false;
+        }
+        uint8_t counts[9] = {8};
+        for (int c = 0; c < copies; c++) {
+            uint8_t *received = send_receive_data_soft(value, 8, oversample);
+            if (!received) {
+                return false;
+            }
+            for (int b = 1; b <= 8; b++) {
+                counts[b] += received[b];
+            }
+            MEM_FREE(received);
+            result->transfers++;
+        }
+        float confidence;
+        reconstructed[i] = process_pattern_soft_return_value(counts, oversample * copies, &confidence);
+    }
+
+    result->time_us = absolute_time_diff_us(start_time, get_absolute_time());
+    result->pixels = num_pixels;
+    result->correct = count_correct(reader, reconstructed, num_pixels);
+    return true;
+}
+
+static bool run_selective(image_reader_t *reader, uint32_t num_pixels, const retransmit_config_t *config,
+                          uint8_t *reconstructed, run_result_t *result) {
+    image_reader_rewind(reader);
+    retransmit_stats_t stats;
+    if (!retransmit_image(reader, num_pixels, config, reconstructed, &stats)) {
+        return false;
+    }
+    result->pixels = stats.pixels;
+    result->transfers = stats.transfers;
+    result->time_us = stats.time_us;
+    result->correct = count_correct(reader, reconstructed, stats.pixels);
+    return true;
+}
+
+static void print_result(const char *name, const run_result_t *result) {
+    float seconds = result->time_us / 1000000.0f;
+    printf("%-28s %8.2f%% %10.3f %9.2f %12.1f\n", name,
+           100.0f * result->correct / result->pixels,
+           (float)result->transfers / result->pixels, seconds,
+           seconds > 0 ? result->correct / seconds : 0.0f);
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-n PIXELS] [-r OVERSAMPLE] [-f FLIP] [-b BURST] [-B BURST_FLIP] [--seed N]\n"
+            "  -n  pixels from the image asset (default 2000)\n"
+            "  -r  receiver reads per bit (default 8)\n"
+            "  -f  per-read flip probability outside bursts (default 0.15)\n"
+            "  -b  probability that a bit period is a burst (default 0.02)\n"
+            "  -B  per-read flip probability inside a burst (default 0.6)\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    uint32_t num_pixels = 2000;
+    int oversample = 8;
+    float flip = 0.15f;
+    float burst = 0.02f;
+    float burst_flip = 0.6f;
+    uint64_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+            num_pixels = (uint32_t)atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-r") == 0) {
+            oversample = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-f") == 0) {
+            flip = (float)atof(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-b") == 0) {
+            burst = (float)atof(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-B") == 0) {
+            burst_flip = (float)atof(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--seed") == 0) {
+            seed = strtoull(argv[++i], NULL, 0);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (num_pixels < 1 || oversample < 1 || oversample > 63) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return 1;
+    }
+    uint32_t image_pixels = reader.header.width * reader.header.height;
+    if (num_pixels > image_pixels) {
+        num_pixels = image_pixels;
+    }
+    uint8_t *reconstructed = malloc(num_pixels);
+    if (!reconstructed) {
+        return 1;
+    }
+
+    init_signal_gpio();
+    sim_noise_t noise;
+    sim_link_set_rx_model(sim_noise_rx_model, &noise);
+
+    printf("Pixels: %lu, oversample: %d, flip: %.3f, burst: %.3f (flip %.2f)\n\n",
+           (unsigned long)num_pixels, oversample, flip, burst, burst_flip);
+    printf("%-28s %9s %10s %9s %12s\n", "Scheme", "Accuracy", "Tx/pixel", "Time (s)", "Goodput/s");
+
+    // Same noise realization for every scheme
+    run_result_t result;
+    char name[64];
+
+    sim_noise_init(&noise, flip, burst, burst_flip, seed);
+    retransmit_config_t single = {.threshold = 0.0f, .max_retries = 0, .oversample = oversample};
+    if (!run_selective(&reader, num_pixels, &single, reconstructed, &result)) {
+        return 1;
+    }
+    print_result("Single pass", &result);
+
+    for (int copies = 2; copies <= 3; copies++) {
+        sim_noise_init(&noise, flip, burst, burst_flip, seed);
+        if (!run_blanket(&reader, num_pixels, copies, oversample, reconstructed, &result)) {
+            return 1;
+        }
+        snprintf(name, sizeof(name), "Blanket x%d", copies);
+        print_result(name, &result);
+    }
+
+    static const float thresholds[] = {0.2f, 0.4f, 0.6f, 0.8f, 1.0f};
+    for (size_t t = 0; t < sizeof(thresholds) / sizeof(thresholds[0]); t++) {
+        sim_noise_init(&noise, flip, burst, burst_flip, seed);
+        retransmit_config_t config = {.threshold = thresholds[t], .max_retries = MAX_RETRIES,
+                                      .oversample = oversample};
+        if (!run_selective(&reader, num_pixels, &config, reconstructed, &result)) {
+            return 1;
+        }
+        snprintf(name, sizeof(name), "Selective < %.1f, %d retries", thresholds[t], MAX_RETRIES);
+        print_result(name, &result);
+    }
+
+    // Same accuracy as blanket redundancy: the lowest threshold that reaches it
+    printf("\n%-12s %9s %9s %10s %10s %8s\n", "Target", "Accuracy", "Threshold", "Selective",
+           "Blanket", "Saving");
+    float threshold = THRESHOLD_STEP;
+    for (int copies = 2; copies <= 3; copies++) {
+        run_result_t blanket;
+        sim_noise_init(&noise, flip, burst, burst_flip, seed);
+        if (!run_blanket(&reader, num_pixels, copies, oversample, reconstructed, &blanket)) {
+            return 1;
+        }
+        snprintf(name, sizeof(name), "Blanket x%d", copies);
+
+        bool reached = false;
+        for (; threshold <= THRESHOLD_MAX + 1e-3f; threshold += THRESHOLD_STEP) {
+            sim_noise_init(&noise, flip, burst, burst_flip, seed);
+            retransmit_config_t config = {.threshold = threshold, .max_retries = MAX_RETRIES,
+                                          .oversample = oversample};
+            if (!run_selective(&reader, num_pixels, &config, reconstructed, &result)) {
+                return 1;
+            }
+            if (result.correct >= blanket.correct) {
+                reached = true;
+                break;
+            }
+        }
+        if (!reached) {
+            printf("%-12s %8.2f%%  not reached up to threshold %.2f\n", name,
+                   100.0f * blanket.correct / blanket.pixels, THRESHOLD_MAX);
+            continue;
+        }
+        const float selective_tx = (float)result.transfers / result.pixels;
+        const float blanket_tx = (float)blanket.transfers / blanket.pixels;
+        printf("%-12s %8.2f%% %9.2f %10.3f %10.3f %7.0f%%\n", name,
+               100.0f * blanket.correct / blanket.pixels, threshold, selective_tx, blanket_tx,
+               100.0f * (1.0f - selective_tx / blanket_tx));
+    }
+
+    free(reconstructed);
+    return 0;
+}
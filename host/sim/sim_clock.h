@@ -0,0 +1,51 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Clock of the simulator behind time_us_64(), get_absolute_time() and the
+// sleeps (and so the host cycle counter in lib/signal.c).
+//
+// Real: host monotonic time since the first read; sleeps block the thread.
+// Virtual: a discrete-event clock. A sleep advances simulated time to its
+// wake-up time at once, so protocol timing (bit periods, idle gaps, the 60 s
+// pauses between images) costs no wall time. Host time spent computing
+// between clock events counts `compute_scale` times: 0 makes computation free
+// and every run deterministic, 1 keeps it at host speed, other values model a
+// slower or faster target. Time the host thread was preempted is left out.
+// Both cores share one clock: sleeps on Core1 advance it like sleeps on Core0.
+//
+// The clock is chosen by PICO_SIM_CLOCK=real|virtual (default real) and
+// PICO_SIM_COMPUTE_SCALE (default 0) at the first time read, or by
+// sim_clock_set_mode() before it.
+typedef enum {
+    SIM_CLOCK_REAL,
+    SIM_CLOCK_VIRTUAL,
+} sim_clock_mode_t;
+
+/**
+ * Select the clock
+ * @param mode Real or virtual
+ * @param compute_scale Virtual clock: simulated us per host us of computation
+ * @return false if time was already read (the clock cannot change then)
+ */
+bool sim_clock_set_mode(sim_clock_mode_t mode, double compute_scale);
+
+/**
+ * Clock in use (resolves the environment on first call)
+ */
+sim_clock_mode_t sim_clock_mode(void);
+
+/**
+ * Simulated time spent in sleeps so far (both clocks)
+ * @return Microseconds
+ */
+uint64_t sim_clock_slept_us(void);
+
+/**
+ * Name of a clock mode ("real", "virtual")
+ */
+const char *sim_clock_name(sim_clock_mode_t mode);
+
+#endif // SIM_CLOCK_H
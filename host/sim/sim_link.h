@@ -0,0 +1,42 @@
+#ifndef SIM_LINK_H
+#define SIM_LINK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Link model of the simulator: decides what each input pin reads.
+// The default model is a loopback: every input follows SIGNAL_GPIO.
+
+// Transmitter state seen by the model
+typedef struct {
+    bool tx_level;          // Level driven on SIGNAL_GPIO
+    bool tx_prev_level;     // Level before the last SIGNAL_GPIO change
+    uint64_t tx_change_us;  // time_us_64() of the last SIGNAL_GPIO change
+    bool tx_active;         // TX_ACTIVE_GPIO
+    int bit_index;          // Clock rising edges since TX_ACTIVE rose, minus one
+    uint32_t transfer;      // TX_ACTIVE rising edges since start
+} sim_link_state_t;
+
+/**
+ * Input model callback
+ * @param gpio Input pin being read
+ * @param link Current transmitter state
+ * @param ctx User context passed to sim_link_set_rx_model()
+ * @return Level seen on the pin
+ */
+typedef bool (*sim_rx_model_t)(unsigned int gpio, const sim_link_state_t *link, void *ctx);
+
+/**
+ * Install an input model
+ * @param model Callback, or NULL to restore the loopback
+ * @param ctx Passed to every call of the model
+ */
+void sim_link_set_rx_model(sim_rx_model_t model, void *ctx);
+
+/**
+ * Snapshot of the transmitter state
+ * @param state Output
+ */
+void sim_link_get_state(sim_link_state_t *state);
+
+#endif // SIM_LINK_H
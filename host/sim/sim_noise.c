@@ -0,0 +1,50 @@
+#include "sim_noise.h"
+#include "pico/time.h"
+#include <math.h>
+
+// xorshift64*: uniform float in [0, 1)
+static float next_uniform(sim_noise_t *noise) {
+    noise->rng ^= noise->rng >> 12;
+    noise->rng ^= noise->rng << 25;
+    noise->rng ^= noise->rng >> 27;
+    return (float)((noise->rng * 0x2545F4914F6CDD1Dull) >> 40) / (float)(1 << 24);
+}
+
+void sim_noise_init(sim_noise_t *noise, float flip_prob, float burst_prob, float burst_flip,
+                    uint64_t seed) {
+    noise->flip_prob = flip_prob;
+    noise->burst_prob = burst_prob;
+    noise->burst_flip = burst_flip;
+    noise->settle_us = 0.0f;
+    noise->rng = seed ? seed : 1;
+    noise->last_transfer = UINT32_MAX;
+    noise->last_bit = -2;
+    noise->in_burst = false;
+}
+
+void sim_noise_set_settle(sim_noise_t *noise, float settle_us) {
+    noise->settle_us = settle_us;
+}
+
+bool sim_noise_rx_model(unsigned int gpio, const sim_link_state_t *link, void *ctx) {
+    sim_noise_t *noise = ctx;
+    (void)gpio;
+
+    // New bit period: decide whether it is a burst
+    if (link->transfer != noise->last_transfer || link->bit_index != noise->last_bit) {
+        noise->last_transfer = link->transfer;
+        noise->last_bit = link->bit_index;
+        noise->in_burst = next_uniform(noise) < noise->burst_prob;
+    }
+
+    bool level = link->tx_level;
+    if (noise->settle_us > 0.0f) {
+        float elapsed = (float)(time_us_64() - link->tx_change_us);
+        if (next_uniform(noise) < expf(-elapsed / noise->settle_us)) {
+            level = link->tx_prev_level;
+        }
+    }
+
+    float flip = noise->in_burst ? noise->burst_flip : noise->flip_prob;
+    return next_uniform(noise) < flip ? !level : level;
+}
@@ -0,0 +1,50 @@
+#ifndef SIM_NOISE_H
+#define SIM_NOISE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sim_link.h"
+
+// Noisy loopback link model for sim_link_set_rx_model().
+// Every receiver read returns SIGNAL_GPIO, flipped with probability flip_prob.
+// Each transmitted bit is hit by a burst with probability burst_prob; during a
+// burst, reads flip with probability burst_flip instead.
+// With a settle time the line is band-limited: a read t us after SIGNAL_GPIO
+// changed still sees the previous level with probability exp(-t / settle_us),
+// so short bit periods cost accuracy.
+typedef struct {
+    float flip_prob;
+    float burst_prob;
+    float burst_flip;
+    float settle_us;         // Line time constant (0 = instant)
+    uint64_t rng;            // Random state, any nonzero seed
+    // Internal
+    uint32_t last_transfer;
+    int last_bit;
+    bool in_burst;
+} sim_noise_t;
+
+/**
+ * Initialize a noise model
+ * @param noise Model state
+ * @param flip_prob Per-read flip probability outside bursts
+ * @param burst_prob Probability that a bit period is a burst
+ * @param burst_flip Per-read flip probability inside a burst
+ * @param seed Random seed
+ */
+void sim_noise_init(sim_noise_t *noise, float flip_prob, float burst_prob, float burst_flip,
+                    uint64_t seed);
+
+/**
+ * Set the line time constant
+ * @param noise Model state
+ * @param settle_us Time constant in microseconds (0 = instant edges)
+ */
+void sim_noise_set_settle(sim_noise_t *noise, float settle_us);
+
+/**
+ * Link model callback (ctx = sim_noise_t *)
+ */
+bool sim_noise_rx_model(unsigned int gpio, const sim_link_state_t *link, void *ctx);
+
+#endif // SIM_NOISE_H
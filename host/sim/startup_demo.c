@@ -0,0 +1,198 @@
+// Boot to first decoded pixel in the firmware simulator.
+//
+// Runs main()'s boot sequence (lib/startup.c) and decodes one pixel over the
+// link, in a fresh process per strategy since the tables are built once:
+//   overlapped  matcher tables built on Core1 while Core0 brings up stdio and
+//               the GPIOs and sends the first pixel (firmware)
+//   serial      matcher tables built on Core0 first
+//   lazy        no table step, each matcher builds its table on the first pixel
+// Each run prints its startup report; a summary of boot to first pixel follows,
+// with the cost of the quarter-wave trig table against 2 x LUT_SIZE sinf/cosf
+// calls. -s selects the seeded matcher (needs two more tables) and -r repeats
+// each strategy to take the fastest run.
+
+#include "pico/stdlib.h"
+#include "sim_noise.h"
+#include "gpio_control.h"
+#include "dtft.h"
+#include "lut.h"
+#include "signal.h"
+#include "startup.h"
+#include "mem_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+enum { BOOT_OVERLAPPED, BOOT_SERIAL, BOOT_LAZY, BOOT_COUNT };
+static const char *boot_names[BOOT_COUNT] = {"overlapped", "serial", "lazy"};
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-s] [-r RUNS] [-v VALUE]\n"
+            "  -s  decode with the seeded matcher (default: full-spectrum matcher)\n"
+            "  -r  runs per strategy, fastest kept (default 5)\n"
+            "  -v  pixel value to send (default 0x4C)\n",
+            prog);
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+/**
+ * main()'s boot sequence with the given table strategy, then one pixel
+ * @return Boot to first pixel in us, 0 on failure
+ */
+static uint32_t boot_and_decode(int strategy, bool seeded, uint8_t value, bool report) {
+    if (strategy == BOOT_OVERLAPPED) {
+        startup_step_begin("core1 launch");
+        init_core1_dtft();
+        startup_step_end();
+    }
+    if (strategy != BOOT_LAZY) {
+        startup_tables_begin();
+    }
+
+    startup_step_begin("stdio");
+    stdio_init_all();
+    startup_step_end();
+    startup_step_begin("trig lookup tables");
+    init_trig_lut();
+    startup_step_end();
+    startup_step_begin("gpio");
+    pico_led_init();
+    init_signal_gpio();
+    startup_step_end();
+
+    sim_noise_t noise;
+    sim_noise_init(&noise, 0.0f, 0.0f, 0.0f, 1);
+    sim_link_set_rx_model(sim_noise_rx_model, &noise);
+    set_bit_period_us(1);
+
+    // Report printed by the first decoded pixel; silence it unless asked
+    fflush(stdout);
+    FILE *saved = NULL;
+    if (!report) {
+        saved = stdout;
+        stdout = fopen("/dev/null", "w");
+    }
+    uint8_t *bits_recv = send_receive_data(value, 8, 1);
+    uint8_t decoded = 0;
+    if (bits_recv) {
+        decoded = seeded ? process_pattern_seeded_return_value(bits_recv, 1, 0)
+                         : process_pattern_zoh_return_value(bits_recv, 1);
+        MEM_FREE(bits_recv);
+    }
+    if (saved) {
+        fclose(stdout);
+        stdout = saved;
+    }
+    return decoded == value ? startup_first_pixel_us() : 0;
+}
+
+/**
+ * Boot to first pixel of a strategy in a child process
+ */
+static uint32_t run_child(int strategy, bool seeded, uint8_t value, bool report) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return 0;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        uint32_t us = boot_and_decode(strategy, seeded, value, report);
+        if (write(fds[1], &us, sizeof(us)) != sizeof(us)) {
+            _exit(1);
+        }
+        fflush(stdout);
+        _exit(0);
+    }
+    close(fds[1]);
+    uint32_t us = 0;
+    if (pid < 0 || read(fds[0], &us, sizeof(us)) != sizeof(us)) {
+        us = 0;
+    }
+    close(fds[0]);
+    if (pid > 0) {
+        waitpid(pid, NULL, 0);
+    }
+    return us;
+}
+
+int main(int argc, char **argv) {
+    bool seeded = false;
+    int runs = 5;
+    uint8_t value = 0x4C;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0) {
+            seeded = true;
+        } else if (i + 1 < argc && strcmp(argv[i], "-r") == 0) {
+            runs = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-v") == 0) {
+            value = (uint8_t)strtol(argv[++i], NULL, 0);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (runs < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    uint32_t best[BOOT_COUNT];
+    int failures = 0;
+    for (int strategy = 0; strategy < BOOT_COUNT; strategy++) {
+        printf("---- %s ----", boot_names[strategy]);
+        best[strategy] = 0;
+        for (int run = 0; run < runs; run++) {
+            // Report of the first run only
+            uint32_t us = run_child(strategy, seeded, value, run == 0);
+            if (!us) {
+                failures++;
+                continue;
+            }
+            if (!best[strategy] || us < best[strategy]) {
+                best[strategy] = us;
+            }
+        }
+    }
+
+    // Trig table: quarter wave and symmetry against the full sinf/cosf loop
+    static float sin_ref[LUT_SIZE], cos_ref[LUT_SIZE];
+    double start = now_us();
+    for (int i = 0; i < LUT_SIZE; i++) {
+        float angle = (2.0f * M_PI * i) / LUT_SIZE;
+        sin_ref[i] = sinf(angle);
+        cos_ref[i] = cosf(angle);
+    }
+    double full_us = now_us() - start;
+    start = now_us();
+    init_trig_lut();
+    double quarter_us = now_us() - start;
+    float max_error = 0.0f;
+    for (int i = 0; i < LUT_SIZE; i++) {
+        max_error = fmaxf(max_error, fabsf(sin_lut[i] - sin_ref[i]));
+        max_error = fmaxf(max_error, fabsf(cos_lut[i] - cos_ref[i]));
+    }
+
+    printf("Boot to first pixel (%s matcher, fastest of %d):\n", seeded ? "seeded" : "full-spectrum", runs);
+    for (int strategy = 0; strategy < BOOT_COUNT; strategy++) {
+        printf("  %-11s %8lu us\n", boot_names[strategy], (unsigned long)best[strategy]);
+    }
+    printf("Trig tables: %.1f us for %d sinf/cosf calls, %.1f us quarter wave (max difference %.2g)\n",
+           full_us, 2 * LUT_SIZE, quarter_us, max_error);
+    if (failures) {
+        printf("%d runs failed to decode the pixel\n", failures);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,243 @@
+// Long link capture analysis in the firmware simulator.
+//
+// The image pixels are sent back to back as one bitstream with
+// send_receive_stream() over a noisy simulated link, and the DTFT of the sent
+// and captured streams is taken with the blocked long-stream DTFT
+// (lib/dtft_stream.c): on the simulated Core0/Core1 pair (dtft_stream()) and
+// with the blocks split across host threads. Both are checked against a
+// direct double-precision DTFT of the whole stream.
+
+#include "pico/stdlib.h"
+#include "sim_noise.h"
+#include "gpio_control.h"
+#include "dtft.h"
+#include "dtft_stream.h"
+#include "image_asset.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+typedef struct {
+    const dtft_stream_plan_t *plan;
+    const uint8_t *bits;
+    uint32_t num_bits;
+    uint32_t first_block;
+    uint32_t end_block;
+    uint32_t *residues;
+} worker_t;
+
+static void *worker_main(void *arg) {
+    worker_t *w = arg;
+    dtft_stream_accumulate(w->plan, w->bits, w->num_bits, w->first_block, w->end_block, w->residues);
+    return NULL;
+}
+
+// Blocks split into contiguous ranges, one per thread
+static void dtft_stream_threads(const dtft_stream_plan_t *plan, const uint8_t *bits, uint32_t num_bits,
+                                int num_threads, float *output) {
+    const uint32_t num_blocks = dtft_stream_num_blocks(num_bits);
+    if ((uint32_t)num_threads > num_blocks) num_threads = (int)num_blocks;
+    if (num_threads < 1) num_threads = 1;
+
+    pthread_t *threads = malloc(num_threads * sizeof(pthread_t));
+    worker_t *workers = malloc(num_threads * sizeof(worker_t));
+    uint32_t *residues = calloc((size_t)num_threads * plan->period, sizeof(uint32_t));
+    for (int t = 0; t < num_threads; t++) {
+        workers[t] = (worker_t){plan, bits, num_bits,
+                                (uint32_t)((uint64_t)num_blocks * t / num_threads),
+                                (uint32_t)((uint64_t)num_blocks * (t + 1) / num_threads),
+                                &residues[(size_t)t * plan->period]};
+        pthread_create(&threads[t], NULL, worker_main, &workers[t]);
+    }
+    for (int t = 0; t < num_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    for (int t = 1; t < num_threads; t++) {
+        for (int r = 0; r < plan->period; r++) {
+            residues[r] += residues[(size_t)t * plan->period + r];
+        }
+    }
+    dtft_stream_evaluate(plan, residues, output);
+
+    free(residues);
+    free(workers);
+    free(threads);
+}
+
+// Direct Σ x[n] e^{-jω_k n} in double precision
+static void dtft_reference(const uint8_t *bits, uint32_t num_bits, int num_bins, double *output) {
+    memset(output, 0, 2 * num_bins * sizeof(double));
+    for (uint32_t n = 0; n < num_bits; n++) {
+        if (!((bits[n / 8] >> (7 - n % 8)) & 1)) continue;
+        for (int k = 0; k < num_bins; k++) {
+            double angle = -M_PI * k * (double)n / (num_bins - 1);
+            output[2*k] += cos(angle);
+            output[2*k + 1] += sin(angle);
+        }
+    }
+}
+
+// Largest complex error relative to the largest reference amplitude
+static double max_error(const float *spectrum, const double *reference, int num_bins) {
+    double worst = 0.0, peak = 0.0;
+    for (int k = 0; k < num_bins; k++) {
+        double err = hypot(spectrum[2*k] - reference[2*k], spectrum[2*k + 1] - reference[2*k + 1]);
+        double amplitude = hypot(reference[2*k], reference[2*k + 1]);
+        if (err > worst) worst = err;
+        if (amplitude > peak) peak = amplitude;
+    }
+    return peak > 0.0 ? worst / peak : worst;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-n BITS] [-b BINS] [-d DIVISOR] [-f FLIP] [-j THREADS] [--no-reference]\n"
+            "  -n  stream length in bits (default 2000000, image pixels repeated)\n"
+            "  -b  frequency points from 0 to pi (default 41)\n"
+            "  -d  receiver sampling divisor (default 1)\n"
+            "  -f  per-read flip probability of the link (default 0.01)\n"
+            "  -j  host threads (default: online CPUs)\n"
+            "  --no-reference  skip the direct double-precision DTFT\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    uint32_t num_bits = 2000000;
+    int num_bins = 41;
+    int divisor = 1;
+    float flip = 0.01f;
+    int num_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    bool reference = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+            num_bits = (uint32_t)atol(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-b") == 0) {
+            num_bins = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-d") == 0) {
+            divisor = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-f") == 0) {
+            flip = (float)atof(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-j") == 0) {
+            num_threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--no-reference") == 0) {
+            reference = false;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (num_bits < 1 || divisor < 1 || divisor > 255 || num_threads < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    dtft_stream_plan_t plan;
+    if (!dtft_stream_plan_init(&plan, num_bins)) {
+        fprintf(stderr, "bins must be 2-%d\n", DTFT_STREAM_MAX_BINS);
+        return 1;
+    }
+
+    // Sent stream: image pixels back to back, MSB first
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open(&reader, asset, asset_size)) {
+        return 1;
+    }
+    const uint32_t num_bytes = (num_bits + 7) / 8;
+    uint8_t *tx = malloc(num_bytes);
+    uint8_t *rx = malloc(num_bytes);
+    float *tx_spectrum = malloc(2 * num_bins * sizeof(float));
+    float *rx_spectrum = malloc(2 * num_bins * sizeof(float));
+    float *check = malloc(2 * num_bins * sizeof(float));
+    double *expected = malloc(2 * num_bins * sizeof(double));
+    if (!tx || !rx || !tx_spectrum || !rx_spectrum || !check || !expected) {
+        return 1;
+    }
+    for (uint32_t j = 0; j < num_bytes; j++) {
+        if (image_reader_read(&reader, &tx[j], 1) != 1) {
+            image_reader_rewind(&reader);
+            image_reader_read(&reader, &tx[j], 1);
+        }
+    }
+
+    init_signal_gpio();
+    init_core1_dtft();
+    sim_noise_t noise;
+    sim_noise_init(&noise, flip, 0.0f, 0.0f, 1);
+    sim_link_set_rx_model(sim_noise_rx_model, &noise);
+
+    double start = now_s();
+    if (!send_receive_stream(tx, num_bits, (uint8_t)divisor, rx)) {
+        return 1;
+    }
+    double link_s = now_s() - start;
+    uint32_t bit_errors = 0;
+    for (uint32_t n = 0; n < num_bits; n++) {
+        bit_errors += ((tx[n / 8] ^ rx[n / 8]) >> (7 - n % 8)) & 1;
+    }
+    printf("Stream: %lu bits, %d bins, %lu blocks of %d bits\n", (unsigned long)num_bits, num_bins,
+           (unsigned long)dtft_stream_num_blocks(num_bits), DTFT_STREAM_BLOCK_BITS);
+    printf("Link (flip %.3f, divisor %d): %.2f s, bit errors %lu (%.3f%%)\n\n", flip, divisor, link_s,
+           (unsigned long)bit_errors, 100.0 * bit_errors / num_bits);
+
+    // Blocked DTFT: one thread, Core0 + Core1, host threads
+    printf("%-22s %10s %12s\n", "DTFT of the capture", "ms", "Msamples/s");
+    start = now_s();
+    dtft_stream_threads(&plan, rx, num_bits, 1, check);
+    double single_s = now_s() - start;
+    printf("%-22s %10.2f %12.1f\n", "1 thread", single_s * 1e3, num_bits / single_s / 1e6);
+
+    start = now_s();
+    dtft_stream(&plan, rx, num_bits, rx_spectrum);
+    double dual_s = now_s() - start;
+    printf("%-22s %10.2f %12.1f\n", "Core0 + Core1", dual_s * 1e3, num_bits / dual_s / 1e6);
+
+    char name[32];
+    snprintf(name, sizeof(name), "Host threads (%d)", num_threads);
+    start = now_s();
+    dtft_stream_threads(&plan, rx, num_bits, num_threads, check);
+    double threads_s = now_s() - start;
+    printf("%-22s %10.2f %12.1f\n", name, threads_s * 1e3, num_bits / threads_s / 1e6);
+
+    int failures = memcmp(check, rx_spectrum, 2 * num_bins * sizeof(float)) != 0;
+    if (reference) {
+        start = now_s();
+        dtft_reference(rx, num_bits, num_bins, expected);
+        double reference_s = now_s() - start;
+        double err = max_error(rx_spectrum, expected, num_bins);
+        printf("%-22s %10.2f %12.1f\n", "Direct (double)", reference_s * 1e3, num_bits / reference_s / 1e6);
+        printf("\nMax error vs direct DTFT: %.3g (relative to the largest amplitude)\n", err);
+        failures += err > 1e-6;
+    }
+
+    // What the link did to the spectrum
+    dtft_stream(&plan, tx, num_bits, tx_spectrum);
+    double diff = 0.0, energy = 0.0;
+    for (int k = 0; k < 2 * num_bins; k++) {
+        diff += (rx_spectrum[k] - tx_spectrum[k]) * (double)(rx_spectrum[k] - tx_spectrum[k]);
+        energy += tx_spectrum[k] * (double)tx_spectrum[k];
+    }
+    printf("Capture vs sent spectrum: relative L2 difference %.4f\n", sqrt(diff / energy));
+    printf("%s\n", failures ? "MISMATCH" : "OK: blocked DTFT matches on every path");
+
+    dtft_stream_plan_free(&plan);
+    free(tx);
+    free(rx);
+    free(tx_spectrum);
+    free(rx_spectrum);
+    free(check);
+    free(expected);
+    return failures ? 1 : 0;
+}
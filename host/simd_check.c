@@ -0,0 +1,252 @@
+// Checks every SIMD level the CPU supports (host_simd.h) against the scalar
+// kernels: idtft_decode_batch() and idtft_match_batch() on noisy spectra of
+// random repeated patterns, for the n10 configuration and two others that
+// exercise padded samples and values (3 bits) and a 4096-way search (12 bits).
+// The levels sum in a different order, so a pattern may differ where the
+// double-precision signal sits within rounding of the threshold, or two
+// entries within rounding of the nearest distance; those are counted apart and
+// every other decision must match. Then reports throughput per level on the
+// n10 spectra next to the read bandwidth of the same buffer.
+//
+// -n sets the spectra per configuration, -s the noise sigma, -t the threads.
+
+#include "idtft.h"
+#include "host_simd.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NEAR_TOLERANCE 1e-5     // Relative to the magnitudes summed
+#define TIMING_ROUNDS 3
+
+typedef struct {
+    int num_points;
+    int signal_len;
+    int pattern_len;
+} config_t;
+
+static const config_t configs[] = {
+    {41, 80, 8},     // n10 table: 8 bits repeated 10 times
+    {13, 24, 3},
+    {49, 96, 12},
+};
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint64_t rng_next(void) {
+    // xorshift64*
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545F4914F6CDD1Dull;
+}
+
+static double rng_gaussian(void) {
+    double u1 = ((rng_next() >> 11) + 1.0) / 9007199254740993.0;
+    double u2 = (rng_next() >> 11) / 9007199254740992.0;
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Noisy spectra of random patterns repeated over signal_len, from the match
+// plan's exact entries
+static float* synthesize(const idtft_match_plan_t *match, size_t count, double sigma) {
+    const size_t record = (size_t)match->num_points * 2;
+    float *spectra = malloc(count * record * sizeof(float));
+    if (!spectra) return NULL;
+    for (size_t i = 0; i < count; i++) {
+        int value = (int)(rng_next() >> 40) & (match->num_values - 1);
+        float *spectrum = &spectra[i * record];
+        memset(spectrum, 0, record * sizeof(float));
+        for (int d = 0; d < match->num_dims; d++) {
+            spectrum[match->dims[d]] = match->table[(size_t)d * match->value_stride + value];
+        }
+        for (size_t j = 0; j < record; j++) {
+            spectrum[j] += (float)(sigma * rng_gaussian());
+        }
+    }
+    return spectra;
+}
+
+// Whether a head sample of the double-precision inverse is within rounding of max/2
+static bool near_threshold(const config_t *c, const float *spectrum) {
+    double x[4096];
+    double max_value = -INFINITY, scale = 0.0;
+    for (int k = 0; k < c->num_points; k++) {
+        double weight = (k == 0 || k == c->num_points - 1 ? 1.0 : 2.0) / c->signal_len;
+        scale += weight * (fabs(spectrum[2*k]) + fabs(spectrum[2*k + 1]));
+    }
+    for (int n = 0; n < c->signal_len; n++) {
+        x[n] = 0.0;
+        for (int k = 0; k < c->num_points; k++) {
+            double omega = M_PI * k / (c->num_points - 1);
+            double weight = (k == 0 || k == c->num_points - 1 ? 1.0 : 2.0) / c->signal_len;
+            x[n] += weight * (spectrum[2*k] * cos(omega * n) - spectrum[2*k + 1] * sin(omega * n));
+        }
+        max_value = fmax(max_value, x[n]);
+    }
+    for (int n = 0; n < c->pattern_len; n++) {
+        if (fabs(x[n] - max_value / 2.0) <= NEAR_TOLERANCE * scale) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Whether two entries are within rounding of the same distance
+static bool near_tie(const idtft_match_plan_t *match, const float *spectrum, int a, int b) {
+    double distance_a = 0.0, distance_b = 0.0, scale = 0.0;
+    for (int d = 0; d < match->num_dims; d++) {
+        double x = spectrum[match->dims[d]];
+        double ta = match->table[(size_t)d * match->value_stride + a];
+        double tb = match->table[(size_t)d * match->value_stride + b];
+        distance_a += (x - ta) * (x - ta);
+        distance_b += (x - tb) * (x - tb);
+        scale += x * x + ta * ta + tb * tb;
+    }
+    return fabs(distance_a - distance_b) <= NEAR_TOLERANCE * scale;
+}
+
+// Read bandwidth of a buffer (XOR of every word), GB/s
+static double read_bandwidth(const void *buffer, size_t bytes) {
+    const uint64_t *words = buffer;
+    const size_t count = bytes / sizeof(uint64_t);
+    volatile uint64_t sink = 0;
+    double best = 0.0;
+    for (int round = 0; round < TIMING_ROUNDS; round++) {
+        double t0 = now_s();
+        uint64_t x = 0;
+        for (size_t i = 0; i < count; i++) {
+            x ^= words[i];
+        }
+        sink ^= x;
+        double t = now_s() - t0;
+        if (bytes / t / 1e9 > best) best = bytes / t / 1e9;
+    }
+    (void)sink;
+    return best;
+}
+
+int main(int argc, char **argv) {
+    size_t count = 200000;
+    double sigma = 2.0;
+    int threads = 0;
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && !strcmp(argv[i], "-n")) {
+            count = (size_t)atol(argv[++i]);
+        } else if (i + 1 < argc && !strcmp(argv[i], "-s")) {
+            sigma = atof(argv[++i]);
+        } else if (i + 1 < argc && !strcmp(argv[i], "-t")) {
+            threads = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [-n SPECTRA] [-s SIGMA] [-t THREADS]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (count == 0) count = 1;
+
+    printf("SIMD levels:");
+    for (int level = 0; level < HOST_SIMD_COUNT; level++) {
+        printf(" %s%s", host_simd_name((host_simd_t)level),
+               host_simd_supported((host_simd_t)level) ? "" : " (unsupported)");
+    }
+    printf("; best %s\n\n", host_simd_name(host_simd_best()));
+
+    int failures = 0;
+    uint16_t *reference_decode = malloc(count * sizeof(uint16_t));
+    uint16_t *reference_match = malloc(count * sizeof(uint16_t));
+    uint16_t *patterns = malloc(count * sizeof(uint16_t));
+    if (!reference_decode || !reference_match || !patterns) {
+        fprintf(stderr, "Error: out of memory\n");
+        return 1;
+    }
+
+    printf("config      dims  level   decode differ (near)  match differ (near)\n");
+    for (unsigned ci = 0; ci < sizeof(configs) / sizeof(configs[0]); ci++) {
+        const config_t *c = &configs[ci];
+        idtft_plan_t *plan = idtft_plan_create(c->num_points, c->signal_len, c->pattern_len);
+        idtft_match_plan_t *match = idtft_match_plan_create(c->num_points, c->signal_len, c->pattern_len);
+        float *spectra = match ? synthesize(match, count, sigma) : NULL;
+        if (!plan || !match || !spectra) {
+            fprintf(stderr, "Error: setup failed for %d points, N=%d, %d bits\n",
+                    c->num_points, c->signal_len, c->pattern_len);
+            return 1;
+        }
+        const size_t record = (size_t)c->num_points * 2;
+
+        host_simd_set(HOST_SIMD_SCALAR);
+        idtft_decode_batch(plan, spectra, count, reference_decode, threads);
+        idtft_match_batch(match, spectra, count, reference_match, threads);
+
+        for (int level = HOST_SIMD_SCALAR + 1; level < HOST_SIMD_COUNT; level++) {
+            if (!host_simd_supported((host_simd_t)level)) continue;
+            host_simd_set((host_simd_t)level);
+
+            size_t decode_differ = 0, decode_near = 0, match_differ = 0, match_near = 0;
+            idtft_decode_batch(plan, spectra, count, patterns, threads);
+            for (size_t i = 0; i < count; i++) {
+                if (patterns[i] == reference_decode[i]) continue;
+                decode_differ++;
+                decode_near += near_threshold(c, &spectra[i * record]);
+            }
+            idtft_match_batch(match, spectra, count, patterns, threads);
+            for (size_t i = 0; i < count; i++) {
+                if (patterns[i] == reference_match[i]) continue;
+                match_differ++;
+                match_near += near_tie(match, &spectra[i * record], patterns[i], reference_match[i]);
+            }
+            if (decode_differ != decode_near || match_differ != match_near) {
+                failures++;
+            }
+
+            printf("%2d/%3d/%2d  %5d  %-6s  %13zu (%zu)  %12zu (%zu)\n", c->num_points, c->signal_len,
+                   c->pattern_len, match->num_dims, host_simd_name((host_simd_t)level),
+                   decode_differ, decode_near, match_differ, match_near);
+        }
+
+        // Throughput on the n10 configuration
+        if (ci == 0) {
+            const size_t bytes = count * record * sizeof(float);
+            printf("\n%zu spectra (%.1f MB), %d threads; read bandwidth %.2f GB/s\n", count, bytes / 1e6,
+                   threads, read_bandwidth(spectra, bytes));
+            printf("level   decode M/s   GB/s   match M/s   GB/s\n");
+            for (int level = 0; level < HOST_SIMD_COUNT; level++) {
+                if (!host_simd_supported((host_simd_t)level)) continue;
+                host_simd_set((host_simd_t)level);
+                double best_decode = INFINITY, best_match = INFINITY;
+                for (int round = 0; round < TIMING_ROUNDS; round++) {
+                    double t0 = now_s();
+                    idtft_decode_batch(plan, spectra, count, patterns, threads);
+                    double t1 = now_s();
+                    idtft_match_batch(match, spectra, count, patterns, threads);
+                    double t2 = now_s();
+                    best_decode = fmin(best_decode, t1 - t0);
+                    best_match = fmin(best_match, t2 - t1);
+                }
+                printf("%-6s  %10.2f  %5.2f  %10.2f  %5.2f\n", host_simd_name((host_simd_t)level),
+                       count / best_decode / 1e6, bytes / best_decode / 1e9,
+                       count / best_match / 1e6, bytes / best_match / 1e9);
+            }
+            printf("\n");
+        }
+
+        free(spectra);
+        idtft_match_plan_destroy(match);
+        idtft_plan_destroy(plan);
+    }
+
+    free(reference_decode);
+    free(reference_match);
+    free(patterns);
+    printf("%s\n", failures ? "MISMATCH" : "OK: every level agrees with the scalar kernels up to rounding");
+    return failures ? 1 : 0;
+}
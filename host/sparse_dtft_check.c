@@ -0,0 +1,132 @@
+// Checks the set-bit DTFT kernel (compute_dtft_magnitude_bits()) against the
+// dense kernel (compute_dtft_magnitude()) on random 0/1 signals of several
+// lengths and densities, and on the image asset sent as a bitstream. Both use
+// the same twiddles in the same order and lib/dtft_kernel.c is built without
+// reassociation (-fno-associative-math), so every magnitude must be
+// bit-identical, also from calculate_dtft_bits() against calculate_dtft().
+// Reports the time per signal of calculate_dtft() and calculate_dtft_bits()
+// (which runs the dense kernel on mostly-ones signals).
+
+#include "dtft.h"
+#include "lut.h"
+#include "image_asset.h"
+#include "mem_stats.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_POINTS 41
+#define MAX_LEN 4096
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void pack(const uint8_t *x, int N, uint8_t *bits) {
+    memset(bits, 0, (N + 7) / 8);
+    for (int n = 0; n < N; n++) {
+        bits[n / 8] |= x[n] << (7 - n % 8);
+    }
+}
+
+/**
+ * Compare both kernels on one signal at NUM_POINTS frequencies from 0 to π,
+ * then calculate_dtft_bits() against calculate_dtft()
+ * @param identical Incremented per bit-identical magnitude
+ * @return number of magnitudes that are not bit-identical
+ */
+static int compare(uint8_t *x, const uint8_t *bits, int N, int *identical, double *dense_s,
+                   double *sparse_s, int rounds) {
+    int mismatches = 0;
+    for (int k = 0; k < NUM_POINTS; k++) {
+        float omega = (float)M_PI * k / (NUM_POINTS - 1);
+        float dense = compute_dtft_magnitude(x, N, omega);
+        float sparse = compute_dtft_magnitude_bits(bits, N, omega);
+        if (memcmp(&dense, &sparse, sizeof(float)) == 0) {
+            (*identical)++;
+        } else {
+            mismatches++;
+        }
+    }
+    float *dense = calculate_dtft(x, N, NUM_POINTS);
+    float *sparse = calculate_dtft_bits(bits, N, NUM_POINTS);
+    if (memcmp(dense, sparse, NUM_POINTS * sizeof(float)) != 0) {
+        mismatches++;
+    }
+    MEM_FREE(dense);
+    MEM_FREE(sparse);
+
+    double t0 = now_s();
+    for (int round = 0; round < rounds; round++) {
+        MEM_FREE(calculate_dtft(x, N, NUM_POINTS));
+    }
+    double t1 = now_s();
+    for (int round = 0; round < rounds; round++) {
+        MEM_FREE(calculate_dtft_bits(bits, N, NUM_POINTS));
+    }
+    double t2 = now_s();
+    *dense_s = (t1 - t0) / rounds;
+    *sparse_s = (t2 - t1) / rounds;
+    return mismatches;
+}
+
+int main(void) {
+    static const int lengths[] = {80, 77, 1024, MAX_LEN};
+    static const double densities[] = {0.0, 0.01, 0.1, 0.5, 0.75, 0.9, 1.0};
+    static uint8_t x[MAX_LEN];
+    static uint8_t bits[MAX_LEN / 8];
+    int failures = 0;
+
+    init_trig_lut();
+    srand(1);
+
+    printf("length  density   identical  mismatches  dense us  set-bit us  speedup\n");
+    for (unsigned l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        const int N = lengths[l];
+        for (unsigned d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+            int mismatches = 0;
+            int identical = 0;
+            double dense_s = 0.0;
+            double sparse_s = 0.0;
+            // Several random signals per density; time the last one
+            for (int trial = 0; trial < 20; trial++) {
+                for (int n = 0; n < N; n++) {
+                    x[n] = rand() < densities[d] * ((double)RAND_MAX + 1.0);
+                }
+                pack(x, N, bits);
+                mismatches += compare(x, bits, N, &identical, &dense_s, &sparse_s, trial == 19 ? 200 : 0);
+            }
+            printf("%6d  %7.2f  %6d/%d  %10d  %8.2f  %10.2f  %6.1fx\n", N, densities[d], identical,
+                   20 * NUM_POINTS, mismatches, dense_s * 1e6, sparse_s * 1e6,
+                   sparse_s > 0 ? dense_s / sparse_s : 0.0);
+            failures += mismatches;
+        }
+    }
+
+    // Image pixels back to back as a bitstream (dark images have few ones)
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (image_reader_open(&reader, asset, asset_size)) {
+        int num_bytes = image_reader_read(&reader, bits, MAX_LEN / 8);
+        int ones = 0;
+        for (int n = 0; n < num_bytes * 8; n++) {
+            x[n] = (bits[n / 8] >> (7 - n % 8)) & 1;
+            ones += x[n];
+        }
+        double dense_s, sparse_s;
+        int identical = 0;
+        int mismatches = compare(x, bits, num_bytes * 8, &identical, &dense_s, &sparse_s, 200);
+        printf("image asset: %d bits, %.1f%% ones, %d/%d identical, %d mismatches, dense %.2f us, "
+               "set-bit %.2f us (%.1fx)\n", num_bytes * 8, 100.0 * ones / (num_bytes * 8), identical,
+               NUM_POINTS, mismatches, dense_s * 1e6, sparse_s * 1e6, dense_s / sparse_s);
+        failures += mismatches;
+    }
+
+    printf("%s\n", failures ? "MISMATCH" : "OK: set-bit kernel matches the dense kernel");
+    return failures ? 1 : 0;
+}
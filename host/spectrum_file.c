@@ -0,0 +1,25 @@
+#include "spectrum_file.h"
+
+int spectrum_file_read_header(FILE *f, spectrum_file_header_t *header) {
+    if (fread(header, sizeof(*header), 1, f) != 1) {
+        fprintf(stderr, "Error: spectrum file truncated\n");
+        return -1;
+    }
+    if (header->magic != SPECTRUM_FILE_MAGIC || header->version != SPECTRUM_FILE_VERSION) {
+        fprintf(stderr, "Error: not a spectrum file (magic 0x%08X, version %u)\n",
+                header->magic, header->version);
+        return -1;
+    }
+    if (header->num_points < 2 || header->pattern_len < 1 || header->pattern_len > 16 ||
+        header->signal_len < header->pattern_len) {
+        fprintf(stderr, "Error: unsupported spectrum file parameters\n");
+        return -1;
+    }
+    return 0;
+}
+
+int spectrum_file_write_header(FILE *f, spectrum_file_header_t *header) {
+    header->magic = SPECTRUM_FILE_MAGIC;
+    header->version = SPECTRUM_FILE_VERSION;
+    return fwrite(header, sizeof(*header), 1, f) == 1 ? 0 : -1;
+}
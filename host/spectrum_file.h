@@ -0,0 +1,39 @@
+#ifndef SPECTRUM_FILE_H
+#define SPECTRUM_FILE_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Binary spectrum export (.dtfs), written by export_spectra.py or idtft_decode --synthesize
+// Layout (little-endian): spectrum_file_header_t, then count records of
+// num_points complex values [real0, imag0, real1, imag1, ...] as float32,
+// the same layout calculate_dtft_complex() produces on the Pico.
+#define SPECTRUM_FILE_MAGIC 0x53465444u  // "DTFS"
+#define SPECTRUM_FILE_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_points;   // Frequency points from 0 to π (41)
+    uint32_t signal_len;   // Samples the spectra were computed over (80)
+    uint32_t pattern_len;  // Bits per pattern (8)
+    uint32_t count;        // Number of spectra in the file
+} spectrum_file_header_t;
+
+/**
+ * Read and validate a spectrum file header
+ * @param f Open file positioned at the start
+ * @param header Output header
+ * @return 0 on success, -1 on error (message printed)
+ */
+int spectrum_file_read_header(FILE *f, spectrum_file_header_t *header);
+
+/**
+ * Write a spectrum file header
+ * @param f Open file positioned at the start
+ * @param header Header to write (magic and version are filled in)
+ * @return 0 on success, -1 on error
+ */
+int spectrum_file_write_header(FILE *f, spectrum_file_header_t *header);
+
+#endif // SPECTRUM_FILE_H
@@ -0,0 +1,115 @@
+// Checks the zero-order-hold DTFT (calculate_dtft_zoh) against the full
+// held-signal path (calculate_dtft_repeated) for every 8-bit pattern and
+// sample divisor, and compares decoded values. Kernel times (best of several
+// trials) are reported only: they depend on host load, and at divisors 1, 2, 4
+// and 8 both paths run specialized kernels that already skip the bins whose
+// repetition gain is zero.
+
+#include "dtft.h"
+#include "signal.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#define NUM_BINS 41
+#define REPS 10
+#define TIMING_ROUNDS 20
+#define TIMING_TRIALS 25
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Record as send_receive_data() builds it: [len, held bits...] plus the sampled bits
+static int hold_pattern(int value, int divisor, uint8_t *record, uint8_t *samples) {
+    int num_samples = 0;
+    uint8_t held = 0;
+    record[0] = 8;
+    for (int n = 0; n < 8; n++) {
+        if (n % divisor == 0) {
+            held = (value >> (7 - n)) & 1;
+            samples[num_samples++] = held;
+        }
+        record[1 + n] = held;
+    }
+    return num_samples;
+}
+
+int main(void) {
+    static const int divisors[] = {1, 2, 3, 4, 8};
+    int failures = 0;
+
+    printf("divisor  max |diff|  max rel (|X|>1)  decode agree  full ns  zoh ns\n");
+    for (unsigned d = 0; d < sizeof(divisors) / sizeof(divisors[0]); d++) {
+        const int divisor = divisors[d];
+        double max_diff = 0.0;
+        double max_rel = 0.0;
+        int agree = 0;
+
+        for (int value = 0; value < 256; value++) {
+            uint8_t record[9];
+            uint8_t samples[8];
+            hold_pattern(value, divisor, record, samples);
+
+            float full[NUM_BINS * 2];
+            float zoh[NUM_BINS * 2];
+            calculate_dtft_repeated(&record[1], 8, REPS, NUM_BINS, full);
+            calculate_dtft_zoh(samples, 8, divisor, REPS, NUM_BINS, zoh);
+
+            for (int k = 0; k < NUM_BINS; k++) {
+                double dr = full[2*k] - zoh[2*k];
+                double di = full[2*k + 1] - zoh[2*k + 1];
+                double diff = sqrt(dr * dr + di * di);
+                double mag = hypot(full[2*k], full[2*k + 1]);
+                if (diff > max_diff) max_diff = diff;
+                if (mag > 1.0 && diff / mag > max_rel) max_rel = diff / mag;
+            }
+
+            if (process_pattern_return_value(record) == process_pattern_zoh_return_value(record, divisor)) {
+                agree++;
+            }
+        }
+
+        // Kernel time per pattern, both paths
+        static uint8_t records[256][9];
+        static uint8_t sampled[256][8];
+        for (int value = 0; value < 256; value++) {
+            hold_pattern(value, divisor, records[value], sampled[value]);
+        }
+        float out[NUM_BINS * 2];
+        volatile float sink = 0.0f;
+        double full_s = INFINITY;
+        double zoh_s = INFINITY;
+        for (int trial = 0; trial < TIMING_TRIALS; trial++) {
+            double t0 = now_s();
+            for (int round = 0; round < TIMING_ROUNDS; round++) {
+                for (int value = 0; value < 256; value++) {
+                    calculate_dtft_repeated(&records[value][1], 8, REPS, NUM_BINS, out);
+                    sink += out[2];
+                }
+            }
+            double t1 = now_s();
+            for (int round = 0; round < TIMING_ROUNDS; round++) {
+                for (int value = 0; value < 256; value++) {
+                    calculate_dtft_zoh(sampled[value], 8, divisor, REPS, NUM_BINS, out);
+                    sink += out[2];
+                }
+            }
+            double t2 = now_s();
+            full_s = fmin(full_s, t1 - t0);
+            zoh_s = fmin(zoh_s, t2 - t1);
+        }
+        (void)sink;
+
+        printf("%7d  %10.2e  %15.2e  %8d/256  %7.1f  %6.1f\n", divisor, max_diff, max_rel, agree,
+               full_s * 1e9 / (TIMING_ROUNDS * 256), zoh_s * 1e9 / (TIMING_ROUNDS * 256));
+        if (max_rel > 1e-4 || agree != 256) {
+            failures++;
+        }
+    }
+
+    printf("%s\n", failures ? "MISMATCH" : "OK: ZOH path matches the full-signal path");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,73 @@
+#include "bit_depth.h"
+#include "gpio_control.h"
+#include "signal.h"
+#include "mem_stats.h"
+#include "pico/stdlib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+bool bit_depth_transfer(uint8_t value, int bits, int sample_divisor, uint8_t *level, int64_t *decode_us) {
+    uint8_t *bits_recv = send_receive_data(bit_depth_quantize(value, bits), (uint8_t)bits,
+                                           (uint8_t)sample_divisor);
+    if (!bits_recv) {
+        return false;
+    }
+    absolute_time_t decode_start = get_absolute_time();
+    *level = (uint8_t)process_pattern_width_return_value(bits_recv, sample_divisor);
+    if (decode_us) {
+        *decode_us += absolute_time_diff_us(decode_start, get_absolute_time());
+    }
+    MEM_FREE(bits_recv);
+    return true;
+}
+
+bool bit_depth_image(image_reader_t *reader, uint32_t num_pixels, int bits, int sample_divisor,
+                     uint8_t *reconstructed, bit_depth_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->bits = bits;
+    if (bits < BIT_DEPTH_MIN || bits > BIT_DEPTH_MAX) {
+        printf("Error: bit depth must be between %d and %d\n", BIT_DEPTH_MIN, BIT_DEPTH_MAX);
+        return false;
+    }
+
+    absolute_time_t start_time = get_absolute_time();
+    for (uint32_t i = 0; i < num_pixels; i++) {
+        uint8_t value;
+        if (image_reader_read(reader, &value, 1) != 1) {
+            break;
+        }
+        uint8_t level;
+        if (!bit_depth_transfer(value, bits, sample_divisor, &level, &stats->decode_us)) {
+            return false;
+        }
+        reconstructed[i] = bit_depth_expand(level, bits);
+        stats->correct_levels += level == bit_depth_quantize(value, bits);
+        int error = (int)reconstructed[i] - value;
+        stats->squared_error += (uint32_t)(error * error);
+        stats->pixels++;
+    }
+    stats->time_us = absolute_time_diff_us(start_time, get_absolute_time());
+    return true;
+}
+
+float bit_depth_psnr(const bit_depth_stats_t *stats) {
+    if (stats->pixels == 0 || stats->squared_error == 0) {
+        return INFINITY;
+    }
+    double mse = (double)stats->squared_error / stats->pixels;
+    return (float)(10.0 * log10(255.0 * 255.0 / mse));
+}
+
+void bit_depth_print_header(void) {
+    printf("%4s %9s %10s %10s %12s %11s\n", "Bits", "PSNR (dB)", "Levels ok", "Pixel (us)",
+           "Decode (us)", "Pixels/s");
+}
+
+void bit_depth_print_stats(const bit_depth_stats_t *stats) {
+    const float pixels = stats->pixels > 0 ? (float)stats->pixels : 1.0f;
+    printf("%4d %9.2f %9.2f%% %10.2f %12.2f %11.1f\n", stats->bits, bit_depth_psnr(stats),
+           100.0f * stats->correct_levels / pixels, stats->time_us / pixels, stats->decode_us / pixels,
+           stats->time_us > 0 ? stats->pixels * 1000000.0f / stats->time_us : 0.0f);
+}
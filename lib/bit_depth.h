@@ -0,0 +1,88 @@
+#ifndef BIT_DEPTH_H
+#define BIT_DEPTH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "image_asset.h"
+
+// Reduced bit depth transmission. The sender keeps the top `bits` of each
+// pixel and sends only those on the link; the receiver decodes the level with
+// that depth's table (process_pattern_width_return_value(), 8 bits: the n10
+// matcher) and expands it to the middle of its 8-bit range. Wire time scales
+// with the depth and decode work with the table size.
+#define BIT_DEPTH_MIN 1
+#define BIT_DEPTH_MAX 8
+
+typedef struct {
+    int bits;
+    uint32_t pixels;
+    uint32_t correct_levels;    // Levels received as sent
+    uint64_t squared_error;     // Output against the 8-bit source
+    int64_t time_us;            // Send and decode
+    int64_t decode_us;          // Decode only
+} bit_depth_stats_t;
+
+/**
+ * Quantize an 8-bit pixel to a level of a reduced depth
+ * @param value 8-bit pixel
+ * @param bits Depth (BIT_DEPTH_MIN-BIT_DEPTH_MAX)
+ * @return Level (0 to 2^bits - 1)
+ */
+static inline uint8_t bit_depth_quantize(uint8_t value, int bits) {
+    return value >> (8 - bits);
+}
+
+/**
+ * Expand a level to the middle of the 8-bit range it covers
+ * @param level Level (0 to 2^bits - 1)
+ * @param bits Depth (BIT_DEPTH_MIN-BIT_DEPTH_MAX)
+ * @return 8-bit pixel
+ */
+static inline uint8_t bit_depth_expand(uint8_t level, int bits) {
+    if (bits >= 8) {
+        return level;
+    }
+    return (uint8_t)((level << (8 - bits)) | (1 << (7 - bits)));
+}
+
+/**
+ * Send one pixel at a reduced depth and decode it
+ * @param value 8-bit pixel
+ * @param bits Depth (BIT_DEPTH_MIN-BIT_DEPTH_MAX)
+ * @param sample_divisor Receiver sampling rate divisor
+ * @param level Output: decoded level
+ * @param decode_us Output: time spent decoding (may be NULL)
+ * @return false on transfer failure
+ */
+bool bit_depth_transfer(uint8_t value, int bits, int sample_divisor, uint8_t *level, int64_t *decode_us);
+
+/**
+ * Transmit and reconstruct the first num_pixels of an image at a reduced depth
+ * @param reader Open reader positioned at the first pixel
+ * @param num_pixels Pixels to process
+ * @param bits Depth (BIT_DEPTH_MIN-BIT_DEPTH_MAX)
+ * @param sample_divisor Receiver sampling rate divisor
+ * @param reconstructed Output: num_pixels expanded 8-bit pixels
+ * @param stats Output: accuracy and timing
+ * @return false on invalid depth or transfer failure
+ */
+bool bit_depth_image(image_reader_t *reader, uint32_t num_pixels, int bits, int sample_divisor,
+                     uint8_t *reconstructed, bit_depth_stats_t *stats);
+
+/**
+ * PSNR of the expanded output against the 8-bit source
+ * @return dB, INFINITY if the output is exact
+ */
+float bit_depth_psnr(const bit_depth_stats_t *stats);
+
+/**
+ * Print the column header for bit_depth_print_stats()
+ */
+void bit_depth_print_header(void);
+
+/**
+ * Print one depth's results as a table row
+ */
+void bit_depth_print_stats(const bit_depth_stats_t *stats);
+
+#endif // BIT_DEPTH_H
@@ -0,0 +1,313 @@
+#include "coop_image.h"
+#include "gpio_control.h"
+#include "signal.h"
+#include "mem_stats.h"
+#include "startup.h"
+#include "pico/stdlib.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define RECORD_LEN (8 + 1)
+
+// DEBUG control: set to 1 to print the scheduler's per-task slices after a cooperative transfer
+#ifndef DEBUG
+#define DEBUG 0
+#endif
+
+// Pipeline state shared by the transmitter loop and the background tasks
+typedef struct {
+    image_reader_t *reader;
+    uint32_t num_pixels;
+    int sample_divisor;
+    FILE *sink;
+    uint8_t *reconstructed;
+
+    // Records received but not decoded: slots [decoded, received) modulo the queue
+    uint8_t records[COOP_IMAGE_QUEUE][RECORD_LEN];
+    uint8_t sent[COOP_IMAGE_QUEUE];
+    uint32_t received;
+    uint32_t decoded;
+    uint32_t correct;
+    uint8_t prediction;
+    float complex_values[41 * 2];   // Spectrum of the record being decoded
+    float magnitudes[41];
+    seeded_search_t search;
+
+    // IMAGE_DATA block: pixels [formatted, decoded) still to format
+    char log[COOP_IMAGE_LOG_SIZE];
+    int log_len;
+    uint32_t formatted;
+    bool header_done;
+    bool footer_done;
+
+    pt_t decode_pt;
+    pt_t format_pt;
+    pt_t drain_pt;
+} coop_image_t;
+
+/**
+ * Start decoding the oldest received record: its spectrum and the seeded
+ * search, seeded by the previous pixel
+ */
+static void decode_begin(coop_image_t *img) {
+    const int slot = img->decoded % COOP_IMAGE_QUEUE;
+    decode_pattern_spectrum(img->records[slot], img->sample_divisor, img->complex_values,
+                            img->magnitudes);
+    seeded_search_begin(&img->search, img->magnitudes, img->prediction);
+}
+
+/**
+ * Continue the search by up to max_candidates; stores the pixel once it is done
+ * @return true if the pixel was decoded
+ */
+static bool decode_step(coop_image_t *img, int max_candidates) {
+    if (!seeded_search_step(&img->search, img->magnitudes, max_candidates)) {
+        return false;
+    }
+    const int slot = img->decoded % COOP_IMAGE_QUEUE;
+    uint8_t value = seeded_search_finish(&img->search, img->complex_values);
+    img->reconstructed[img->decoded] = value;
+    img->correct += value == img->sent[slot];
+    img->prediction = value;
+    img->decoded++;
+    startup_first_pixel();
+    return true;
+}
+
+static void decode_one(coop_image_t *img) {
+    decode_begin(img);
+    while (!decode_step(img, COOP_IMAGE_MATCH_STEP)) {
+    }
+}
+
+static bool log_has_room(const coop_image_t *img) {
+    // One line of 16 pixels or the header / footer
+    return img->log_len + 16 * 3 + 64 <= COOP_IMAGE_LOG_SIZE;
+}
+
+/**
+ * Format the header, up to one line of decoded pixels or the footer
+ */
+static void format_some(coop_image_t *img) {
+    if (!img->header_done) {
+        img->log_len += snprintf(&img->log[img->log_len], COOP_IMAGE_LOG_SIZE - img->log_len,
+                                 "IMAGE_DATA_START\nWIDTH=%lu\nHEIGHT=%lu\nPIXELS=%lu\nDATA_HEX\n",
+                                 (unsigned long)img->reader->header.width,
+                                 (unsigned long)img->reader->header.height,
+                                 (unsigned long)img->num_pixels);
+        img->header_done = true;
+        return;
+    }
+    static const char hex[] = "0123456789ABCDEF";
+    int count = 0;
+    while (img->formatted < img->decoded && count < 16) {
+        uint8_t value = img->reconstructed[img->formatted++];
+        img->log[img->log_len++] = hex[value >> 4];
+        img->log[img->log_len++] = hex[value & 0xF];
+        img->log[img->log_len++] =
+            (img->formatted % 16 == 0 || img->formatted == img->num_pixels) ? '\n' : ' ';
+        count++;
+    }
+    if (count == 0 && img->formatted == img->num_pixels) {
+        img->log_len += snprintf(&img->log[img->log_len], COOP_IMAGE_LOG_SIZE - img->log_len,
+                                 "IMAGE_DATA_END\n");
+        img->footer_done = true;
+    }
+}
+
+static bool format_has_work(const coop_image_t *img) {
+    return !img->header_done || img->formatted < img->decoded ||
+           (img->formatted == img->num_pixels && !img->footer_done);
+}
+
+/**
+ * Write one chunk of the formatted output
+ */
+static void drain_chunk(coop_image_t *img) {
+    int len = img->log_len < COOP_IMAGE_DRAIN_CHUNK ? img->log_len : COOP_IMAGE_DRAIN_CHUNK;
+    if (img->sink) {
+        fwrite(img->log, 1, len, img->sink);
+    }
+    memmove(img->log, &img->log[len], img->log_len - len);
+    img->log_len -= len;
+}
+
+static bool drain_has_work(const coop_image_t *img) {
+    return img->log_len >= COOP_IMAGE_DRAIN_CHUNK || (img->footer_done && img->log_len > 0);
+}
+
+// ---- Background protothreads ----
+
+static int decode_task(void *arg) {
+    coop_image_t *img = arg;
+    PT_BEGIN(&img->decode_pt);
+    while (true) {
+        // A whole seeded search does not fit the shorter link waits: a slice
+        // evaluates about COOP_IMAGE_MATCH_STEP candidates
+        PT_WAIT_UNTIL(&img->decode_pt, img->decoded < img->received);
+        decode_begin(img);
+        PT_YIELD(&img->decode_pt);
+        while (!decode_step(img, COOP_IMAGE_MATCH_STEP)) {
+            PT_YIELD(&img->decode_pt);
+        }
+        PT_YIELD(&img->decode_pt);
+    }
+    PT_END(&img->decode_pt);
+}
+
+static int format_task(void *arg) {
+    coop_image_t *img = arg;
+    PT_BEGIN(&img->format_pt);
+    while (true) {
+        PT_WAIT_UNTIL(&img->format_pt, format_has_work(img) && log_has_room(img));
+        format_some(img);
+        PT_YIELD(&img->format_pt);
+    }
+    PT_END(&img->format_pt);
+}
+
+static int drain_task(void *arg) {
+    coop_image_t *img = arg;
+    PT_BEGIN(&img->drain_pt);
+    while (true) {
+        PT_WAIT_UNTIL(&img->drain_pt, drain_has_work(img));
+        drain_chunk(img);
+        PT_YIELD(&img->drain_pt);
+    }
+    PT_END(&img->drain_pt);
+}
+
+// ---- Transfers ----
+
+static bool transfer_blocking(coop_image_t *img, coop_image_stats_t *stats) {
+    for (uint32_t i = 0; i < img->num_pixels; i++) {
+        const int slot = img->received % COOP_IMAGE_QUEUE;
+        if (image_reader_read(img->reader, &img->sent[slot], 1) != 1) {
+            return false;
+        }
+        uint64_t link_start = time_us_64();
+        uint8_t *bits_recv = send_receive_data(img->sent[slot], 8, (uint8_t)img->sample_divisor);
+        stats->idle_us += time_us_64() - link_start;
+        if (!bits_recv) {
+            return false;
+        }
+        memcpy(img->records[slot], bits_recv, RECORD_LEN);
+        MEM_FREE(bits_recv);
+        img->received++;
+
+        uint64_t work_start = time_us_64();
+        decode_one(img);
+        while (format_has_work(img) && log_has_room(img)) {
+            format_some(img);
+            while (drain_has_work(img)) {
+                drain_chunk(img);
+            }
+        }
+        stats->busy_us += time_us_64() - work_start;
+    }
+    return true;
+}
+
+static bool transfer_cooperative(coop_image_t *img, coop_image_stats_t *stats) {
+    coop_sched_t sched;
+    coop_sched_init(&sched, COOP_GUARD_US);
+    coop_sched_add(&sched, "decode", decode_task, img);
+    coop_sched_add(&sched, "format", format_task, img);
+    coop_sched_add(&sched, "drain", drain_task, img);
+
+    link_tx_t tx;
+    for (uint32_t i = 0; i < img->num_pixels; i++) {
+        // Decoder behind by a full queue: let it catch up before reusing a slot
+        while (img->received - img->decoded >= COOP_IMAGE_QUEUE) {
+            coop_sched_step(&sched);
+        }
+        // A task that had no work yet gets its first slice here, where no edge is pending
+        coop_sched_measure(&sched);
+        const int slot = img->received % COOP_IMAGE_QUEUE;
+        if (image_reader_read(img->reader, &img->sent[slot], 1) != 1 ||
+            !link_tx_begin(&tx, img->sent[slot], 8, (uint8_t)img->sample_divisor, 1, img->records[slot])) {
+            return false;
+        }
+        coop_sched_run(&sched, link_tx_run, &tx, &tx.wake_us);
+        img->received++;
+    }
+
+    // Finish the work still queued
+    while (img->decoded < img->received || !img->footer_done || img->log_len > 0) {
+        if (!coop_sched_step(&sched)) {
+            break;
+        }
+    }
+
+    stats->busy_us = sched.busy_us;
+    stats->idle_us = sched.idle_us;
+    stats->late_edges = sched.late_edges;
+    stats->max_late_us = sched.max_late_us;
+#if DEBUG
+    coop_sched_print_stats(&sched);
+#endif
+    return true;
+}
+
+bool coop_image_transfer(image_reader_t *reader, uint32_t num_pixels, int sample_divisor,
+                         bool cooperative, FILE *sink, uint8_t *reconstructed,
+                         coop_image_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->cooperative = cooperative;
+
+    coop_image_t *img = MEM_CALLOC(1, sizeof(coop_image_t));
+    if (!img) {
+        printf("Error: out of memory for the image pipeline\n");
+        return false;
+    }
+    img->reader = reader;
+    img->num_pixels = num_pixels;
+    img->sample_divisor = sample_divisor;
+    img->sink = sink;
+    img->reconstructed = reconstructed;
+
+    // Matcher tables are otherwise built by the first decode slice, far longer than any link wait
+    startup_tables_wait();
+    init_matcher_tables();
+
+    absolute_time_t start_time = get_absolute_time();
+    bool ok = cooperative ? transfer_cooperative(img, stats) : transfer_blocking(img, stats);
+    // Blocking: the last lines once every pixel is in
+    while (ok && (format_has_work(img) || img->log_len > 0)) {
+        uint64_t work_start = time_us_64();
+        if (format_has_work(img)) {
+            format_some(img);
+        }
+        drain_chunk(img);
+        stats->busy_us += time_us_64() - work_start;
+    }
+    if (sink) {
+        fflush(sink);
+    }
+    stats->time_us = absolute_time_diff_us(start_time, get_absolute_time());
+    stats->pixels = img->decoded;
+    stats->correct = img->correct;
+    MEM_FREE(img);
+    return ok;
+}
+
+void coop_image_print_header(void) {
+    printf("%-12s %8s %10s %12s %10s %8s %12s\n", "Mode", "Pixels", "Correct", "Time (ms)",
+           "Pixels/s", "Core0", "Late edges");
+}
+
+void coop_image_print_stats(const coop_image_stats_t *stats) {
+    uint64_t total = stats->busy_us + stats->idle_us;
+    char late[32];
+    if (stats->cooperative) {
+        snprintf(late, sizeof(late), "%lu (max %lu us)", (unsigned long)stats->late_edges,
+                 (unsigned long)stats->max_late_us);
+    } else {
+        snprintf(late, sizeof(late), "-");
+    }
+    printf("%-12s %8lu %9.2f%% %12.2f %10.1f %7.1f%% %12s\n",
+           stats->cooperative ? "cooperative" : "blocking", (unsigned long)stats->pixels,
+           stats->pixels ? 100.0f * stats->correct / stats->pixels : 0.0f, stats->time_us / 1000.0f,
+           stats->time_us > 0 ? stats->pixels * 1000000.0f / stats->time_us : 0.0f,
+           total > 0 ? 100.0f * stats->busy_us / total : 0.0f, late);
+}
@@ -0,0 +1,57 @@
+#ifndef COOP_IMAGE_H
+#define COOP_IMAGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "image_asset.h"
+#include "coop_sched.h"
+
+// Image transfer with the link waits put to use. Per pixel the work is: send
+// and receive (link_tx_t), match the received record (seeded by the previous
+// pixel), format it into the IMAGE_DATA output block and drain that block to
+// the output. Blocking runs them one after the other; cooperative runs the
+// transmitter under coop_sched_run() with the other three as background
+// protothreads in its waits, decoding pixel n while pixel n+1 is on the wire.
+#define COOP_IMAGE_QUEUE 4          // Received records waiting for the decoder
+#define COOP_IMAGE_LOG_SIZE 1024    // Formatted output waiting to be drained
+#define COOP_IMAGE_DRAIN_CHUNK 128  // Bytes written per drain slice
+#define COOP_IMAGE_MATCH_STEP 8     // Seeded search candidates per decode slice
+
+typedef struct {
+    bool cooperative;
+    uint32_t pixels;
+    uint32_t correct;           // Decoded as sent
+    int64_t time_us;            // Whole transfer, output drained
+    uint64_t busy_us;           // Core0 working (decode, format, drain, edges)
+    uint64_t idle_us;           // Core0 waiting on the link
+    uint32_t late_edges;        // Cooperative: edges later than the guard time
+    uint32_t max_late_us;
+} coop_image_stats_t;
+
+/**
+ * Transmit, decode and print the first num_pixels of an image
+ * @param reader Open reader positioned at the first pixel
+ * @param num_pixels Pixels to process
+ * @param sample_divisor Receiver sampling rate divisor
+ * @param cooperative Run decode, format and drain in the transmitter's waits
+ * @param sink Output for the IMAGE_DATA block (NULL: formatted, then discarded)
+ * @param reconstructed Output: num_pixels decoded pixels
+ * @param stats Output: accuracy, time and Core0 utilization
+ * @return false on transfer failure
+ */
+bool coop_image_transfer(image_reader_t *reader, uint32_t num_pixels, int sample_divisor,
+                         bool cooperative, FILE *sink, uint8_t *reconstructed,
+                         coop_image_stats_t *stats);
+
+/**
+ * Print the column header for coop_image_print_stats()
+ */
+void coop_image_print_header(void);
+
+/**
+ * Print one run's results as a table row
+ */
+void coop_image_print_stats(const coop_image_stats_t *stats);
+
+#endif // COOP_IMAGE_H
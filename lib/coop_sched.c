@@ -0,0 +1,150 @@
+#include "coop_sched.h"
+#include "pico/stdlib.h"
+#include <stdio.h>
+#include <string.h>
+
+void coop_sched_init(coop_sched_t *sched, uint32_t guard_us) {
+    memset(sched, 0, sizeof(*sched));
+    sched->guard_us = guard_us;
+}
+
+bool coop_sched_add(coop_sched_t *sched, const char *name, coop_task_fn fn, void *ctx) {
+    if (sched->num_tasks >= COOP_MAX_TASKS) {
+        printf("Error: at most %d cooperative tasks\n", COOP_MAX_TASKS);
+        return false;
+    }
+    coop_task_t *task = &sched->tasks[sched->num_tasks++];
+    memset(task, 0, sizeof(*task));
+    task->name = name;
+    task->fn = fn;
+    task->ctx = ctx;
+    return true;
+}
+
+/**
+ * Run one slice of a task
+ * @return false if the task was waiting (did no work)
+ */
+static bool run_slice(coop_sched_t *sched, coop_task_t *task) {
+    uint64_t start = time_us_64();
+    int state = task->fn(task->ctx);
+    uint32_t elapsed = (uint32_t)(time_us_64() - start);
+    sched->busy_us += elapsed;
+    if (state == PT_WAITING) {
+        return false;
+    }
+    task->busy_us += elapsed;
+    task->slices++;
+    // Recent longest slice: jumps up at once, decays slowly after an outlier
+    if (elapsed > task->worst_us) {
+        task->worst_us = elapsed;
+    } else {
+        task->worst_us -= (task->worst_us - elapsed) / 256;
+    }
+    return true;
+}
+
+/**
+ * One background slice that fits before the deadline, round-robin
+ * @return false if no task had work that fits
+ */
+static bool run_background(coop_sched_t *sched, uint64_t deadline_us) {
+    for (int n = 0; n < sched->num_tasks; n++) {
+        int index = (sched->next + n) % sched->num_tasks;
+        coop_task_t *task = &sched->tasks[index];
+        if (deadline_us != UINT64_MAX &&
+            (!task->measured || time_us_64() + task->worst_us + sched->guard_us > deadline_us)) {
+            sched->deferred++;
+            continue;
+        }
+        sched->ran_since_edge = true;
+        if (run_slice(sched, task)) {
+            sched->next = index + 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+void coop_sched_run(coop_sched_t *sched, coop_task_fn fn, void *ctx, const uint64_t *wake_us) {
+    // Slices before the run (coop_sched_step()) were not in its waits
+    sched->ran_since_edge = false;
+    while (true) {
+        uint64_t now = time_us_64();
+        if (now >= *wake_us) {
+            // Only count edges a background slice ran into: the thread's own steps and
+            // wakeups delay it in blocking mode too
+            if (sched->ran_since_edge) {
+                uint32_t late = (uint32_t)(now - *wake_us);
+                if (late > sched->max_late_us) {
+                    sched->max_late_us = late;
+                }
+                if (late > sched->guard_us) {
+                    sched->late_edges++;
+                }
+            }
+            sched->ran_since_edge = false;
+            sched->edges++;
+            int state = fn(ctx);
+            sched->busy_us += time_us_64() - now;
+            if (state == PT_ENDED) {
+                return;
+            }
+            continue;
+        }
+
+        // Nothing fits before the edge: wait for it
+        if (!run_background(sched, *wake_us)) {
+            now = time_us_64();
+            if (now < *wake_us) {
+                sleep_us(*wake_us - now);
+                sched->idle_us += time_us_64() - now;
+            }
+            sched->ran_since_edge = false;
+        }
+    }
+}
+
+bool coop_sched_step(coop_sched_t *sched) {
+    return run_background(sched, UINT64_MAX);
+}
+
+void coop_sched_measure(coop_sched_t *sched) {
+    for (int i = 0; i < sched->num_tasks; i++) {
+        coop_task_t *task = &sched->tasks[i];
+        if (task->measured) {
+            continue;
+        }
+        // All the work it has, so the first estimate covers each kind of slice
+        while (run_slice(sched, task)) {
+        }
+        task->measured = task->slices > 0;
+    }
+}
+
+void coop_sched_reset_stats(coop_sched_t *sched) {
+    sched->busy_us = 0;
+    sched->idle_us = 0;
+    sched->edges = 0;
+    sched->late_edges = 0;
+    sched->max_late_us = 0;
+    sched->deferred = 0;
+    for (int i = 0; i < sched->num_tasks; i++) {
+        sched->tasks[i].busy_us = 0;
+        sched->tasks[i].slices = 0;
+    }
+}
+
+void coop_sched_print_stats(const coop_sched_t *sched) {
+    uint64_t total = sched->busy_us + sched->idle_us;
+    printf("Core0 busy %.2f ms (%.1f%%), idle %.2f ms; edges %lu, late %lu (max %lu us), deferred slices %lu\n",
+           sched->busy_us / 1000.0f, total > 0 ? 100.0f * sched->busy_us / total : 0.0f,
+           sched->idle_us / 1000.0f, (unsigned long)sched->edges, (unsigned long)sched->late_edges,
+           (unsigned long)sched->max_late_us, (unsigned long)sched->deferred);
+    printf("  %-10s %8s %10s %9s\n", "task", "slices", "busy (ms)", "worst us");
+    for (int i = 0; i < sched->num_tasks; i++) {
+        const coop_task_t *task = &sched->tasks[i];
+        printf("  %-10s %8lu %10.2f %9lu\n", task->name, (unsigned long)task->slices,
+               task->busy_us / 1000.0f, (unsigned long)task->worst_us);
+    }
+}
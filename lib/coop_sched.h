@@ -0,0 +1,97 @@
+#ifndef COOP_SCHED_H
+#define COOP_SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pt.h"
+
+// Cooperative scheduler for Core0. One timing-critical protothread (the link
+// transmitter) sets the time of its next edge; until then the scheduler runs
+// background protothreads round-robin, a slice at a time. A slice only starts
+// if its task's recent longest slice plus the guard time ends before the
+// edge, so background work delays an edge only when a slice runs longer
+// than any recent one. A task's first slices run from coop_sched_measure(),
+// outside the waits: until then its slice length is unknown.
+#define COOP_MAX_TASKS 6
+#define COOP_GUARD_US 2
+
+typedef int (*coop_task_fn)(void *ctx);   // Protothread body, returns PT_*
+
+typedef struct {
+    const char *name;
+    coop_task_fn fn;
+    void *ctx;
+    uint32_t worst_us;      // Recent longest slice
+    bool measured;          // worst_us is known: the task may run in the waits
+    uint64_t busy_us;       // Time in slices that did work
+    uint32_t slices;        // Slices that did work
+} coop_task_t;
+
+typedef struct {
+    coop_task_t tasks[COOP_MAX_TASKS];
+    int num_tasks;
+    int next;                   // Round-robin position
+    uint32_t guard_us;
+    uint64_t busy_us;           // Background slices and timing-critical steps
+    uint64_t idle_us;           // Waiting for an edge with nothing that fits
+    uint32_t edges;             // Timing-critical steps run
+    uint32_t late_edges;        // Started more than the guard time after their deadline
+                                // because a background slice ran into them
+    uint32_t max_late_us;
+    uint32_t deferred;          // Slices held back because they would not fit before an edge
+    bool ran_since_edge;
+} coop_sched_t;
+
+/**
+ * Initialize an empty scheduler
+ * @param sched Scheduler
+ * @param guard_us Margin kept free before each edge (COOP_GUARD_US)
+ */
+void coop_sched_init(coop_sched_t *sched, uint32_t guard_us);
+
+/**
+ * Add a background protothread
+ * @param sched Scheduler
+ * @param name Task name (string literal, kept by reference)
+ * @param fn Protothread body; PT_WAITING means it had nothing to do
+ * @param ctx Passed to fn
+ * @return false if the task table is full
+ */
+bool coop_sched_add(coop_sched_t *sched, const char *name, coop_task_fn fn, void *ctx);
+
+/**
+ * Run a timing-critical protothread to completion, filling its waits with
+ * background slices. The thread is stepped once time reaches *wake_us and
+ * sets *wake_us to its next deadline before returning PT_WAITING.
+ * @param sched Scheduler
+ * @param fn Timing-critical protothread body
+ * @param ctx Passed to fn
+ * @param wake_us Deadline of the thread's next step (time_us_64())
+ */
+void coop_sched_run(coop_sched_t *sched, coop_task_fn fn, void *ctx, const uint64_t *wake_us);
+
+/**
+ * Run one background slice with no deadline (between the timing-critical
+ * thread's runs, where no edge is pending)
+ * @return false if every task was waiting (nothing to do)
+ */
+bool coop_sched_step(coop_sched_t *sched);
+
+/**
+ * Run each task not measured yet until it has no work, with no deadline, so
+ * it can run in the next coop_sched_run()'s waits; a task that had no work
+ * stays unmeasured
+ */
+void coop_sched_measure(coop_sched_t *sched);
+
+/**
+ * Reset the time and edge counters (task slice estimates are kept)
+ */
+void coop_sched_reset_stats(coop_sched_t *sched);
+
+/**
+ * Print busy/idle time, edge lateness and per-task slices
+ */
+void coop_sched_print_stats(const coop_sched_t *sched);
+
+#endif // COOP_SCHED_H
@@ -0,0 +1,92 @@
+#ifndef CT_MATH_HPP
+#define CT_MATH_HPP
+
+// Compile-time trigonometry for twiddle factors and lookup tables.
+// Angles are given as exact rational multiples of π so range reduction is
+// done in integers; the series then only ever sees |x| <= π.
+
+namespace ct {
+
+constexpr double kPi = 3.14159265358979323846;
+
+constexpr double sin_series(double x) {
+    double term = x;
+    double sum = x;
+    for (int i = 1; i < 20; i++) {
+        term *= -x * x / ((2.0 * i) * (2.0 * i + 1.0));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double cos_series(double x) {
+    double term = 1.0;
+    double sum = 1.0;
+    for (int i = 1; i < 20; i++) {
+        term *= -x * x / ((2.0 * i - 1.0) * (2.0 * i));
+        sum += term;
+    }
+    return sum;
+}
+
+// Reduce π*num/den to an angle in (-π, π]
+constexpr double reduce_pi_ratio(long num, long den) {
+    long period = 2 * den;
+    long r = num % period;
+    if (r < 0) r += period;
+    if (r > den) r -= period;
+    return kPi * (double)r / (double)den;
+}
+
+// sin(π * num / den)
+constexpr double sin_pi_ratio(long num, long den) {
+    return sin_series(reduce_pi_ratio(num, den));
+}
+
+// cos(π * num / den)
+constexpr double cos_pi_ratio(long num, long den) {
+    return cos_series(reduce_pi_ratio(num, den));
+}
+
+constexpr double abs(double x) {
+    return x < 0.0 ? -x : x;
+}
+
+constexpr double sqrt(double x) {
+    if (x <= 0.0) return 0.0;
+    double r = x > 1.0 ? x : 1.0;
+    for (int i = 0; i < 200; i++) {
+        double next = 0.5 * (r + x / r);
+        if (next >= r) break;  // Newton from above decreases monotonically
+        r = next;
+    }
+    return r;
+}
+
+// atan(x) for |x| <= 1: two half-angle steps bring |x| below tan(π/16)
+constexpr double atan_unit(double x) {
+    for (int i = 0; i < 2; i++) {
+        x = x / (1.0 + sqrt(1.0 + x * x));
+    }
+    double x2 = x * x;
+    double term = x;
+    double sum = x;
+    for (int i = 1; i < 30; i++) {
+        term *= -x2;
+        sum += term / (2.0 * i + 1.0);
+    }
+    return 4.0 * sum;
+}
+
+// atan2 with the usual quadrant conventions, atan2(0, 0) = 0
+constexpr double atan2(double y, double x) {
+    if (x == 0.0 && y == 0.0) return 0.0;
+    double angle = abs(y) <= abs(x) ? atan_unit(abs(y) / abs(x))
+                                    : kPi / 2.0 - atan_unit(abs(x) / abs(y));
+    if (x < 0.0) angle = kPi - angle;
+    return y < 0.0 ? -angle : angle;
+}
+
+} // namespace ct
+
+#endif // CT_MATH_HPP
@@ -1,5 +1,7 @@
 #include "dtft.h"
 #include "lut.h"
+#include "dtft_fixed.h"
+#include "mem_stats.h"
 #include <stdlib.h>
 #include <math.h>
 #include "pico/multicore.h"
@@ -7,15 +9,27 @@
 
 // Global Core1 parameters
 static core1_dtft_params_t core1_params;
+static bool core1_launched = false;
 
-// Core1 worker function for parallel DTFT computation
-static void core1_dtft_worker(void) {
+// Core1 worker loop for parallel DTFT computation; not inlined into
+// core1_dtft_worker(), so its frame is below the stack watermark
+static void __attribute__((noinline)) core1_dtft_loop(void) {
     while (true) {
         // Wait for work (with memory barrier)
-        while (!core1_params.signal) {
+        while (!core1_params.signal && !core1_params.job) {
             __dmb();  // Data memory barrier to ensure we see Core0's write
             tight_loop_contents();
         }
+
+        // Generic job (core1_run)
+        if (core1_params.job) {
+            __dmb();
+            core1_params.job(core1_params.job_arg);
+            __dmb();
+            core1_params.job = NULL;
+            core1_params.done = true;
+            continue;
+        }
         
         const float omega_scale = (2.0f * M_PI) / core1_params.num_points;
         
@@ -89,87 +103,41 @@ static void core1_dtft_worker(void) {
     }
 }
 
+static void core1_dtft_worker(void) {
+    mem_stack_paint();  // Core1's stack watermark (mem_stats.h)
+    core1_dtft_loop();
+}
+
 void init_core1_dtft(void) {
     core1_params.signal = NULL;
+    core1_params.job = NULL;
     core1_params.done = true;
     multicore_launch_core1(core1_dtft_worker);
+    core1_launched = true;
 }
 
-float compute_dtft_magnitude(uint8_t * restrict x, int N, float omega) {
-    float real_part = 0.0f;
-    float imag_part = 0.0f;
-    float angle = 0.0f;
-    const float neg_omega = -omega;
-    
-    // Loop unrolling (8x)
-    int n = 0;
-    int N_unroll = N & ~7;
-    
-    for (; n < N_unroll; n += 8) {
-        // Prefetch ahead to improve cache performance
-        __builtin_prefetch(&x[n + 16], 0, 3);
-        
-        float angle1 = angle;
-        float angle2 = angle + neg_omega;
-        float angle3 = angle + 2.0f * neg_omega;
-        float angle4 = angle + 3.0f * neg_omega;
-        float angle5 = angle + 4.0f * neg_omega;
-        float angle6 = angle + 5.0f * neg_omega;
-        float angle7 = angle + 6.0f * neg_omega;
-        float angle8 = angle + 7.0f * neg_omega;
-        
-        float cos1 = fast_cos(angle1);
-        float sin1 = fast_sin(angle1);
-        float cos2 = fast_cos(angle2);
-        float sin2 = fast_sin(angle2);
-        float cos3 = fast_cos(angle3);
-        float sin3 = fast_sin(angle3);
-        float cos4 = fast_cos(angle4);
-        float sin4 = fast_sin(angle4);
-        float cos5 = fast_cos(angle5);
-        float sin5 = fast_sin(angle5);
-        float cos6 = fast_cos(angle6);
-        float sin6 = fast_sin(angle6);
-        float cos7 = fast_cos(angle7);
-        float sin7 = fast_sin(angle7);
-        float cos8 = fast_cos(angle8);
-        float sin8 = fast_sin(angle8);
-        
-        real_part += x[n]   * cos1 + x[n+1] * cos2 + x[n+2] * cos3 + x[n+3] * cos4 +
-                     x[n+4] * cos5 + x[n+5] * cos6 + x[n+6] * cos7 + x[n+7] * cos8;
-        imag_part += x[n]   * sin1 + x[n+1] * sin2 + x[n+2] * sin3 + x[n+3] * sin4 +
-                     x[n+4] * sin5 + x[n+5] * sin6 + x[n+6] * sin7 + x[n+7] * sin8;
-        
-        angle += 8.0f * neg_omega;
+bool core1_run(void (*job)(void *), void *arg) {
+    if (!core1_launched) {
+        return false;
     }
-    
-    // Handle remaining samples
-    for (; n < N; n++) {
-        real_part += x[n] * fast_cos(angle);
-        imag_part += x[n] * fast_sin(angle);
-        angle += neg_omega;
-    }
-    
-    return sqrtf(real_part * real_part + imag_part * imag_part);
+    core1_wait();  // One job at a time (a startup job may still be running)
+    core1_params.job_arg = arg;
+    core1_params.done = false;
+    __dmb();  // Memory barrier before signaling
+    core1_params.job = job;  // This triggers Core1 to start
+    return true;
 }
 
-float* calculate_dtft(uint8_t * restrict x, int N, int num_points) {
-    float *magnitudes = malloc(num_points * sizeof(float));
-    if (!magnitudes) {
-        return NULL;
-    }
-
-    const float omega_scale = (2.0f * M_PI) / num_points;
-    for (int k = 0; k < num_points; k++) {
-        float omega = omega_scale * k;  // 0 to 2*pi
-        magnitudes[k] = compute_dtft_magnitude(x, N, omega);
+void core1_wait(void) {
+    while (!core1_params.done) {
+        __dmb();  // Memory barrier to see Core1's update
+        tight_loop_contents();
     }
-
-    return magnitudes;
+    __dmb();  // Ensure we see all of Core1's writes
 }
 
 float* calculate_dtft_complex(uint8_t * restrict x, int N, int num_points) {
-    float *complex_values = malloc(num_points * 2 * sizeof(float));
+    float *complex_values = MEM_MALLOC(num_points * 2 * sizeof(float));
     if (!complex_values) {
         return NULL;
     }
@@ -177,7 +145,8 @@ float* calculate_dtft_complex(uint8_t * restrict x, int N, int num_points) {
     // Split work between cores: Core0 handles first half, Core1 handles second half
     int split_point = num_points / 2;
     
-    // Launch Core1 work
+    // Launch Core1 work once it is idle
+    core1_wait();
     core1_params.signal_len = N;
     core1_params.start_freq = split_point;
     core1_params.end_freq = num_points;
@@ -260,3 +229,143 @@ float* calculate_dtft_complex(uint8_t * restrict x, int N, int num_points) {
 
     return complex_values;
 }
+
+void calculate_dtft_repeated(const uint8_t *pattern, int pattern_len, int repetitions,
+                             int num_bins, float *output) {
+    if (dtft_fixed_repeated(pattern, pattern_len, repetitions, num_bins, output)) {
+        return;
+    }
+
+    // Generic path: any size, evaluated sample by sample over the repeated signal
+    const int total_len = pattern_len * repetitions;
+    for (int k = 0; k < num_bins; k++) {
+        float omega = (M_PI * k) / (num_bins - 1);
+        float real_part = 0.0f;
+        float imag_part = 0.0f;
+
+        for (int n = 0; n < total_len; n++) {
+            float angle = -omega * n;
+            uint8_t x = pattern[n % pattern_len];
+            real_part += x * cosf(angle);
+            imag_part += x * sinf(angle);
+        }
+
+        output[2*k] = real_part;
+        output[2*k + 1] = imag_part;
+    }
+}
+
+/**
+ * Σ_{i<len} e^{-jπ·i·num/den} in closed form, e^{-jπ(len-1)num/2den}·sin(π·len·num/2den)/sin(π·num/2den)
+ * (len when the denominator is zero: every term is 1)
+ */
+static void geometric_sum(long num, long den, int len, double *re, double *im) {
+    const double half_angle = M_PI * (double)(num % (2 * den)) / (2.0 * den);
+    double ratio = len;
+    if (num % (2 * den) != 0) {
+        ratio = sin(half_angle * len) / sin(half_angle);
+    }
+    *re = ratio * cos(half_angle * (len - 1));
+    *im = -ratio * sin(half_angle * (len - 1));
+}
+
+/**
+ * Factor F_k[m] of sample m at bin k
+ */
+static void zoh_factor(int pattern_len, int hold, int repetitions, int num_bins, int k, int m,
+                       float *re, float *im) {
+    // ω_k = πk/(num_bins-1); sample m is held over [m*hold, min((m+1)*hold, pattern_len))
+    const long den = num_bins - 1;
+    const int box_len = pattern_len - m * hold < hold ? pattern_len - m * hold : hold;
+    double box_re, box_im, gain_re, gain_im;
+    geometric_sum(k, den, box_len, &box_re, &box_im);
+    geometric_sum((long)k * pattern_len, den, repetitions, &gain_re, &gain_im);
+
+    const double angle = M_PI * (double)(((long)k * m * hold) % (2 * den)) / den;
+    const double shift_re = cos(angle);
+    const double shift_im = -sin(angle);
+    const double hg_re = box_re * gain_re - box_im * gain_im;
+    const double hg_im = box_re * gain_im + box_im * gain_re;
+    *re = (float)(shift_re * hg_re - shift_im * hg_im);
+    *im = (float)(shift_re * hg_im + shift_im * hg_re);
+}
+
+/**
+ * Repetition gain Σ_r e^{-jω_k·pattern_len·r} is zero (sin(ω·pattern_len·R/2) = 0
+ * while sin(ω·pattern_len/2) is not)
+ */
+static bool zoh_gain_is_zero(int pattern_len, int repetitions, int num_bins, int k) {
+    const long period = 2L * (num_bins - 1);
+    return ((long)k * pattern_len) % period != 0 && ((long)k * pattern_len * repetitions) % period == 0;
+}
+
+/**
+ * One bin of the sample-and-hold DTFT in closed form
+ * Sample m is held over [m*hold, min((m+1)*hold, pattern_len)): full boxes
+ * share H_k, so their factors are one phase step e^{-jω_k·hold} apart, and
+ * only a partial last box needs its own. Bins whose repetition gain is zero
+ * are skipped (with 10 repetitions of 8 samples on 41 bins, 36 of them).
+ */
+static void zoh_bin_generic(const uint8_t *samples, int pattern_len, int hold, int repetitions,
+                            int num_bins, int k, float *output) {
+    output[0] = 0.0f;
+    output[1] = 0.0f;
+    if (zoh_gain_is_zero(pattern_len, repetitions, num_bins, k)) {
+        return;
+    }
+
+    const int num_full = pattern_len / hold;
+    const double angle = M_PI * (double)(((long)k * hold) % (2L * (num_bins - 1))) / (num_bins - 1);
+    const double step_re = cos(angle);
+    const double step_im = -sin(angle);
+    double phase_re = 1.0, phase_im = 0.0;
+    double sum_re = 0.0, sum_im = 0.0;
+    for (int m = 0; m < num_full; m++) {
+        if (samples[m]) {
+            sum_re += phase_re;
+            sum_im += phase_im;
+        }
+        const double re = phase_re * step_re - phase_im * step_im;
+        phase_im = phase_re * step_im + phase_im * step_re;
+        phase_re = re;
+    }
+
+    if (num_full > 0) {
+        // H_k·G_k from sample 0's factor (a full box at phase 1)
+        float hg_re, hg_im;
+        zoh_factor(pattern_len, hold, repetitions, num_bins, k, 0, &hg_re, &hg_im);
+        output[0] = (float)(sum_re * hg_re - sum_im * hg_im);
+        output[1] = (float)(sum_re * hg_im + sum_im * hg_re);
+    }
+    if (num_full * hold < pattern_len && samples[num_full]) {
+        float re, im;
+        zoh_factor(pattern_len, hold, repetitions, num_bins, k, num_full, &re, &im);
+        output[0] += re;
+        output[1] += im;
+    }
+}
+
+void calculate_dtft_zoh(const uint8_t *samples, int pattern_len, int hold, int repetitions,
+                        int num_bins, float *output) {
+    if (hold <= 1) {
+        calculate_dtft_repeated(samples, pattern_len, repetitions, num_bins, output);
+        return;
+    }
+    if (dtft_fixed_zoh(samples, pattern_len, hold, repetitions, num_bins, output)) {
+        return;
+    }
+
+    // Generic path, bin by bin
+    for (int k = 0; k < num_bins; k++) {
+        zoh_bin_generic(samples, pattern_len, hold, repetitions, num_bins, k, &output[2*k]);
+    }
+}
+
+void calculate_dtft_bin(const uint8_t *samples, int pattern_len, int hold, int repetitions,
+                        int num_bins, int k, float *output) {
+    if (hold < 1) hold = 1;
+    if (dtft_fixed_bin(samples, pattern_len, hold, repetitions, num_bins, k, output)) {
+        return;
+    }
+    zoh_bin_generic(samples, pattern_len, hold, repetitions, num_bins, k, output);
+}
@@ -12,6 +12,8 @@ typedef struct {
     int end_freq;
     int num_points;
     float *output;
+    void (*volatile job)(void *);   // Generic work item (core1_run())
+    void *job_arg;
     volatile bool done;
 } core1_dtft_params_t;
 
@@ -21,6 +23,19 @@ typedef struct {
  */
 void init_core1_dtft(void);
 
+/**
+ * Run a function on Core1 while Core0 keeps working
+ * @param job Function to run
+ * @param arg Passed to job
+ * @return false if the Core1 worker is not running (init_core1_dtft() not called)
+ */
+bool core1_run(void (*job)(void *), void *arg);
+
+/**
+ * Wait for the job started with core1_run() to finish
+ */
+void core1_wait(void);
+
 /**
  * Compute DTFT magnitude at a specific frequency (optimized)
  * @param x Input signal array
@@ -35,17 +50,86 @@ float compute_dtft_magnitude(uint8_t * restrict x, int N, float omega);
  * @param x Input signal array
  * @param N Length of signal
  * @param num_points Number of frequency points to compute
- * @return Array of magnitudes (caller must free)
+ * @return Array of magnitudes (caller frees with MEM_FREE())
  */
 float* calculate_dtft(uint8_t * restrict x, int N, int num_points);
 
+/**
+ * compute_dtft_magnitude() of a 0/1 signal given as packed bits
+ * Visits only the set bits (count leading zeros per byte), so the cost
+ * scales with the number of ones. Same twiddles and summation order as the
+ * dense kernel, and both are built with -fno-associative-math
+ * (dtft_kernel.c), so the results are bit-identical.
+ * Bits are packed MSB first: sample n is (bits[n / 8] >> (7 - n % 8)) & 1.
+ * @param bits Packed signal ((N + 7) / 8 bytes)
+ * @param N Length of signal in samples
+ * @param omega Normalized frequency (radians/sample, 0 to 2*pi)
+ * @return Magnitude of DTFT at that frequency
+ */
+float compute_dtft_magnitude_bits(const uint8_t *bits, int N, float omega);
+
+/**
+ * calculate_dtft() of a 0/1 signal given as packed bits (MSB first)
+ * Uses compute_dtft_magnitude_bits(), or unpacks the signal and runs the dense
+ * kernel when more than DTFT_BITS_DENSE_PERCENT (dtft_kernel.c) of the bits
+ * are set.
+ * @param bits Packed signal ((N + 7) / 8 bytes)
+ * @param N Length of signal in samples
+ * @param num_points Number of frequency points to compute
+ * @return Array of magnitudes (caller frees with MEM_FREE())
+ */
+float* calculate_dtft_bits(const uint8_t *bits, int N, int num_points);
+
 /**
  * Compute DTFT with both magnitude and phase (dual-core optimized version)
  * @param x Input signal array
  * @param N Length of signal
  * @param num_points Number of frequency points to compute
- * @return Array of complex values [real1, imag1, real2, imag2, ...] (caller must free)
+ * @return Array of complex values [real1, imag1, real2, imag2, ...] (caller frees with MEM_FREE())
  */
 float* calculate_dtft_complex(uint8_t * restrict x, int N, int num_points);
 
+/**
+ * Compute DTFT of a repeated pattern at num_bins points from 0 to π
+ * (ω_k = πk/(num_bins-1), the grid of the lookup table)
+ * Uses a compile-time specialized kernel for fixed configurations (dtft_fixed.h),
+ * otherwise the generic per-sample loop over the repeated signal
+ * @param pattern One period of the signal (0/1 samples)
+ * @param pattern_len Samples per period
+ * @param repetitions Number of periods in the transformed signal
+ * @param num_bins Number of frequency points
+ * @param output Complex values [real0, imag0, real1, imag1, ...] (num_bins * 2 floats)
+ */
+void calculate_dtft_repeated(const uint8_t *pattern, int pattern_len, int repetitions,
+                             int num_bins, float *output);
+
+/**
+ * DTFT of a repeated sample-and-hold pattern from its sampled bits only
+ * The received period is the sampled bits each held for `hold` samples (the
+ * receiver's sample divisor); its DTFT is the transform of the pattern_len/hold
+ * samples at ω·hold times the box response Σ_{i<hold} e^{-jωi}, so the work
+ * drops by the divisor. Matches calculate_dtft_repeated() on the held signal.
+ * @param samples Sampled bits (ceil(pattern_len / hold) values)
+ * @param pattern_len Samples per period after the hold
+ * @param hold Samples each sampled bit is held for (1 = no hold)
+ * @param repetitions Number of periods in the transformed signal
+ * @param num_bins Number of frequency points from 0 to π
+ * @param output Complex values [real0, imag0, real1, imag1, ...] (num_bins * 2 floats)
+ */
+void calculate_dtft_zoh(const uint8_t *samples, int pattern_len, int hold, int repetitions,
+                        int num_bins, float *output);
+
+/**
+ * Single bin of calculate_dtft_zoh() (hold = 1: of calculate_dtft_repeated())
+ * @param samples Sampled bits (the pattern itself when hold = 1)
+ * @param pattern_len Samples per period after the hold
+ * @param hold Samples each sampled bit is held for
+ * @param repetitions Number of periods in the transformed signal
+ * @param num_bins Number of frequency points from 0 to π
+ * @param k Bin to evaluate (0 to num_bins - 1)
+ * @param output Complex value [real, imag]
+ */
+void calculate_dtft_bin(const uint8_t *samples, int pattern_len, int hold, int repetitions,
+                        int num_bins, int k, float *output);
+
 #endif // DTFT_H
@@ -0,0 +1,30 @@
+#include "dtft_table.hpp"
+
+// Reduced bit depth configurations: 1-7 bit values, DTFT_N repetitions
+static constexpr DtftHarmonicTable<1, DTFT_N> depth1{};
+static constexpr DtftHarmonicTable<2, DTFT_N> depth2{};
+static constexpr DtftHarmonicTable<3, DTFT_N> depth3{};
+static constexpr DtftHarmonicTable<4, DTFT_N> depth4{};
+static constexpr DtftHarmonicTable<5, DTFT_N> depth5{};
+static constexpr DtftHarmonicTable<6, DTFT_N> depth6{};
+static constexpr DtftHarmonicTable<7, DTFT_N> depth7{};
+
+#define DEPTH_TABLE(t, bits) \
+    { bits, decltype(t)::kBins, decltype(t)::kHarmonics, &t.entries[0][0][0] }
+
+static constexpr dtft_depth_table_t depth_tables[DTFT_DEPTH_MAX_BITS] = {
+    DEPTH_TABLE(depth1, 1),
+    DEPTH_TABLE(depth2, 2),
+    DEPTH_TABLE(depth3, 3),
+    DEPTH_TABLE(depth4, 4),
+    DEPTH_TABLE(depth5, 5),
+    DEPTH_TABLE(depth6, 6),
+    DEPTH_TABLE(depth7, 7),
+};
+
+extern "C" const dtft_depth_table_t *dtft_depth_table(int bits) {
+    if (bits < DTFT_DEPTH_MIN_BITS || bits > DTFT_DEPTH_MAX_BITS) {
+        return nullptr;
+    }
+    return &depth_tables[bits - DTFT_DEPTH_MIN_BITS];
+}
@@ -0,0 +1,287 @@
+#include "dtft_fixed.h"
+#include "ct_math.hpp"
+
+// Compile-time specialized DTFT kernels for the fixed production configurations.
+//
+// The received signal is always one pattern repeated Reps times, so
+//   X(ω) = Σ_{n<Period} x[n] e^{-jωn} · Σ_{r<Reps} e^{-jωPeriod·r}
+// The per-bin twiddles and the repetition gain are constexpr tables in flash;
+// the kernel only touches Period samples instead of Period*Reps, and bins whose
+// repetition gain is exactly zero are written without any arithmetic.
+
+namespace {
+
+template <int Period, int Reps, int Bins>
+struct FixedDtftTables {
+    float cos_tw[Bins][Period];
+    float sin_tw[Bins][Period];
+    float gain_re[Bins];
+    float gain_im[Bins];
+    bool gain_zero[Bins];
+
+    constexpr FixedDtftTables() : cos_tw(), sin_tw(), gain_re(), gain_im(), gain_zero() {
+        // ω_k = πk/(Bins-1), so ω_k·n = π·(k·n)/(Bins-1) exactly
+        for (int k = 0; k < Bins; k++) {
+            for (int n = 0; n < Period; n++) {
+                cos_tw[k][n] = (float)ct::cos_pi_ratio((long)k * n, Bins - 1);
+                sin_tw[k][n] = (float)-ct::sin_pi_ratio((long)k * n, Bins - 1);
+            }
+
+            double gr = 0.0;
+            double gi = 0.0;
+            for (int r = 0; r < Reps; r++) {
+                gr += ct::cos_pi_ratio((long)k * Period * r, Bins - 1);
+                gi -= ct::sin_pi_ratio((long)k * Period * r, Bins - 1);
+            }
+            // Geometric sums that cancel analytically leave ~1e-15 residue
+            gain_zero[k] = ct::abs(gr) < 1e-9 && ct::abs(gi) < 1e-9;
+            gain_re[k] = gain_zero[k] ? 0.0f : (float)gr;
+            gain_im[k] = gain_zero[k] ? 0.0f : (float)gi;
+        }
+    }
+};
+
+template <int Period, int Reps, int Bins>
+struct FixedDtft {
+    static constexpr FixedDtftTables<Period, Reps, Bins> tables{};
+
+    static void run(const uint8_t *pattern, float *output) {
+        // Load the period once; Period is small enough to live in registers
+        float x[Period];
+#pragma GCC unroll 16
+        for (int n = 0; n < Period; n++) {
+            x[n] = pattern[n];
+        }
+
+#pragma GCC unroll 64
+        for (int k = 0; k < Bins; k++) {
+            if (tables.gain_zero[k]) {
+                output[2*k] = 0.0f;
+                output[2*k + 1] = 0.0f;
+                continue;
+            }
+
+            float re = 0.0f;
+            float im = 0.0f;
+#pragma GCC unroll 16
+            for (int n = 0; n < Period; n++) {
+                re += x[n] * tables.cos_tw[k][n];
+                im += x[n] * tables.sin_tw[k][n];
+            }
+
+            if (Reps == 1) {
+                output[2*k] = re;
+                output[2*k + 1] = im;
+            } else {
+                const float gr = tables.gain_re[k];
+                const float gi = tables.gain_im[k];
+                output[2*k] = re * gr - im * gi;
+                output[2*k + 1] = re * gi + im * gr;
+            }
+        }
+    }
+    // Single bin k, for lazy evaluation
+    static void run_bin(const uint8_t *pattern, int k, float *output) {
+        float re = 0.0f;
+        float im = 0.0f;
+        if (!tables.gain_zero[k]) {
+#pragma GCC unroll 16
+            for (int n = 0; n < Period; n++) {
+                if (pattern[n]) {
+                    re += tables.cos_tw[k][n];
+                    im += tables.sin_tw[k][n];
+                }
+            }
+        }
+        output[0] = re * tables.gain_re[k] - im * tables.gain_im[k];
+        output[1] = re * tables.gain_im[k] + im * tables.gain_re[k];
+    }
+};
+
+// Zero-order-hold input: with sample divisor Hold the period is Period/Hold
+// sampled bits s[m], each held for Hold samples, so
+//   X(ω) = Σ_{m<Period/Hold} s[m] e^{-jωHold·m} · H(ω) · G(ω)
+// with the box response H(ω) = Σ_{i<Hold} e^{-jωi}
+//                             = e^{-jω(Hold-1)/2} sin(ωHold/2)/sin(ω/2)
+// and the repetition gain G. H·G is folded into one constexpr factor per bin.
+template <int Period, int Hold, int Reps, int Bins>
+struct FixedZohTables {
+    static_assert(Period % Hold == 0, "hold must divide the period");
+    static constexpr int kSamples = Period / Hold;
+
+    float cos_tw[Bins][kSamples];
+    float sin_tw[Bins][kSamples];
+    float factor_re[Bins];
+    float factor_im[Bins];
+    bool factor_zero[Bins];
+
+    constexpr FixedZohTables() : cos_tw(), sin_tw(), factor_re(), factor_im(), factor_zero() {
+        for (int k = 0; k < Bins; k++) {
+            for (int m = 0; m < kSamples; m++) {
+                cos_tw[k][m] = (float)ct::cos_pi_ratio((long)k * m * Hold, Bins - 1);
+                sin_tw[k][m] = (float)-ct::sin_pi_ratio((long)k * m * Hold, Bins - 1);
+            }
+
+            double hr = 0.0;
+            double hi = 0.0;
+            for (int i = 0; i < Hold; i++) {
+                hr += ct::cos_pi_ratio((long)k * i, Bins - 1);
+                hi -= ct::sin_pi_ratio((long)k * i, Bins - 1);
+            }
+            double gr = 0.0;
+            double gi = 0.0;
+            for (int r = 0; r < Reps; r++) {
+                gr += ct::cos_pi_ratio((long)k * Period * r, Bins - 1);
+                gi -= ct::sin_pi_ratio((long)k * Period * r, Bins - 1);
+            }
+            double fr = hr * gr - hi * gi;
+            double fi = hr * gi + hi * gr;
+            factor_zero[k] = ct::abs(fr) < 1e-9 && ct::abs(fi) < 1e-9;
+            factor_re[k] = factor_zero[k] ? 0.0f : (float)fr;
+            factor_im[k] = factor_zero[k] ? 0.0f : (float)fi;
+        }
+    }
+};
+
+template <int Period, int Hold, int Reps, int Bins>
+struct FixedZohDtft {
+    static constexpr FixedZohTables<Period, Hold, Reps, Bins> tables{};
+    static constexpr int kSamples = Period / Hold;
+
+    static void run(const uint8_t *samples, float *output) {
+        float x[kSamples];
+#pragma GCC unroll 16
+        for (int m = 0; m < kSamples; m++) {
+            x[m] = samples[m];
+        }
+
+#pragma GCC unroll 64
+        for (int k = 0; k < Bins; k++) {
+            if (tables.factor_zero[k]) {
+                output[2*k] = 0.0f;
+                output[2*k + 1] = 0.0f;
+                continue;
+            }
+
+            float re = 0.0f;
+            float im = 0.0f;
+#pragma GCC unroll 16
+            for (int m = 0; m < kSamples; m++) {
+                re += x[m] * tables.cos_tw[k][m];
+                im += x[m] * tables.sin_tw[k][m];
+            }
+
+            const float fr = tables.factor_re[k];
+            const float fi = tables.factor_im[k];
+            output[2*k] = re * fr - im * fi;
+            output[2*k + 1] = re * fi + im * fr;
+        }
+    }
+    static void run_bin(const uint8_t *samples, int k, float *output) {
+        float re = 0.0f;
+        float im = 0.0f;
+        if (!tables.factor_zero[k]) {
+#pragma GCC unroll 16
+            for (int m = 0; m < kSamples; m++) {
+                if (samples[m]) {
+                    re += tables.cos_tw[k][m];
+                    im += tables.sin_tw[k][m];
+                }
+            }
+        }
+        output[0] = re * tables.factor_re[k] - im * tables.factor_im[k];
+        output[1] = re * tables.factor_im[k] + im * tables.factor_re[k];
+    }
+};
+
+typedef struct {
+    int period;
+    int repetitions;
+    int bins;
+    void (*run)(const uint8_t *pattern, float *output);
+    void (*run_bin)(const uint8_t *pattern, int k, float *output);
+} fixed_kernel_t;
+
+typedef struct {
+    int period;
+    int hold;
+    int repetitions;
+    int bins;
+    void (*run)(const uint8_t *samples, float *output);
+    void (*run_bin)(const uint8_t *samples, int k, float *output);
+} fixed_zoh_kernel_t;
+
+// Production configurations: 8-bit patterns x10 (N=80, n10 lookup table)
+// and a single 8-sample period, both on the 41-bin 0..π grid, and the reduced
+// bit depth configurations
+constexpr fixed_kernel_t fixed_kernels[] = {
+    { 8, 10, 41, &FixedDtft<8, 10, 41>::run, &FixedDtft<8, 10, 41>::run_bin },
+    { 8,  1, 41, &FixedDtft<8,  1, 41>::run, &FixedDtft<8,  1, 41>::run_bin },
+    // Reduced bit depths (dtft_depth_table.cpp): 1-7 bits x10 on 5*bits+1 bins
+    { 1, 10,  6, &FixedDtft<1, 10,  6>::run, &FixedDtft<1, 10,  6>::run_bin },
+    { 2, 10, 11, &FixedDtft<2, 10, 11>::run, &FixedDtft<2, 10, 11>::run_bin },
+    { 3, 10, 16, &FixedDtft<3, 10, 16>::run, &FixedDtft<3, 10, 16>::run_bin },
+    { 4, 10, 21, &FixedDtft<4, 10, 21>::run, &FixedDtft<4, 10, 21>::run_bin },
+    { 5, 10, 26, &FixedDtft<5, 10, 26>::run, &FixedDtft<5, 10, 26>::run_bin },
+    { 6, 10, 31, &FixedDtft<6, 10, 31>::run, &FixedDtft<6, 10, 31>::run_bin },
+    { 7, 10, 36, &FixedDtft<7, 10, 36>::run, &FixedDtft<7, 10, 36>::run_bin },
+};
+
+// Sub-sampled receiver (SAMPLING_RATE_DIVISOR 2, 4, 8) on the n10 configuration
+// and on a single period (set_decode_repetitions(1))
+constexpr fixed_zoh_kernel_t fixed_zoh_kernels[] = {
+    { 8, 2, 10, 41, &FixedZohDtft<8, 2, 10, 41>::run, &FixedZohDtft<8, 2, 10, 41>::run_bin },
+    { 8, 4, 10, 41, &FixedZohDtft<8, 4, 10, 41>::run, &FixedZohDtft<8, 4, 10, 41>::run_bin },
+    { 8, 8, 10, 41, &FixedZohDtft<8, 8, 10, 41>::run, &FixedZohDtft<8, 8, 10, 41>::run_bin },
+    { 8, 2,  1, 41, &FixedZohDtft<8, 2,  1, 41>::run, &FixedZohDtft<8, 2,  1, 41>::run_bin },
+    { 8, 4,  1, 41, &FixedZohDtft<8, 4,  1, 41>::run, &FixedZohDtft<8, 4,  1, 41>::run_bin },
+    { 8, 8,  1, 41, &FixedZohDtft<8, 8,  1, 41>::run, &FixedZohDtft<8, 8,  1, 41>::run_bin },
+};
+
+} // namespace
+
+extern "C" bool dtft_fixed_repeated(const uint8_t *pattern, int pattern_len, int repetitions,
+                                    int num_bins, float *output) {
+    for (const fixed_kernel_t &kernel : fixed_kernels) {
+        if (kernel.period == pattern_len && kernel.repetitions == repetitions &&
+            kernel.bins == num_bins) {
+            kernel.run(pattern, output);
+            return true;
+        }
+    }
+    return false;
+}
+
+extern "C" bool dtft_fixed_zoh(const uint8_t *samples, int pattern_len, int hold, int repetitions,
+                               int num_bins, float *output) {
+    for (const fixed_zoh_kernel_t &kernel : fixed_zoh_kernels) {
+        if (kernel.period == pattern_len && kernel.hold == hold &&
+            kernel.repetitions == repetitions && kernel.bins == num_bins) {
+            kernel.run(samples, output);
+            return true;
+        }
+    }
+    return false;
+}
+
+extern "C" bool dtft_fixed_bin(const uint8_t *samples, int pattern_len, int hold, int repetitions,
+                               int num_bins, int k, float *output) {
+    if (hold == 1) {
+        for (const fixed_kernel_t &kernel : fixed_kernels) {
+            if (kernel.period == pattern_len && kernel.repetitions == repetitions &&
+                kernel.bins == num_bins) {
+                kernel.run_bin(samples, k, output);
+                return true;
+            }
+        }
+        return false;
+    }
+    for (const fixed_zoh_kernel_t &kernel : fixed_zoh_kernels) {
+        if (kernel.period == pattern_len && kernel.hold == hold &&
+            kernel.repetitions == repetitions && kernel.bins == num_bins) {
+            kernel.run_bin(samples, k, output);
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,59 @@
+#ifndef DTFT_FIXED_H
+#define DTFT_FIXED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Compile-time specialized DTFT of a repeated pattern (see dtft_fixed.cpp)
+ * Evaluates ω_k = πk/(num_bins-1), k = 0..num_bins-1, over one period and
+ * applies the constant repetition gain Σ_r e^{-jω_k·pattern_len·r}.
+ * @param pattern One period of the signal (0/1 samples)
+ * @param pattern_len Samples per period
+ * @param repetitions Number of periods in the transformed signal
+ * @param num_bins Number of frequency points from 0 to π
+ * @param output Complex values [real0, imag0, real1, imag1, ...]
+ * @return true if a specialization exists and output was written,
+ *         false if the caller must use the generic kernel
+ */
+bool dtft_fixed_repeated(const uint8_t *pattern, int pattern_len, int repetitions,
+                         int num_bins, float *output);
+
+/**
+ * Compile-time specialized DTFT of a repeated sample-and-hold pattern
+ * Same grid and repetition as dtft_fixed_repeated(), but the period is given
+ * as its pattern_len/hold sampled bits; the hold is applied as a per-bin factor.
+ * @param samples Sampled bits (pattern_len / hold values)
+ * @param pattern_len Samples per period after the hold
+ * @param hold Samples each sampled bit is held for (sample divisor)
+ * @param repetitions Number of periods in the transformed signal
+ * @param num_bins Number of frequency points from 0 to π
+ * @param output Complex values [real0, imag0, real1, imag1, ...]
+ * @return true if a specialization exists and output was written
+ */
+bool dtft_fixed_zoh(const uint8_t *samples, int pattern_len, int hold, int repetitions,
+                    int num_bins, float *output);
+
+/**
+ * Single bin of dtft_fixed_repeated() (hold = 1) or dtft_fixed_zoh()
+ * @param samples Pattern (hold = 1) or sampled bits
+ * @param pattern_len Samples per period after the hold
+ * @param hold Samples each sampled bit is held for
+ * @param repetitions Number of periods in the transformed signal
+ * @param num_bins Number of frequency points from 0 to π
+ * @param k Bin to evaluate
+ * @param output Complex value [real, imag]
+ * @return true if a specialization exists and output was written
+ */
+bool dtft_fixed_bin(const uint8_t *samples, int pattern_len, int hold, int repetitions,
+                    int num_bins, int k, float *output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DTFT_FIXED_H
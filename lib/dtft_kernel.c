@@ -0,0 +1,163 @@
+// Per-sample DTFT kernels: the dense one and the set-bit one for packed 0/1
+// signals. Built with -fno-associative-math (the rest of lib/ keeps
+// -ffast-math) so both add the same twiddles in source order and give
+// bit-identical magnitudes.
+#include "dtft.h"
+#include "lut.h"
+#include "mem_stats.h"
+#include <math.h>
+
+// calculate_dtft_bits() unpacks signals with more ones than this (percent) and
+// runs the dense kernel, which is faster when nearly every bit is set
+#define DTFT_BITS_DENSE_PERCENT 80
+
+float compute_dtft_magnitude(uint8_t * restrict x, int N, float omega) {
+    float real_part = 0.0f;
+    float imag_part = 0.0f;
+    float angle = 0.0f;
+    const float neg_omega = -omega;
+    
+    // Loop unrolling (8x)
+    int n = 0;
+    int N_unroll = N & ~7;
+    
+    for (; n < N_unroll; n += 8) {
+        // Prefetch ahead to improve cache performance
+        __builtin_prefetch(&x[n + 16], 0, 3);
+        
+        float angle1 = angle;
+        float angle2 = angle + neg_omega;
+        float angle3 = angle + 2.0f * neg_omega;
+        float angle4 = angle + 3.0f * neg_omega;
+        float angle5 = angle + 4.0f * neg_omega;
+        float angle6 = angle + 5.0f * neg_omega;
+        float angle7 = angle + 6.0f * neg_omega;
+        float angle8 = angle + 7.0f * neg_omega;
+        
+        float cos1 = fast_cos(angle1);
+        float sin1 = fast_sin(angle1);
+        float cos2 = fast_cos(angle2);
+        float sin2 = fast_sin(angle2);
+        float cos3 = fast_cos(angle3);
+        float sin3 = fast_sin(angle3);
+        float cos4 = fast_cos(angle4);
+        float sin4 = fast_sin(angle4);
+        float cos5 = fast_cos(angle5);
+        float sin5 = fast_sin(angle5);
+        float cos6 = fast_cos(angle6);
+        float sin6 = fast_sin(angle6);
+        float cos7 = fast_cos(angle7);
+        float sin7 = fast_sin(angle7);
+        float cos8 = fast_cos(angle8);
+        float sin8 = fast_sin(angle8);
+        
+        real_part += x[n]   * cos1 + x[n+1] * cos2 + x[n+2] * cos3 + x[n+3] * cos4 +
+                     x[n+4] * cos5 + x[n+5] * cos6 + x[n+6] * cos7 + x[n+7] * cos8;
+        imag_part += x[n]   * sin1 + x[n+1] * sin2 + x[n+2] * sin3 + x[n+3] * sin4 +
+                     x[n+4] * sin5 + x[n+5] * sin6 + x[n+6] * sin7 + x[n+7] * sin8;
+        
+        angle += 8.0f * neg_omega;
+    }
+    
+    // Handle remaining samples
+    for (; n < N; n++) {
+        real_part += x[n] * fast_cos(angle);
+        imag_part += x[n] * fast_sin(angle);
+        angle += neg_omega;
+    }
+    
+    return sqrtf(real_part * real_part + imag_part * imag_part);
+}
+
+float compute_dtft_magnitude_bits(const uint8_t *bits, int N, float omega) {
+    float real_part = 0.0f;
+    float imag_part = 0.0f;
+    float angle = 0.0f;
+    const float neg_omega = -omega;
+
+    // Same angles and summation order as compute_dtft_magnitude(): each packed
+    // byte is one of its 8-sample blocks, and the products of zero samples it
+    // adds are exact zeros, so only the set bits are visited
+    float step[8];
+    for (int i = 0; i < 8; i++) {
+        step[i] = (float)i * neg_omega;
+    }
+
+    const int N_unroll = N & ~7;
+    for (int j = 0; j < N_unroll / 8; j++) {
+        uint32_t byte = bits[j];
+        if (byte) {
+            float block_real = 0.0f;
+            float block_imag = 0.0f;
+            do {
+                // MSB first: the leading set bit is the earliest sample
+                int i = __builtin_clz(byte << 24);
+                byte &= ~(0x80u >> i);
+                float sample_angle = angle + step[i];
+                block_real += fast_cos(sample_angle);
+                block_imag += fast_sin(sample_angle);
+            } while (byte);
+            real_part += block_real;
+            imag_part += block_imag;
+        }
+        angle += 8.0f * neg_omega;
+    }
+
+    // Remaining samples of a partial last byte
+    for (int n = N_unroll; n < N; n++) {
+        if ((bits[n / 8] >> (7 - n % 8)) & 1) {
+            real_part += fast_cos(angle);
+            imag_part += fast_sin(angle);
+        }
+        angle += neg_omega;
+    }
+
+    return sqrtf(real_part * real_part + imag_part * imag_part);
+}
+
+float* calculate_dtft(uint8_t * restrict x, int N, int num_points) {
+    float *magnitudes = MEM_MALLOC(num_points * sizeof(float));
+    if (!magnitudes) {
+        return NULL;
+    }
+
+    const float omega_scale = (2.0f * M_PI) / num_points;
+    for (int k = 0; k < num_points; k++) {
+        float omega = omega_scale * k;  // 0 to 2*pi
+        magnitudes[k] = compute_dtft_magnitude(x, N, omega);
+    }
+
+    return magnitudes;
+}
+
+float* calculate_dtft_bits(const uint8_t *bits, int N, int num_points) {
+    int ones = 0;
+    for (int n = 0; n < N; n++) {
+        ones += (bits[n / 8] >> (7 - n % 8)) & 1;
+    }
+    if (ones * 100 > N * DTFT_BITS_DENSE_PERCENT) {
+        uint8_t *x = MEM_MALLOC(N);
+        if (!x) {
+            return NULL;
+        }
+        for (int n = 0; n < N; n++) {
+            x[n] = (bits[n / 8] >> (7 - n % 8)) & 1;
+        }
+        float *magnitudes = calculate_dtft(x, N, num_points);
+        MEM_FREE(x);
+        return magnitudes;
+    }
+
+    float *magnitudes = MEM_MALLOC(num_points * sizeof(float));
+    if (!magnitudes) {
+        return NULL;
+    }
+
+    const float omega_scale = (2.0f * M_PI) / num_points;
+    for (int k = 0; k < num_points; k++) {
+        float omega = omega_scale * k;  // 0 to 2*pi
+        magnitudes[k] = compute_dtft_magnitude_bits(bits, N, omega);
+    }
+
+    return magnitudes;
+}
@@ -1,23 +1,17 @@
 #ifndef DTFT_LOOKUP_N10_H
 #define DTFT_LOOKUP_N10_H
 
-#include <stdint.h>
+#include "dtft_table.h"
 
-// DTFT Lookup Table for n=10
+// Checked-in DTFT Lookup Table for n=10 (used with DTFT_TABLE_GENERATED=OFF)
 // Grayscale resolution: 8-bit (256 levels, 0-255)
 // Sequence length: 80 bits (8 × 10 repetitions)
 // Frequencies: 41 (0 to π, resolution: π/40 rad/sample)
 // Data type: single-precision float (32-bit)
 // Size: 125952 bytes
 
-typedef struct {
-    float magnitude;
-    float phase;
-    float frequency;
-} DTFTPoint;
-
 // DTFT data: [256 values][41 frequencies][magnitude, phase, frequency]
-const DTFTPoint dtft_lookup_n10[256][41] = {
+static const DTFTPoint dtft_lookup_n10_data[256][41] = {
     { // Value 0 (0x00)
         {0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f},         {0.00000000e+00f, 0.00000000e+00f, 7.85398185e-02f},
         {0.00000000e+00f, 0.00000000e+00f, 1.57079637e-01f},         {0.00000000e+00f, 0.00000000e+00f, 2.35619456e-01f},
@@ -5908,10 +5902,4 @@ const DTFTPoint dtft_lookup_n10[256][41] = {
     }
 };
 
-#define DTFT_BIT_DEPTH 8                                    // 8-bit grayscale
-#define DTFT_N 10
-#define DTFT_NUM_VALUES 256                              // 2^8 grayscale levels
-#define DTFT_NUM_FREQUENCIES 41
-#define DTFT_RESOLUTION (3.14159265f / 40)  // π/(40)
-
 #endif // DTFT_LOOKUP_N10_H
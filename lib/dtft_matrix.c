@@ -0,0 +1,378 @@
+#include "dtft_matrix.h"
+#include "mem_stats.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Cortex-M33 DSP extension: SMLAD multiplies two int16 pairs and adds both
+// products to a 32-bit accumulator in one cycle
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define HAVE_SMLAD 1
+#else
+#define HAVE_SMLAD 0
+#endif
+
+// ---- IEEE half storage ----
+
+static uint16_t float_to_half(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = (bits >> 16) & 0x8000;
+    int exponent = (int)((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFF;
+    if (exponent <= 0) {
+        return sign;    // Below the smallest normal half: flush to zero
+    }
+    if (exponent >= 31) {
+        return sign | 0x7BFF;   // Clamp to the largest finite half
+    }
+    // Round to nearest; a carry out of the mantissa correctly bumps the exponent
+    uint32_t half = ((uint32_t)exponent << 10) | (mantissa >> 13);
+    half += (mantissa >> 12) & 1;
+    return sign | (uint16_t)(half > 0x7BFF ? 0x7BFF : half);
+}
+
+static inline float half_to_float(uint16_t half) {
+    uint32_t bits = (uint32_t)(half & 0x8000) << 16;
+    if (half & 0x7FFF) {
+        // Normal halves only (float_to_half() never makes subnormals)
+        bits |= ((uint32_t)(half & 0x7FFF) + ((127 - 15) << 10)) << 13;
+    }
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// ---- Building the matrix ----
+
+/**
+ * e^{-jπ·num/den}, with the angle reduced exactly before the double conversion
+ */
+static void unit_phasor(long num, long den, double *re, double *im) {
+    double angle = M_PI * (double)(num % (2 * den)) / (double)den;
+    *re = cos(angle);
+    *im = -sin(angle);
+}
+
+static size_t entry_size(dtft_matrix_format_t format) {
+    return format == DTFT_MATRIX_F32 ? sizeof(float) : sizeof(uint16_t);
+}
+
+bool dtft_matrix_init(dtft_matrix_t *matrix, int pattern_len, int hold, int repetitions,
+                      int num_bins, dtft_matrix_format_t format) {
+    memset(matrix, 0, sizeof(*matrix));
+    if (hold < 1) hold = 1;
+    const int num_samples = (pattern_len + hold - 1) / hold;
+    if (pattern_len < 1 || repetitions < 1 || num_bins < 2 || num_samples > DTFT_MATRIX_MAX_SAMPLES) {
+        printf("Error: DTFT matrix %d samples x %d bins not supported (max %d samples)\n",
+               num_samples, num_bins, DTFT_MATRIX_MAX_SAMPLES);
+        return false;
+    }
+
+    // Rows for every bin at first; bins whose rows are zero are dropped below
+    const int stride = (num_samples + 1) & ~1;
+    double *values = MEM_CALLOC((size_t)2 * num_bins * stride, sizeof(double));
+    matrix->entries = MEM_CALLOC((size_t)2 * num_bins * stride, entry_size(format));
+    matrix->row_index = MEM_CALLOC((size_t)2 * num_bins, sizeof(uint16_t));
+    if (!values || !matrix->entries || !matrix->row_index) {
+        printf("Error: out of memory for the DTFT matrix\n");
+        MEM_FREE(values);
+        dtft_matrix_free(matrix);
+        return false;
+    }
+
+    // ω_k = πk/(num_bins-1), so every angle is π·(integer)/(num_bins-1)
+    const long den = num_bins - 1;
+    double max_abs = 0.0;
+    int rows = 0;
+    for (int k = 0; k < num_bins; k++) {
+        double gain_re = 0.0;
+        double gain_im = 0.0;
+        for (int r = 0; r < repetitions; r++) {
+            double re, im;
+            unit_phasor((long)k * pattern_len * r, den, &re, &im);
+            gain_re += re;
+            gain_im += im;
+        }
+        // Bins whose repetition gain cancels analytically are exactly zero: no rows
+        if (fabs(gain_re) < 1e-9 && fabs(gain_im) < 1e-9) {
+            continue;
+        }
+        matrix->row_index[rows] = 2*k;
+        matrix->row_index[rows + 1] = 2*k + 1;
+
+        for (int m = 0; m < num_samples; m++) {
+            // Sample m is held over [m*hold, min((m+1)*hold, pattern_len))
+            int box_len = pattern_len - m * hold < hold ? pattern_len - m * hold : hold;
+            double box_re = 0.0;
+            double box_im = 0.0;
+            for (int i = 0; i < box_len; i++) {
+                double re, im;
+                unit_phasor((long)k * (m * hold + i), den, &re, &im);
+                box_re += re;
+                box_im += im;
+            }
+            double re = box_re * gain_re - box_im * gain_im;
+            double im = box_re * gain_im + box_im * gain_re;
+            values[rows * stride + m] = re;
+            values[(rows + 1) * stride + m] = im;
+            if (fabs(re) > max_abs) max_abs = fabs(re);
+            if (fabs(im) > max_abs) max_abs = fabs(im);
+        }
+        rows += 2;
+    }
+
+    // Q15: smallest power of two above every entry
+    int scale_shift = 0;
+    while (ldexp(1.0, scale_shift) <= max_abs) {
+        scale_shift++;
+    }
+    const double lsb = ldexp(1.0, scale_shift) / 32768.0;
+
+    for (int i = 0; i < rows * stride; i++) {
+        switch (format) {
+        case DTFT_MATRIX_F32:
+            ((float *)matrix->entries)[i] = (float)values[i];
+            break;
+        case DTFT_MATRIX_F16:
+            ((uint16_t *)matrix->entries)[i] = float_to_half((float)values[i]);
+            break;
+        case DTFT_MATRIX_Q15: {
+            long q = lround(values[i] / lsb);
+            ((int16_t *)matrix->entries)[i] = (int16_t)(q > 32767 ? 32767 : q < -32768 ? -32768 : q);
+            break;
+        }
+        }
+    }
+    MEM_FREE(values);
+
+    matrix->format = format;
+    matrix->num_samples = num_samples;
+    matrix->stride = stride;
+    matrix->rows = rows;
+    matrix->num_bins = num_bins;
+    matrix->pattern_len = pattern_len;
+    matrix->hold = hold;
+    matrix->repetitions = repetitions;
+    matrix->q15_scale = (float)lsb;
+    return true;
+}
+
+void dtft_matrix_free(dtft_matrix_t *matrix) {
+    MEM_FREE(matrix->entries);
+    MEM_FREE(matrix->row_index);
+    matrix->entries = NULL;
+    matrix->row_index = NULL;
+}
+
+size_t dtft_matrix_bytes(const dtft_matrix_t *matrix) {
+    return (size_t)matrix->rows * (matrix->stride * entry_size(matrix->format) + sizeof(uint16_t));
+}
+
+const char* dtft_matrix_format_name(dtft_matrix_format_t format) {
+    switch (format) {
+    case DTFT_MATRIX_F32: return "f32";
+    case DTFT_MATRIX_F16: return "f16";
+    case DTFT_MATRIX_Q15: return "q15";
+    }
+    return "?";
+}
+
+// ---- Q15 multiply-accumulate ----
+
+#if HAVE_SMLAD
+/**
+ * Pack sampled bits m and m+1 as an int16 pair (low half = m)
+ */
+static inline int32_t pack_pair(const uint8_t *samples, int m, int num_samples) {
+    uint32_t high = m + 1 < num_samples ? samples[m + 1] : 0;
+    return (int32_t)(samples[m] | (high << 16));
+}
+
+static inline int32_t load_pair(const int16_t *row, int m) {
+    int32_t pair;
+    memcpy(&pair, &row[m], sizeof(pair));
+    return pair;
+}
+#endif
+
+// ---- GEMV: one pixel ----
+
+void dtft_matrix_gemv(const dtft_matrix_t *matrix, const uint8_t *samples, float *output) {
+    const int n = matrix->num_samples;
+    const int stride = matrix->stride;
+    const uint16_t *index = matrix->row_index;
+
+    memset(output, 0, 2 * matrix->num_bins * sizeof(float));
+    switch (matrix->format) {
+    case DTFT_MATRIX_F32: {
+        float x[DTFT_MATRIX_MAX_SAMPLES];
+        for (int m = 0; m < n; m++) {
+            x[m] = samples[m];
+        }
+        const float *row = matrix->entries;
+        for (int r = 0; r < matrix->rows; r++, row += stride) {
+            float acc = 0.0f;
+            for (int m = 0; m < n; m++) {
+                acc += row[m] * x[m];
+            }
+            output[index[r]] = acc;
+        }
+        break;
+    }
+    case DTFT_MATRIX_F16: {
+        float x[DTFT_MATRIX_MAX_SAMPLES];
+        for (int m = 0; m < n; m++) {
+            x[m] = samples[m];
+        }
+        const uint16_t *row = matrix->entries;
+        for (int r = 0; r < matrix->rows; r++, row += stride) {
+            float acc = 0.0f;
+            for (int m = 0; m < n; m++) {
+                acc += half_to_float(row[m]) * x[m];
+            }
+            output[index[r]] = acc;
+        }
+        break;
+    }
+    case DTFT_MATRIX_Q15: {
+        const int16_t *row = matrix->entries;
+#if HAVE_SMLAD
+        int32_t x[DTFT_MATRIX_MAX_SAMPLES / 2];
+        for (int m = 0; m < n; m += 2) {
+            x[m / 2] = pack_pair(samples, m, n);
+        }
+        for (int r = 0; r < matrix->rows; r++, row += stride) {
+            int32_t acc = 0;
+            for (int m = 0; m < n; m += 2) {
+                acc = __smlad(load_pair(row, m), x[m / 2], acc);
+            }
+            output[index[r]] = acc * matrix->q15_scale;
+        }
+#else
+        int16_t x[DTFT_MATRIX_MAX_SAMPLES];
+        for (int m = 0; m < n; m++) {
+            x[m] = samples[m];
+        }
+        for (int r = 0; r < matrix->rows; r++, row += stride) {
+            int32_t acc = 0;
+            for (int m = 0; m < n; m++) {
+                acc += row[m] * x[m];
+            }
+            output[index[r]] = acc * matrix->q15_scale;
+        }
+#endif
+        break;
+    }
+    }
+}
+
+// ---- GEMM: blocks of DTFT_MATRIX_BLOCK pixels ----
+
+/**
+ * One block: each matrix entry is loaded once and applied to every pixel of
+ * the block; the inner loop over pixels is unit-stride for vectorization
+ */
+static void gemm_block(const dtft_matrix_t *matrix, const uint8_t *samples, int sample_stride,
+                       int count, float *output) {
+    const int spectrum_len = 2 * matrix->num_bins;
+    const int n = matrix->num_samples;
+    const int stride = matrix->stride;
+    const uint16_t *index = matrix->row_index;
+
+    memset(output, 0, (size_t)count * spectrum_len * sizeof(float));
+    switch (matrix->format) {
+    case DTFT_MATRIX_F32:
+    case DTFT_MATRIX_F16: {
+        // Missing pixels of a partial block are zero columns
+        float x[DTFT_MATRIX_MAX_SAMPLES][DTFT_MATRIX_BLOCK] = {{0}};
+        for (int p = 0; p < count; p++) {
+            for (int m = 0; m < n; m++) {
+                x[m][p] = samples[p * sample_stride + m];
+            }
+        }
+        float converted[DTFT_MATRIX_MAX_SAMPLES];
+        for (int r = 0; r < matrix->rows; r++) {
+            const float *row;
+            if (matrix->format == DTFT_MATRIX_F32) {
+                row = (const float *)matrix->entries + r * stride;
+            } else {
+                const uint16_t *half_row = (const uint16_t *)matrix->entries + r * stride;
+                for (int m = 0; m < n; m++) {
+                    converted[m] = half_to_float(half_row[m]);
+                }
+                row = converted;
+            }
+            float acc[DTFT_MATRIX_BLOCK] = {0};
+            for (int m = 0; m < n; m++) {
+                for (int p = 0; p < DTFT_MATRIX_BLOCK; p++) {
+                    acc[p] += row[m] * x[m][p];
+                }
+            }
+            for (int p = 0; p < count; p++) {
+                output[p * spectrum_len + index[r]] = acc[p];
+            }
+        }
+        break;
+    }
+    case DTFT_MATRIX_Q15: {
+        const int16_t *row = matrix->entries;
+#if HAVE_SMLAD
+        int32_t x[DTFT_MATRIX_MAX_SAMPLES / 2][DTFT_MATRIX_BLOCK] = {{0}};
+        for (int p = 0; p < count; p++) {
+            for (int m = 0; m < n; m += 2) {
+                x[m / 2][p] = pack_pair(&samples[p * sample_stride], m, n);
+            }
+        }
+        for (int r = 0; r < matrix->rows; r++, row += stride) {
+            int32_t acc[DTFT_MATRIX_BLOCK] = {0};
+            for (int m = 0; m < n; m += 2) {
+                const int32_t a = load_pair(row, m);
+                for (int p = 0; p < DTFT_MATRIX_BLOCK; p++) {
+                    acc[p] = __smlad(a, x[m / 2][p], acc[p]);
+                }
+            }
+            for (int p = 0; p < count; p++) {
+                output[p * spectrum_len + index[r]] = acc[p] * matrix->q15_scale;
+            }
+        }
+#else
+        int32_t x[DTFT_MATRIX_MAX_SAMPLES][DTFT_MATRIX_BLOCK] = {{0}};
+        for (int p = 0; p < count; p++) {
+            for (int m = 0; m < n; m++) {
+                x[m][p] = samples[p * sample_stride + m];
+            }
+        }
+        for (int r = 0; r < matrix->rows; r++, row += stride) {
+            int32_t acc[DTFT_MATRIX_BLOCK] = {0};
+            for (int m = 0; m < n; m++) {
+                const int32_t a = row[m];
+                for (int p = 0; p < DTFT_MATRIX_BLOCK; p++) {
+                    acc[p] += a * x[m][p];
+                }
+            }
+            for (int p = 0; p < count; p++) {
+                output[p * spectrum_len + index[r]] = acc[p] * matrix->q15_scale;
+            }
+        }
+#endif
+        break;
+    }
+    }
+}
+
+void dtft_matrix_gemm(const dtft_matrix_t *matrix, const uint8_t *samples, int sample_stride,
+                      int count, float *output) {
+    const int spectrum_len = 2 * matrix->num_bins;
+    for (int p = 0; p < count; p += DTFT_MATRIX_BLOCK) {
+        int block = count - p < DTFT_MATRIX_BLOCK ? count - p : DTFT_MATRIX_BLOCK;
+        gemm_block(matrix, &samples[p * sample_stride], sample_stride, block,
+                   &output[p * spectrum_len]);
+    }
+}
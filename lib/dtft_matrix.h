@@ -0,0 +1,87 @@
+#ifndef DTFT_MATRIX_H
+#define DTFT_MATRIX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// DTFT as a matrix product. For a fixed configuration (period, hold,
+// repetitions, bins) the spectrum is linear in the sampled bits:
+//   [re_k, im_k] = Σ_m s[m] · (e^{-jω_k·m·hold} · H_k · G_k)
+// with the hold box H and repetition gain G folded into each entry, so one
+// pixel is a (2·bins) x samples matrix-vector product (GEMV) and a batch of
+// pixels a blocked matrix-matrix product (GEMM) that reads each matrix row
+// once per DTFT_MATRIX_BLOCK pixels. Bins whose repetition gain is zero get
+// no rows. The matrix is built once into SRAM in float, fp16 or Q15; Q15
+// uses the Cortex-M33 dual 16-bit MAC (SMLAD).
+#define DTFT_MATRIX_BLOCK 4     // Pixels per GEMM block
+#define DTFT_MATRIX_MAX_SAMPLES 16
+
+typedef enum {
+    DTFT_MATRIX_F32,
+    DTFT_MATRIX_F16,    // IEEE half storage, float accumulation
+    DTFT_MATRIX_Q15,    // Entries in units of q15_scale, 32-bit accumulation
+} dtft_matrix_format_t;
+
+typedef struct {
+    dtft_matrix_format_t format;
+    int num_samples;        // Columns: sampled bits per period
+    int stride;             // Columns padded to an even count (SMLAD pairs)
+    int rows;               // Stored rows: bins whose repetition gain is not zero
+    int num_bins;
+    int pattern_len;
+    int hold;
+    int repetitions;
+    float q15_scale;        // Q15: value of one LSB
+    void *entries;          // rows of stride entries, [re_k, im_k] per stored bin
+    uint16_t *row_index;    // Output index (2k or 2k+1) of each row
+} dtft_matrix_t;
+
+/**
+ * Build the matrix for a fixed configuration
+ * @param matrix Matrix to initialize
+ * @param pattern_len Samples per period after the hold
+ * @param hold Samples each sampled bit is held for (1 = no hold)
+ * @param repetitions Number of periods in the transformed signal
+ * @param num_bins Number of frequency points from 0 to π
+ * @param format Entry format
+ * @return false on bad sizes or out of memory
+ */
+bool dtft_matrix_init(dtft_matrix_t *matrix, int pattern_len, int hold, int repetitions,
+                      int num_bins, dtft_matrix_format_t format);
+
+/**
+ * Free the matrix entries
+ */
+void dtft_matrix_free(dtft_matrix_t *matrix);
+
+/**
+ * Bytes of matrix entries
+ */
+size_t dtft_matrix_bytes(const dtft_matrix_t *matrix);
+
+/**
+ * Format name ("f32", "f16", "q15")
+ */
+const char* dtft_matrix_format_name(dtft_matrix_format_t format);
+
+/**
+ * Spectrum of one pixel (matrix-vector product)
+ * @param matrix Matrix from dtft_matrix_init()
+ * @param samples Sampled bits (num_samples values, 0/1)
+ * @param output Complex values [real0, imag0, real1, imag1, ...] (num_bins * 2 floats)
+ */
+void dtft_matrix_gemv(const dtft_matrix_t *matrix, const uint8_t *samples, float *output);
+
+/**
+ * Spectra of a batch of pixels (blocked matrix-matrix product)
+ * @param matrix Matrix from dtft_matrix_init()
+ * @param samples Sampled bits of pixel p at samples + p * sample_stride
+ * @param sample_stride Bytes between pixels (>= num_samples)
+ * @param count Number of pixels
+ * @param output Spectrum of pixel p at output + p * num_bins * 2
+ */
+void dtft_matrix_gemm(const dtft_matrix_t *matrix, const uint8_t *samples, int sample_stride,
+                      int count, float *output);
+
+#endif // DTFT_MATRIX_H
@@ -0,0 +1,138 @@
+#include "dtft_stream.h"
+#include "dtft.h"
+#include "mem_stats.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+bool dtft_stream_plan_init(dtft_stream_plan_t *plan, int num_bins) {
+    plan->twiddle = NULL;
+    if (num_bins < 2 || num_bins > DTFT_STREAM_MAX_BINS) {
+        return false;
+    }
+    plan->num_bins = num_bins;
+    plan->period = 2 * (num_bins - 1);
+    plan->twiddle = MEM_MALLOC(plan->period * 2 * sizeof(float));
+    if (!plan->twiddle) {
+        return false;
+    }
+    for (int i = 0; i < plan->period; i++) {
+        double angle = M_PI * i / (num_bins - 1);
+        plan->twiddle[2*i] = (float)cos(angle);
+        plan->twiddle[2*i + 1] = (float)-sin(angle);
+    }
+    return true;
+}
+
+void dtft_stream_plan_free(dtft_stream_plan_t *plan) {
+    MEM_FREE(plan->twiddle);
+    plan->twiddle = NULL;
+}
+
+uint32_t dtft_stream_num_blocks(uint32_t num_bits) {
+    return (uint32_t)(((uint64_t)num_bits + DTFT_STREAM_BLOCK_BITS - 1) / DTFT_STREAM_BLOCK_BITS);
+}
+
+void dtft_stream_accumulate(const dtft_stream_plan_t *plan, const uint8_t *bits, uint32_t num_bits,
+                            uint32_t first_block, uint32_t end_block, uint32_t *residues) {
+    const int period = plan->period;
+    // Whole bytes never straddle the end of a period
+    const bool byte_aligned = period % 8 == 0;
+
+    for (uint32_t block = first_block; block < end_block; block++) {
+        const uint32_t start = block * DTFT_STREAM_BLOCK_BITS;
+        if (start >= num_bits) break;
+        const uint32_t len = num_bits - start < DTFT_STREAM_BLOCK_BITS ? num_bits - start
+                                                                        : DTFT_STREAM_BLOCK_BITS;
+        const uint8_t *block_bits = &bits[start / 8];
+        const uint32_t num_bytes = (len + 7) / 8;
+
+        // Phase offset of the block as a residue
+        int r = (int)(start % period);
+        for (uint32_t j = 0; j < num_bytes; j++) {
+            uint8_t byte = block_bits[j];
+            if (j == num_bytes - 1 && len % 8) {
+                byte &= (uint8_t)(0xFF << (8 - len % 8));
+            }
+            if (byte) {
+                if (byte_aligned) {
+                    uint32_t *slot = &residues[r];
+                    for (int b = 0; b < 8; b++) {
+                        slot[b] += (byte >> (7 - b)) & 1;
+                    }
+                } else {
+                    for (int b = 0; b < 8; b++) {
+                        int index = r + b < period ? r + b : r + b - period;
+                        residues[index] += (byte >> (7 - b)) & 1;
+                    }
+                }
+            }
+            r += 8;
+            if (r >= period) r -= period;
+        }
+    }
+}
+
+void dtft_stream_evaluate(const dtft_stream_plan_t *plan, const uint32_t *residues, float *output) {
+    const int period = plan->period;
+    for (int k = 0; k < plan->num_bins; k++) {
+        // Residue r sits at angle index k·r mod period
+        double real_part = 0.0;
+        double imag_part = 0.0;
+        int index = 0;
+        for (int r = 0; r < period; r++) {
+            if (residues[r]) {
+                real_part += (double)residues[r] * plan->twiddle[2*index];
+                imag_part += (double)residues[r] * plan->twiddle[2*index + 1];
+            }
+            index += k;
+            if (index >= period) index -= period;
+        }
+        output[2*k] = (float)real_part;
+        output[2*k + 1] = (float)imag_part;
+    }
+}
+
+// Core1 share of dtft_stream()
+typedef struct {
+    const dtft_stream_plan_t *plan;
+    const uint8_t *bits;
+    uint32_t num_bits;
+    uint32_t first_block;
+    uint32_t end_block;
+    uint32_t *residues;
+} stream_job_t;
+
+static void stream_job(void *arg) {
+    stream_job_t *job = arg;
+    dtft_stream_accumulate(job->plan, job->bits, job->num_bits, job->first_block, job->end_block,
+                           job->residues);
+}
+
+bool dtft_stream(const dtft_stream_plan_t *plan, const uint8_t *bits, uint32_t num_bits, float *output) {
+    const int period = plan->period;
+    uint32_t *residues = MEM_CALLOC(2 * period, sizeof(uint32_t));
+    if (!residues) {
+        return false;
+    }
+
+    // Core1 takes the second half of the blocks
+    const uint32_t num_blocks = dtft_stream_num_blocks(num_bits);
+    const uint32_t split = num_blocks / 2;
+    stream_job_t job = {plan, bits, num_bits, split, num_blocks, &residues[period]};
+    bool on_core1 = split > 0 && core1_run(stream_job, &job);
+    if (!on_core1) {
+        stream_job(&job);
+    }
+    dtft_stream_accumulate(plan, bits, num_bits, 0, split, residues);
+    if (on_core1) {
+        core1_wait();
+    }
+
+    for (int r = 0; r < period; r++) {
+        residues[r] += residues[period + r];
+    }
+    dtft_stream_evaluate(plan, residues, output);
+    MEM_FREE(residues);
+    return true;
+}
@@ -0,0 +1,79 @@
+#ifndef DTFT_STREAM_H
+#define DTFT_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// DTFT of long bitstreams (link captures of any length) at num_bins points
+// ω_k = πk/(num_bins-1) from 0 to π, the grid of the lookup table.
+//
+// On that grid e^{-jω_k n} repeats every period = 2(num_bins-1) samples, so a
+// block of the stream is summarized by how many of its set bits fall on each
+// residue n mod period. Blocks (cache-sized chunks of the packed stream) are
+// independent work items for any core, in any order: a block's residues start
+// at start mod period, the index form of its phase offset e^{-jω_k·start}.
+// The spectrum is evaluated once from the summed counts, so the cost is one
+// pass over the bits plus period * num_bins multiply-adds, and the counts are
+// exact.
+//
+// Bits are packed MSB first: bit n is (bits[n / 8] >> (7 - n % 8)) & 1.
+#define DTFT_STREAM_BLOCK_BITS 32768    // 4 KB of packed bits per block
+#define DTFT_STREAM_MAX_BINS 1025
+
+typedef struct {
+    int num_bins;
+    int period;             // 2 * (num_bins - 1)
+    float *twiddle;         // [period][cos, -sin] of π·i/(num_bins-1)
+} dtft_stream_plan_t;
+
+/**
+ * Precompute the twiddles for a bin count
+ * @param plan Plan to initialize
+ * @param num_bins Frequency points from 0 to π (2-DTFT_STREAM_MAX_BINS)
+ * @return false on invalid bin count or allocation failure
+ */
+bool dtft_stream_plan_init(dtft_stream_plan_t *plan, int num_bins);
+
+/**
+ * Free a plan's twiddles
+ */
+void dtft_stream_plan_free(dtft_stream_plan_t *plan);
+
+/**
+ * Number of DTFT_STREAM_BLOCK_BITS blocks in a stream (the last may be partial)
+ */
+uint32_t dtft_stream_num_blocks(uint32_t num_bits);
+
+/**
+ * Count the set bits of blocks [first_block, end_block) per residue, each
+ * block offset by its start
+ * @param plan Plan
+ * @param bits Packed stream
+ * @param num_bits Stream length in bits
+ * @param first_block First block to process
+ * @param end_block One past the last block
+ * @param residues Counts to add to (plan->period values, caller zeroes them)
+ */
+void dtft_stream_accumulate(const dtft_stream_plan_t *plan, const uint8_t *bits, uint32_t num_bits,
+                            uint32_t first_block, uint32_t end_block, uint32_t *residues);
+
+/**
+ * Evaluate the spectrum from residue counts
+ * @param plan Plan
+ * @param residues Counts from dtft_stream_accumulate() over all blocks
+ * @param output Complex values [real0, imag0, ...] (num_bins * 2 floats)
+ */
+void dtft_stream_evaluate(const dtft_stream_plan_t *plan, const uint32_t *residues, float *output);
+
+/**
+ * DTFT of a whole stream, blocks split between Core0 and Core1
+ * (Core0 only if init_core1_dtft() has not been called)
+ * @param plan Plan
+ * @param bits Packed stream
+ * @param num_bits Stream length in bits
+ * @param output Complex values [real0, imag0, ...] (num_bins * 2 floats)
+ * @return false on allocation failure
+ */
+bool dtft_stream(const dtft_stream_plan_t *plan, const uint8_t *bits, uint32_t num_bits, float *output);
+
+#endif // DTFT_STREAM_H
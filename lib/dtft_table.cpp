@@ -0,0 +1,20 @@
+#include "dtft_table.hpp"
+
+#if DTFT_TABLE_COMPLEMENT
+// n10 configuration stored as complement pairs
+static constexpr DtftComplementTable<DTFT_BIT_DEPTH, DTFT_N, DTFT_NUM_FREQUENCIES> n10_pairs{};
+
+static_assert(sizeof(n10_pairs.entries) == DTFT_NUM_PAIRS * DTFT_NUM_FREQUENCIES * sizeof(DTFTPoint),
+              "n10 pair table size mismatch");
+
+extern "C" const DTFTPoint (*const dtft_pairs_n10)[DTFT_NUM_FREQUENCIES] = n10_pairs.entries;
+extern "C" const float *const dtft_dc_n10 = n10_pairs.dc_magnitude;
+#else
+// n10 configuration: 8-bit values, 10 repetitions, 41 bins from 0 to π
+static constexpr DtftLookupTable<DTFT_BIT_DEPTH, DTFT_N, DTFT_NUM_FREQUENCIES> n10_table{};
+
+static_assert(sizeof(n10_table.entries) == DTFT_NUM_VALUES * DTFT_NUM_FREQUENCIES * sizeof(DTFTPoint),
+              "n10 table size mismatch");
+
+extern "C" const DTFTPoint (*const dtft_lookup_n10)[DTFT_NUM_FREQUENCIES] = n10_table.entries;
+#endif
@@ -0,0 +1,137 @@
+#ifndef DTFT_TABLE_H
+#define DTFT_TABLE_H
+
+#include <stdint.h>
+
+// DTFT Lookup Table for n=10
+// Grayscale resolution: 8-bit (256 levels, 0-255)
+// Sequence length: 80 bits (8 × 10 repetitions)
+// Frequencies: 41 (0 to π, resolution: π/40 rad/sample)
+// Magnitudes are squared, phases in radians
+//
+// Generated at compile time by dtft_table.cpp (DTFT_TABLE_GENERATED=ON, default)
+// or taken from the checked-in literal dtft_lookup_n10.h (DTFT_TABLE_GENERATED=OFF).
+// DTFT_TABLE_COMPLEMENT=1 (generated only) stores complement pairs instead:
+// rows for the 128 values with the MSB clear plus every value's DC bin, as a
+// pattern and its complement differ only in DC (phase shifted by π elsewhere).
+// Read entries through the dtft_table_* accessors, which work with either layout.
+
+typedef struct {
+    float magnitude;
+    float phase;
+    float frequency;
+} DTFTPoint;
+
+#define DTFT_BIT_DEPTH 8                                    // 8-bit grayscale
+#define DTFT_N 10
+#define DTFT_NUM_VALUES 256                              // 2^8 grayscale levels
+#define DTFT_NUM_FREQUENCIES 41
+#define DTFT_RESOLUTION (3.14159265f / 40)  // π/(40)
+#define DTFT_NUM_PAIRS 128                               // Complement pairs
+#define DTFT_COMPLEMENT_MASK 0xFF                         // value ^ mask = complement
+
+#ifndef DTFT_TABLE_COMPLEMENT
+#define DTFT_TABLE_COMPLEMENT 0
+#endif
+
+// Reduced bit depth tables (dtft_depth_table.cpp, always generated): values of
+// 1-7 bits repeated DTFT_N times on the grid of DTFT_N*bits/2 + 1 points from
+// 0 to π. Only the harmonic bins k = h*DTFT_N carry energy on that grid, so
+// each table holds those bins as complex values.
+#define DTFT_DEPTH_MIN_BITS 1
+#define DTFT_DEPTH_MAX_BITS 7
+
+typedef struct {
+    int bits;               // Bits per value
+    int num_bins;           // Grid points from 0 to π
+    int num_harmonics;      // Stored bins: k = h * DTFT_N, h = 0..bits/2
+    const float *entries;   // [1 << bits][num_harmonics][re, im]
+} dtft_depth_table_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Table for a reduced bit depth
+ * @param bits Bits per value (DTFT_DEPTH_MIN_BITS-DTFT_DEPTH_MAX_BITS)
+ * @return Table, or NULL for other depths
+ */
+const dtft_depth_table_t *dtft_depth_table(int bits);
+
+#if DTFT_TABLE_COMPLEMENT
+// [128 values with the MSB clear][41 frequencies] and DC squared magnitude [256] in flash
+extern const DTFTPoint (*const dtft_pairs_n10)[DTFT_NUM_FREQUENCIES];
+extern const float *const dtft_dc_n10;
+#else
+// DTFT data: [256 values][41 frequencies][magnitude, phase, frequency] in flash
+extern const DTFTPoint (*const dtft_lookup_n10)[DTFT_NUM_FREQUENCIES];
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * The value of a complement pair that has a row (MSB clear)
+ */
+static inline int dtft_table_representative(int value) {
+    return value & DTFT_NUM_PAIRS ? value ^ DTFT_COMPLEMENT_MASK : value;
+}
+
+/**
+ * Row shared by a value and its complement; bins 1-40 are exact for the
+ * representative and equal in magnitude for the complement
+ * @param representative Value with the MSB clear (0-127)
+ */
+static inline const DTFTPoint *dtft_table_pair_row(int representative) {
+#if DTFT_TABLE_COMPLEMENT
+    return dtft_pairs_n10[representative];
+#else
+    return dtft_lookup_n10[representative];
+#endif
+}
+
+/**
+ * Squared DC magnitude of a value
+ */
+static inline float dtft_table_dc(int value) {
+#if DTFT_TABLE_COMPLEMENT
+    return dtft_dc_n10[value];
+#else
+    return dtft_lookup_n10[value][0].magnitude;
+#endif
+}
+
+/**
+ * Squared magnitude of a value at one bin
+ */
+static inline float dtft_table_magnitude(int value, int freq) {
+#if DTFT_TABLE_COMPLEMENT
+    if (freq == 0) {
+        return dtft_dc_n10[value];
+    }
+    return dtft_pairs_n10[dtft_table_representative(value)][freq].magnitude;
+#else
+    return dtft_lookup_n10[value][freq].magnitude;
+#endif
+}
+
+/**
+ * Table entry of a value at one bin
+ */
+static inline DTFTPoint dtft_table_point(int value, int freq) {
+#if DTFT_TABLE_COMPLEMENT
+    DTFTPoint point = dtft_pairs_n10[dtft_table_representative(value)][freq];
+    if (freq == 0) {
+        point.magnitude = dtft_dc_n10[value];
+    } else if (value & DTFT_NUM_PAIRS) {
+        point.phase += point.phase > 0.0f ? -3.14159265f : 3.14159265f;
+    }
+    return point;
+#else
+    return dtft_lookup_n10[value][freq];
+#endif
+}
+
+#endif // DTFT_TABLE_H
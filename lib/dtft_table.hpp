@@ -0,0 +1,151 @@
+#ifndef DTFT_TABLE_HPP
+#define DTFT_TABLE_HPP
+
+#include "dtft_table.h"
+#include "ct_math.hpp"
+
+// Compile-time generator for DTFT lookup tables.
+//
+// Entry [value][k] describes the DTFT of `value` (Width bits, MSB sent first)
+// repeated Reps times, at ω_k = πk/(Bins-1):
+//   magnitude = |X(ω_k)|^2 (squared, as the matcher compares squared magnitudes)
+//   phase     = arg X(ω_k)
+//   frequency = ω_k
+// X is evaluated over one period with exact twiddles (integer range reduction)
+// times the repetition gain Σ_r e^{-jω·Width·r}. Where that gain cancels
+// analytically the entry is exactly zero.
+// Declare instances constexpr at namespace scope: constant initialization
+// places them in .rodata (flash) with no startup cost.
+
+// Twiddles and repetition gain shared by the table generators
+template <int Width, int Reps, int Bins>
+struct DtftTwiddles {
+    double cos_tw[Bins][Width];
+    double sin_tw[Bins][Width];
+    double gain_re[Bins];
+    double gain_im[Bins];
+
+    constexpr DtftTwiddles() : cos_tw(), sin_tw(), gain_re(), gain_im() {
+        for (int k = 0; k < Bins; k++) {
+            for (int n = 0; n < Width; n++) {
+                cos_tw[k][n] = ct::cos_pi_ratio((long)k * n, Bins - 1);
+                sin_tw[k][n] = -ct::sin_pi_ratio((long)k * n, Bins - 1);
+            }
+            for (int r = 0; r < Reps; r++) {
+                gain_re[k] += ct::cos_pi_ratio((long)k * Width * r, Bins - 1);
+                gain_im[k] -= ct::sin_pi_ratio((long)k * Width * r, Bins - 1);
+            }
+            if (ct::abs(gain_re[k]) < 1e-9 && ct::abs(gain_im[k]) < 1e-9) {
+                gain_re[k] = 0.0;
+                gain_im[k] = 0.0;
+            }
+        }
+    }
+
+    // X(ω_k) of `value` repeated Reps times
+    constexpr void spectrum(int value, int k, double &x_re, double &x_im) const {
+        double re = 0.0;
+        double im = 0.0;
+        for (int n = 0; n < Width; n++) {
+            if ((value >> (Width - 1 - n)) & 1) {
+                re += cos_tw[k][n];
+                im += sin_tw[k][n];
+            }
+        }
+        x_re = re * gain_re[k] - im * gain_im[k];
+        x_im = re * gain_im[k] + im * gain_re[k];
+    }
+};
+
+template <int Width, int Reps, int Bins>
+struct DtftLookupTable {
+    static constexpr int kValues = 1 << Width;
+    static constexpr int kBins = Bins;
+
+    DTFTPoint entries[kValues][Bins];
+
+    constexpr DtftLookupTable() : entries() {
+        const DtftTwiddles<Width, Reps, Bins> tw{};
+        for (int value = 0; value < kValues; value++) {
+            for (int k = 0; k < Bins; k++) {
+                double x_re = 0.0;
+                double x_im = 0.0;
+                tw.spectrum(value, k, x_re, x_im);
+
+                entries[value][k].magnitude = (float)(x_re * x_re + x_im * x_im);
+                entries[value][k].phase = (float)ct::atan2(x_im, x_re);
+                entries[value][k].frequency = (float)(ct::kPi * k / (Bins - 1));
+            }
+        }
+    }
+};
+
+// Complement-pair storage of the same table. A pattern's complement is the
+// all-ones signal minus the pattern, and Width*Reps ones vanish at every bin
+// but DC when the sequence spans whole periods of every ω_k. There
+// X(~v) = -X(v): same squared magnitude, phase shifted by π. Only values with
+// the MSB clear get a row; the DC squared magnitude is kept for every value.
+template <int Width, int Reps, int Bins>
+struct DtftComplementTable {
+    static_assert((Width * Reps) % (2 * (Bins - 1)) == 0,
+                  "all-ones sequence must be zero outside DC for complement pairs");
+
+    static constexpr int kValues = 1 << Width;
+    static constexpr int kPairs = kValues / 2;
+    static constexpr int kBins = Bins;
+
+    DTFTPoint entries[kPairs][Bins];   // Bin 0 holds the representative's own DC
+    float dc_magnitude[kValues];
+
+    constexpr DtftComplementTable() : entries(), dc_magnitude() {
+        const DtftTwiddles<Width, Reps, Bins> tw{};
+        for (int value = 0; value < kValues; value++) {
+            double x_re = 0.0;
+            double x_im = 0.0;
+            tw.spectrum(value, 0, x_re, x_im);
+            dc_magnitude[value] = (float)(x_re * x_re + x_im * x_im);
+        }
+        for (int value = 0; value < kPairs; value++) {
+            for (int k = 0; k < Bins; k++) {
+                double x_re = 0.0;
+                double x_im = 0.0;
+                tw.spectrum(value, k, x_re, x_im);
+
+                entries[value][k].magnitude = (float)(x_re * x_re + x_im * x_im);
+                entries[value][k].phase = (float)ct::atan2(x_im, x_re);
+                entries[value][k].frequency = (float)(ct::kPi * k / (Bins - 1));
+            }
+        }
+    }
+};
+
+// Reduced bit depth table: Width-bit values repeated Reps times on the grid of
+// Reps*Width/2 + 1 points from 0 to π (the n10 grid for Width 8). The sequence
+// then spans whole periods of every ω_k and the repetition gain vanishes
+// except at the harmonics k = h*Reps, h = 0..Width/2, where it is Reps. Only
+// those bins are stored, as complex values, for direct complex matching.
+template <int Width, int Reps>
+struct DtftHarmonicTable {
+    static_assert((Width * Reps) % 2 == 0, "grid needs an even sequence length");
+
+    static constexpr int kValues = 1 << Width;
+    static constexpr int kBins = Width * Reps / 2 + 1;
+    static constexpr int kHarmonics = Width / 2 + 1;
+
+    float entries[kValues][kHarmonics][2];  // [re, im] at bin h*Reps
+
+    constexpr DtftHarmonicTable() : entries() {
+        const DtftTwiddles<Width, Reps, kBins> tw{};
+        for (int value = 0; value < kValues; value++) {
+            for (int h = 0; h < kHarmonics; h++) {
+                double x_re = 0.0;
+                double x_im = 0.0;
+                tw.spectrum(value, h * Reps, x_re, x_im);
+                entries[value][h][0] = (float)x_re;
+                entries[value][h][1] = (float)x_im;
+            }
+        }
+    }
+};
+
+#endif // DTFT_TABLE_HPP
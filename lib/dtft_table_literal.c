@@ -0,0 +1,4 @@
+#include "dtft_table.h"
+#include "dtft_lookup_n10.h"
+
+const DTFTPoint (*const dtft_lookup_n10)[DTFT_NUM_FREQUENCIES] = dtft_lookup_n10_data;
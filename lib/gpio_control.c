@@ -1,12 +1,26 @@
 #include "gpio_control.h"
+#include "mem_stats.h"
 #include "pico/stdlib.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef CYW43_WL_GPIO_LED_PIN
 #include "pico/cyw43_arch.h"
 #endif
 
+const uint8_t receiver_gpios[MAX_RECEIVERS] = RECEIVER_GPIO_LIST;
+
+static uint32_t bit_period_us = BIT_PERIOD_US;
+
+void set_bit_period_us(uint32_t period_us) {
+    bit_period_us = period_us;
+}
+
+uint32_t get_bit_period_us(void) {
+    return bit_period_us;
+}
+
 int pico_led_init(void) {
 #if defined(PICO_DEFAULT_LED_PIN)
     gpio_init(PICO_DEFAULT_LED_PIN);
@@ -53,12 +67,12 @@ void send_bit(uint8_t bit) {
     // Clock pulse: high for half the bit time
     gpio_put(CLOCK_GPIO, 1);
     pico_set_led(true);
-    sleep_ms(BIT_DELAY_MS / 2);
+    sleep_us(bit_period_us / 2);
     
     // Clock pulse: low for the other half
     gpio_put(CLOCK_GPIO, 0);
     pico_set_led(false);
-    sleep_ms(BIT_DELAY_MS / 2);
+    sleep_us(bit_period_us / 2);
 }
 
 uint8_t* send_data(uint16_t data, uint8_t num_bits) {
@@ -68,7 +82,7 @@ uint8_t* send_data(uint16_t data, uint8_t num_bits) {
     }
 
     // Allocate array: first element stores num_bits, rest store the actual bits
-    uint8_t *bits_sent = malloc((num_bits + 1) * sizeof(uint8_t));
+    uint8_t *bits_sent = MEM_MALLOC((num_bits + 1) * sizeof(uint8_t));
     bits_sent[0] = num_bits;  // Store the length in first element
 
 #ifdef DEBUG
@@ -100,6 +114,138 @@ uint8_t* send_data(uint16_t data, uint8_t num_bits) {
 }
 
 uint8_t* send_receive_data(uint16_t data, uint8_t num_bits, uint8_t sample_divisor) {
+    // Single receiver on GPIO3
+    return send_receive_data_multi(data, num_bits, sample_divisor, 1);
+}
+
+uint8_t* send_receive_data_soft(uint16_t data, uint8_t num_bits, uint8_t oversample) {
+    if (num_bits < 1 || num_bits > 16) {
+        printf("Error: num_bits must be between 1 and 16\n");
+        return NULL;
+    }
+
+    if (oversample < 1) {
+        printf("Error: oversample must be at least 1\n");
+        return NULL;
+    }
+
+    uint8_t *counts = MEM_MALLOC((num_bits + 1) * sizeof(uint8_t));
+    if (!counts) return NULL;
+    counts[0] = num_bits;
+
+    // Ensure known idle states
+    gpio_put(SIGNAL_GPIO, 0);
+    gpio_put(CLOCK_GPIO, 0);
+    sleep_us(100);
+
+    // Transmission start
+    gpio_put(TX_ACTIVE_GPIO, 1);
+
+    for (int i = num_bits - 1; i >= 0; i--) {
+        gpio_put(SIGNAL_GPIO, (data >> i) & 1);
+
+        // Rising edge of clock
+        gpio_put(CLOCK_GPIO, 1);
+        pico_set_led(true);
+        sleep_us(bit_period_us / 4);
+
+        // Read the receiver repeatedly while the clock is high
+        uint8_t high = 0;
+        for (int r = 0; r < oversample; r++) {
+            high += gpio_get(RECEIVER_GPIO) & 1;
+        }
+        counts[num_bits - i] = high;
+
+        sleep_us(bit_period_us / 4);
+
+        // Falling edge of clock
+        gpio_put(CLOCK_GPIO, 0);
+        pico_set_led(false);
+        sleep_us(bit_period_us / 2);
+    }
+
+    // Reset lines
+    gpio_put(SIGNAL_GPIO, 0);
+    sleep_us(100);
+
+    // Transmission end
+    gpio_put(TX_ACTIVE_GPIO, 0);
+
+    return counts;
+}
+
+bool send_receive_stream(const uint8_t *tx, uint32_t num_bits, uint8_t sample_divisor, uint8_t *rx) {
+    if (!tx || num_bits < 1) {
+        printf("Error: empty bitstream\n");
+        return false;
+    }
+
+    if (sample_divisor < 1) {
+        printf("Error: sample_divisor must be at least 1\n");
+        return false;
+    }
+
+    if (rx) {
+        memset(rx, 0, (num_bits + 7) / 8);
+    }
+
+    // Ensure known idle states
+    gpio_put(SIGNAL_GPIO, 0);
+    gpio_put(CLOCK_GPIO, 0);
+    sleep_us(100);
+
+    // Transmission start
+    gpio_put(TX_ACTIVE_GPIO, 1);
+
+    bool last_sampled = false;
+    for (uint32_t n = 0; n < num_bits; n++) {
+        const uint8_t mask = (uint8_t)(0x80 >> (n % 8));
+        gpio_put(SIGNAL_GPIO, (tx[n / 8] & mask) != 0);
+
+        // Rising edge of clock
+        gpio_put(CLOCK_GPIO, 1);
+        pico_set_led(true);
+        sleep_us(bit_period_us / 4);
+
+        // Sample on positions divisible by sample_divisor, hold otherwise
+        if (n % sample_divisor == 0) {
+            last_sampled = gpio_get(RECEIVER_GPIO);
+        }
+        if (rx && last_sampled) {
+            rx[n / 8] |= mask;
+        }
+
+        sleep_us(bit_period_us / 4);
+
+        // Falling edge of clock
+        gpio_put(CLOCK_GPIO, 0);
+        pico_set_led(false);
+        sleep_us(bit_period_us / 2);
+    }
+
+    // Reset lines
+    gpio_put(SIGNAL_GPIO, 0);
+    sleep_us(100);
+
+    // Transmission end
+    gpio_put(TX_ACTIVE_GPIO, 0);
+
+    return true;
+}
+
+void init_receiver_gpios(int num_channels) {
+    if (num_channels > MAX_RECEIVERS) {
+        num_channels = MAX_RECEIVERS;
+    }
+    for (int c = 1; c < num_channels; c++) {
+        gpio_init(receiver_gpios[c]);
+        gpio_set_dir(receiver_gpios[c], GPIO_IN);
+        gpio_pull_down(receiver_gpios[c]);
+    }
+}
+
+uint8_t* send_receive_data_multi(uint16_t data, uint8_t num_bits, uint8_t sample_divisor,
+                                 int num_channels) {
     if (num_bits < 1 || num_bits > 16) {
         printf("Error: num_bits must be between 1 and 16\n");
         return NULL;
@@ -110,10 +256,18 @@ uint8_t* send_receive_data(uint16_t data, uint8_t num_bits, uint8_t sample_divis
         return NULL;
     }
 
-    // Allocate array: first element stores num_bits, rest store the received bits
-    uint8_t *bits_recv = malloc((num_bits + 1) * sizeof(uint8_t));
+    if (num_channels < 1 || num_channels > MAX_RECEIVERS) {
+        printf("Error: num_channels must be between 1 and %d\n", MAX_RECEIVERS);
+        return NULL;
+    }
+
+    // One record per channel: first element stores num_bits, rest store the received bits
+    const int record_len = num_bits + 1;
+    uint8_t *bits_recv = MEM_MALLOC(num_channels * record_len * sizeof(uint8_t));
     if (!bits_recv) return NULL;
-    bits_recv[0] = num_bits;
+    for (int c = 0; c < num_channels; c++) {
+        bits_recv[c * record_len] = num_bits;
+    }
 
 #ifdef DEBUG
     printf("Send pattern (TX): ");
@@ -121,7 +275,8 @@ uint8_t* send_receive_data(uint16_t data, uint8_t num_bits, uint8_t sample_divis
         printf("%d", (data >> i) & 1);
     }
     printf("\n");
-    printf("Sampling rate: 1/%d (sampling every %d bits)\n", sample_divisor, sample_divisor);
+    printf("Sampling rate: 1/%d (sampling every %d bits), %d receiver(s)\n",
+           sample_divisor, sample_divisor, num_channels);
 #endif
 
     // Ensure known idle states
@@ -132,8 +287,8 @@ uint8_t* send_receive_data(uint16_t data, uint8_t num_bits, uint8_t sample_divis
     // Transmission start
     gpio_put(TX_ACTIVE_GPIO, 1);
 
-    // Track last sampled bit for sample-and-hold
-    uint8_t last_sampled_bit = 0;
+    // Track last sampled bits of all receivers for sample-and-hold
+    uint32_t last_sampled = 0;
 
     for (int i = num_bits - 1; i >= 0; i--) {
         uint8_t tx_bit = (data >> i) & 1;
@@ -147,29 +302,26 @@ uint8_t* send_receive_data(uint16_t data, uint8_t num_bits, uint8_t sample_divis
         pico_set_led(true);
 
         // Allow setup time before sampling
-        sleep_ms(BIT_DELAY_MS / 4);
+        sleep_us(bit_period_us / 4);
 
-        // Sample receiver on GPIO3 - only on positions divisible by sample_divisor
-        uint8_t rx_bit;
+        // Sample all receivers at once - only on positions divisible by sample_divisor,
+        // otherwise hold the last sampled values
         if (bit_position % sample_divisor == 0) {
-            // Sample this bit
-            rx_bit = gpio_get(RECEIVER_GPIO) & 1;
-            last_sampled_bit = rx_bit;  // Update last sampled value
-        } else {
-            // Don't sample - hold the last sampled value
-            rx_bit = last_sampled_bit;
+            last_sampled = gpio_get_all();
+        }
+        for (int c = 0; c < num_channels; c++) {
+            bits_recv[c * record_len + num_bits - i] = (last_sampled >> receiver_gpios[c]) & 1;
         }
-        bits_recv[num_bits - i] = rx_bit;
 
         // Hold clock high for remaining half-bit
-        sleep_ms(BIT_DELAY_MS / 4);
+        sleep_us(bit_period_us / 4);
 
         // Falling edge of clock
         gpio_put(CLOCK_GPIO, 0);
         pico_set_led(false);
 
         // Low period
-        sleep_ms(BIT_DELAY_MS / 2);
+        sleep_us(bit_period_us / 2);
     }
 
     // Reset lines
@@ -181,3 +333,85 @@ uint8_t* send_receive_data(uint16_t data, uint8_t num_bits, uint8_t sample_divis
 
     return bits_recv;
 }
+
+bool link_tx_begin(link_tx_t *tx, uint16_t data, uint8_t num_bits, uint8_t sample_divisor,
+                   int num_channels, uint8_t *bits_recv) {
+    if (num_bits < 1 || num_bits > 16) {
+        printf("Error: num_bits must be between 1 and 16\n");
+        return false;
+    }
+    if (sample_divisor < 1) {
+        printf("Error: sample_divisor must be at least 1\n");
+        return false;
+    }
+    if (num_channels < 1 || num_channels > MAX_RECEIVERS) {
+        printf("Error: num_channels must be between 1 and %d\n", MAX_RECEIVERS);
+        return false;
+    }
+    PT_INIT(&tx->pt);
+    tx->wake_us = time_us_64();
+    tx->data = data;
+    tx->num_bits = num_bits;
+    tx->sample_divisor = sample_divisor;
+    tx->num_channels = num_channels;
+    tx->last_sampled = 0;
+    tx->bits_recv = bits_recv;
+    for (int c = 0; c < num_channels; c++) {
+        bits_recv[c * (num_bits + 1)] = num_bits;
+    }
+    return true;
+}
+
+// Wait until the next edge, bit_period_us-relative like the sleeps of send_receive_data_multi()
+#define LINK_TX_WAIT(tx, us)                                    \
+    do {                                                        \
+        (tx)->wake_us += (us);                                  \
+        PT_WAIT_UNTIL(&(tx)->pt, time_us_64() >= (tx)->wake_us); \
+    } while (0)
+
+int link_tx_run(void *arg) {
+    link_tx_t *tx = arg;
+    const int record_len = tx->num_bits + 1;
+
+    PT_BEGIN(&tx->pt);
+
+    // Ensure known idle states
+    gpio_put(SIGNAL_GPIO, 0);
+    gpio_put(CLOCK_GPIO, 0);
+    LINK_TX_WAIT(tx, 100);
+
+    // Transmission start
+    gpio_put(TX_ACTIVE_GPIO, 1);
+
+    for (tx->bit = tx->num_bits - 1; tx->bit >= 0; tx->bit--) {
+        gpio_put(SIGNAL_GPIO, (tx->data >> tx->bit) & 1);
+
+        // Rising edge of clock, sample after the setup time
+        gpio_put(CLOCK_GPIO, 1);
+        pico_set_led(true);
+        LINK_TX_WAIT(tx, bit_period_us / 4);
+
+        if ((tx->num_bits - 1 - tx->bit) % tx->sample_divisor == 0) {
+            tx->last_sampled = gpio_get_all();
+        }
+        for (int c = 0; c < tx->num_channels; c++) {
+            tx->bits_recv[c * record_len + tx->num_bits - tx->bit] =
+                (tx->last_sampled >> receiver_gpios[c]) & 1;
+        }
+        LINK_TX_WAIT(tx, bit_period_us / 4);
+
+        // Falling edge of clock, low period
+        gpio_put(CLOCK_GPIO, 0);
+        pico_set_led(false);
+        LINK_TX_WAIT(tx, bit_period_us / 2);
+    }
+
+    // Reset lines
+    gpio_put(SIGNAL_GPIO, 0);
+    LINK_TX_WAIT(tx, 100);
+
+    // Transmission end
+    gpio_put(TX_ACTIVE_GPIO, 0);
+
+    PT_END(&tx->pt);
+}
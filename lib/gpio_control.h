@@ -3,12 +3,25 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "pt.h"
 
 #define SIGNAL_GPIO 2
 #define RECEIVER_GPIO 3
 #define CLOCK_GPIO 4
 #define TX_ACTIVE_GPIO 5
-#define BIT_DELAY_MS 1
+
+// Default bit period in microseconds: clock high for the first half (receiver
+// sampled after a quarter), low for the second. 0 runs the link as fast as the
+// GPIO loop allows. Change at runtime with set_bit_period_us().
+#define BIT_PERIOD_US 0
+
+// Multi-receiver input: channel 0 is RECEIVER_GPIO, further channels use the
+// pins below. All enabled receivers are sampled on the same clock edge.
+#define MAX_RECEIVERS 8
+#define RECEIVER_GPIO_LIST {RECEIVER_GPIO, 6, 7, 8, 9, 10, 11, 12}
+
+// Receiver pin for each channel (RECEIVER_GPIO_LIST)
+extern const uint8_t receiver_gpios[MAX_RECEIVERS];
 
 /**
  * Initialize LED GPIO
@@ -22,6 +35,18 @@ int pico_led_init(void);
  */
 void pico_set_led(bool led_on);
 
+/**
+ * Set the bit period used by all send functions
+ * @param period_us Bit period in microseconds (0 = no delay)
+ */
+void set_bit_period_us(uint32_t period_us);
+
+/**
+ * Get the current bit period
+ * @return Bit period in microseconds
+ */
+uint32_t get_bit_period_us(void);
+
 /**
  * Initialize GPIO pins for signal transmission
  */
@@ -37,7 +62,7 @@ void send_bit(uint8_t bit);
  * Send data on GPIO2 (1-16 bits)
  * @param data The value to send
  * @param num_bits Number of bits to send (1-16)
- * @return Array of bits sent (caller must free). First element is num_bits, rest are the bits.
+ * @return Array of bits sent (caller frees with MEM_FREE()). First element is num_bits, rest are the bits.
  */
 uint8_t* send_data(uint16_t data, uint8_t num_bits);
 
@@ -46,8 +71,87 @@ uint8_t* send_data(uint16_t data, uint8_t num_bits);
  * @param data The value to send
  * @param num_bits Number of bits to send (1-16)
  * @param sample_divisor Sampling rate divisor (1=full rate, 2=half rate, 4=quarter rate, etc.)
- * @return Array of bits received (caller must free). First element is num_bits, rest are the bits.
+ * @return Array of bits received (caller frees with MEM_FREE()). First element is num_bits, rest are the bits.
  */
 uint8_t* send_receive_data(uint16_t data, uint8_t num_bits, uint8_t sample_divisor);
 
+/**
+ * Send data on GPIO2 and read the receiver several times per bit (soft reception)
+ * Each element counts how many of the oversample reads were high, so a clean
+ * bit reads 0 or oversample and a disturbed one lands in between
+ * @param data The value to send
+ * @param num_bits Number of bits to send (1-16)
+ * @param oversample Receiver reads per bit (1-255)
+ * @return Array of counts (caller frees with MEM_FREE()). First element is num_bits, rest are the counts.
+ */
+uint8_t* send_receive_data_soft(uint16_t data, uint8_t num_bits, uint8_t oversample);
+
+/**
+ * Send a bitstream of any length on GPIO2 while sampling the receiver on GPIO3
+ * Same bit timing and sample-and-hold as send_receive_data(). Bits are packed
+ * MSB first: bit n is (bits[n / 8] >> (7 - n % 8)) & 1
+ * @param tx Bits to send ((num_bits + 7) / 8 bytes)
+ * @param num_bits Number of bits to send
+ * @param sample_divisor Sampling rate divisor (1=full rate, 2=half rate, 4=quarter rate, etc.)
+ * @param rx Output: received bits, packed the same way ((num_bits + 7) / 8 bytes, may be NULL)
+ * @return false on invalid arguments
+ */
+bool send_receive_stream(const uint8_t *tx, uint32_t num_bits, uint8_t sample_divisor, uint8_t *rx);
+
+/**
+ * Initialize receiver inputs for channels 1..num_channels-1
+ * (channel 0, RECEIVER_GPIO, is set up by init_signal_gpio)
+ * @param num_channels Number of receiver channels in use (1-MAX_RECEIVERS)
+ */
+void init_receiver_gpios(int num_channels);
+
+/**
+ * Send data on GPIO2 while sampling several receiver pins on each clock
+ * All pins are read with a single gpio_get_all(), so channels see the same instant
+ * @param data The value to send
+ * @param num_bits Number of bits to send (1-16)
+ * @param sample_divisor Sampling rate divisor (1=full rate, 2=half rate, 4=quarter rate, etc.)
+ * @param num_channels Number of receiver channels to sample (1-MAX_RECEIVERS)
+ * @return num_channels records of num_bits + 1 bytes, record c at c * (num_bits + 1),
+ *         each laid out like send_receive_data() (caller frees with MEM_FREE())
+ */
+uint8_t* send_receive_data_multi(uint16_t data, uint8_t num_bits, uint8_t sample_divisor,
+                                 int num_channels);
+
+// Transmitter as a protothread (coop_sched.h): the same edges and sampling as
+// send_receive_data_multi(), but instead of sleeping it returns PT_WAITING with
+// wake_us set to its next edge. Edge times are kept from the start of the
+// transfer, so a late step does not shift the ones after it.
+typedef struct {
+    pt_t pt;
+    uint64_t wake_us;       // Time of the next step
+    uint16_t data;
+    uint8_t num_bits;
+    uint8_t sample_divisor;
+    int num_channels;
+    int bit;                // Bit being sent (MSB first)
+    uint32_t last_sampled;
+    uint8_t *bits_recv;
+} link_tx_t;
+
+/**
+ * Prepare a transfer for link_tx_run()
+ * @param tx Transmitter state
+ * @param data The value to send
+ * @param num_bits Number of bits to send (1-16)
+ * @param sample_divisor Sampling rate divisor (1=full rate, 2=half rate, 4=quarter rate, etc.)
+ * @param num_channels Number of receiver channels to sample (1-MAX_RECEIVERS)
+ * @param bits_recv Output: num_channels records of num_bits + 1 bytes, laid out
+ *                  like send_receive_data_multi()
+ * @return false on invalid arguments
+ */
+bool link_tx_begin(link_tx_t *tx, uint16_t data, uint8_t num_bits, uint8_t sample_divisor,
+                   int num_channels, uint8_t *bits_recv);
+
+/**
+ * Step the transfer (protothread): drive the edges that are due
+ * @return PT_WAITING until wake_us, PT_ENDED when the transfer is complete
+ */
+int link_tx_run(void *tx);
+
 #endif // GPIO_CONTROL_H
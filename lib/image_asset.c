@@ -0,0 +1,208 @@
+#include "image_asset.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef IMAGE_ASSET_FLASH_OFFSET
+#include "hardware/regs/addressmap.h"
+#else
+// Linked in by image_asset_blob.S
+extern const uint8_t image_asset_blob[];
+extern const uint8_t image_asset_blob_end[];
+#endif
+
+const uint8_t* image_asset_get(uint32_t *size) {
+#ifdef IMAGE_ASSET_FLASH_OFFSET
+    // Asset flashed separately, e.g. picotool load image.pimg -t bin -o <XIP_BASE + offset>
+    *size = UINT32_MAX;
+    return (const uint8_t *)(XIP_BASE + IMAGE_ASSET_FLASH_OFFSET);
+#else
+    *size = (uint32_t)(image_asset_blob_end - image_asset_blob);
+    return image_asset_blob;
+#endif
+}
+
+bool image_reader_open(image_reader_t *reader, const uint8_t *asset, uint32_t asset_size) {
+    if (!asset || asset_size < sizeof(image_asset_header_t)) {
+        printf("Error: image asset missing or truncated\n");
+        return false;
+    }
+
+    // Header may be unaligned in flash, copy it out
+    memcpy(&reader->header, asset, sizeof(image_asset_header_t));
+    const image_asset_header_t *h = &reader->header;
+
+    if (h->magic != IMAGE_ASSET_MAGIC ||
+        (h->version != IMAGE_ASSET_VERSION && h->version != IMAGE_ASSET_VERSION_TILED)) {
+        printf("Error: not an image asset (magic 0x%08lX, version %d)\n",
+               (unsigned long)h->magic, h->version);
+        return false;
+    }
+    if (h->bits_per_pixel < 1 || h->bits_per_pixel > 8 ||
+        h->compression > IMAGE_COMPRESSION_RLE ||
+        h->header_size < sizeof(image_asset_header_t)) {
+        printf("Error: unsupported image asset format\n");
+        return false;
+    }
+    if (asset_size != UINT32_MAX && (uint64_t)h->header_size + h->data_size > asset_size) {
+        printf("Error: image asset payload truncated\n");
+        return false;
+    }
+
+    // Pixel count must fit the uint32_t the reader counts in, and its packed
+    // bytes the payload (PackBits expands 2 bytes to at most 128)
+    const uint64_t num_pixels = (uint64_t)h->width * h->height;
+    const uint64_t packed_size = (num_pixels * h->bits_per_pixel + 7) / 8;
+    const uint64_t max_packed = h->compression == IMAGE_COMPRESSION_RLE ?
+                                (uint64_t)h->data_size * 64 : h->data_size;
+    if (num_pixels > UINT32_MAX || packed_size > max_packed) {
+        printf("Error: image asset size %lux%lu does not fit its %lu byte payload\n",
+               (unsigned long)h->width, (unsigned long)h->height, (unsigned long)h->data_size);
+        return false;
+    }
+
+    // Raster assets stream one row per tile
+    reader->tile_width = h->width;
+    reader->tile_height = 1;
+    if (h->version == IMAGE_ASSET_VERSION_TILED) {
+        image_asset_tiling_t tiling;
+        if (h->header_size < sizeof(image_asset_header_t) + sizeof(tiling)) {
+            printf("Error: tiled image asset header truncated\n");
+            return false;
+        }
+        memcpy(&tiling, asset + sizeof(image_asset_header_t), sizeof(tiling));
+        if (tiling.tile_width == 0 || tiling.tile_height == 0) {
+            printf("Error: image asset has empty tiles\n");
+            return false;
+        }
+        reader->tile_width = tiling.tile_width;
+        reader->tile_height = tiling.tile_height;
+    }
+
+    reader->payload = asset + h->header_size;
+    image_reader_rewind(reader);
+    return true;
+}
+
+bool image_reader_open_raster(image_reader_t *reader, const uint8_t *asset, uint32_t asset_size) {
+    if (!image_reader_open(reader, asset, asset_size)) {
+        return false;
+    }
+    if (reader->header.version == IMAGE_ASSET_VERSION_TILED) {
+        printf("Error: tiled image asset (%lux%lu tiles) is streamed tile by tile; "
+               "use the tiled mode (mode = 3)\n",
+               (unsigned long)reader->tile_width, (unsigned long)reader->tile_height);
+        return false;
+    }
+    return true;
+}
+
+void image_reader_rewind(image_reader_t *reader) {
+    reader->pos = 0;
+    reader->pixels_read = 0;
+    reader->run_remaining = 0;
+    reader->run_literal = false;
+    reader->bits_left = 0;
+}
+
+/**
+ * Fetch the next packed byte, decoding PackBits runs if enabled
+ * @return false at end of payload
+ */
+static bool next_packed_byte(image_reader_t *reader, uint8_t *out) {
+    const uint32_t size = reader->header.data_size;
+
+    if (reader->header.compression == IMAGE_COMPRESSION_NONE) {
+        if (reader->pos >= size) return false;
+        *out = reader->payload[reader->pos++];
+        return true;
+    }
+
+    // PackBits: control n in 0..127 -> n+1 literal bytes,
+    // n in -127..-1 -> next byte repeated 1-n times, -128 -> no-op
+    while (reader->run_remaining == 0) {
+        if (reader->pos >= size) return false;
+        int8_t control = (int8_t)reader->payload[reader->pos++];
+        if (control >= 0) {
+            reader->run_remaining = control + 1;
+            reader->run_literal = true;
+        } else if (control != -128) {
+            if (reader->pos >= size) return false;
+            reader->run_remaining = 1 - control;
+            reader->run_literal = false;
+            reader->run_byte = reader->payload[reader->pos++];
+        }
+    }
+
+    reader->run_remaining--;
+    if (reader->run_literal) {
+        if (reader->pos >= size) return false;
+        *out = reader->payload[reader->pos++];
+    } else {
+        *out = reader->run_byte;
+    }
+    return true;
+}
+
+uint32_t image_reader_read(image_reader_t *reader, uint8_t *dst, uint32_t count) {
+    const uint32_t total = reader->header.width * reader->header.height;
+    const uint8_t bpp = reader->header.bits_per_pixel;
+    const uint8_t mask = (uint8_t)((1u << bpp) - 1);
+
+    if (count > total - reader->pixels_read) {
+        count = total - reader->pixels_read;
+    }
+
+    uint32_t n = 0;
+    for (; n < count; n++) {
+        if (bpp == 8) {
+            if (!next_packed_byte(reader, &dst[n])) break;
+            continue;
+        }
+
+        // Pixels never straddle a byte boundary for 1, 2 and 4 bpp; other
+        // depths are assembled bit by bit
+        uint8_t value = 0;
+        uint8_t needed = bpp;
+        while (needed > 0) {
+            if (reader->bits_left == 0) {
+                if (!next_packed_byte(reader, &reader->cur_byte)) goto done;
+                reader->bits_left = 8;
+            }
+            uint8_t take = needed < reader->bits_left ? needed : reader->bits_left;
+            uint8_t shift = reader->bits_left - take;
+            value = (uint8_t)((value << take) | ((reader->cur_byte >> shift) & ((1u << take) - 1)));
+            reader->bits_left -= take;
+            needed -= take;
+        }
+        value &= mask;
+
+        // Expand to 8 bits by bit replication (full scale maps to 0xFF)
+        uint16_t expanded = 0;
+        for (int filled = 0; filled < 8; filled += bpp) {
+            expanded = (uint16_t)((expanded << bpp) | value);
+        }
+        dst[n] = (uint8_t)(expanded >> (((8 + bpp - 1) / bpp) * bpp - 8));
+    }
+
+done:
+    reader->pixels_read += n;
+    return n;
+}
+
+uint32_t image_reader_tile_count(const image_reader_t *reader) {
+    uint32_t tiles_x = (reader->header.width + reader->tile_width - 1) / reader->tile_width;
+    uint32_t tiles_y = (reader->header.height + reader->tile_height - 1) / reader->tile_height;
+    return tiles_x * tiles_y;
+}
+
+void image_reader_tile_rect(const image_reader_t *reader, uint32_t index, image_tile_t *tile) {
+    uint32_t tiles_x = (reader->header.width + reader->tile_width - 1) / reader->tile_width;
+
+    tile->index = index;
+    tile->x = (index % tiles_x) * reader->tile_width;
+    tile->y = (index / tiles_x) * reader->tile_height;
+    tile->width = reader->header.width - tile->x;
+    if (tile->width > reader->tile_width) tile->width = reader->tile_width;
+    tile->height = reader->header.height - tile->y;
+    if (tile->height > reader->tile_height) tile->height = reader->tile_height;
+}
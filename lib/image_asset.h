@@ -0,0 +1,123 @@
+#ifndef IMAGE_ASSET_H
+#define IMAGE_ASSET_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Binary image asset produced by convert_image.py
+// Layout: image_asset_header_t followed by data_size payload bytes.
+// Payload: pixels in raster order, bits_per_pixel bits each, packed MSB-first,
+// optionally PackBits run-length encoded on top of the packed bytes.
+// Version 2 (tiled) appends image_asset_tiling_t to the header and stores the
+// pixels tile by tile (tiles left to right, top to bottom; each tile in raster
+// order, edge tiles clipped to the image).
+#define IMAGE_ASSET_MAGIC 0x474D4950u  // "PIMG" (little-endian)
+#define IMAGE_ASSET_VERSION 1
+#define IMAGE_ASSET_VERSION_TILED 2
+
+#define IMAGE_COMPRESSION_NONE 0
+#define IMAGE_COMPRESSION_RLE 1
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t header_size;     // Bytes from start of asset to payload
+    uint8_t bits_per_pixel;  // 1-8
+    uint8_t compression;     // IMAGE_COMPRESSION_*
+    uint32_t width;
+    uint32_t height;
+    uint32_t data_size;      // Payload bytes following the header
+} image_asset_header_t;
+
+// Follows image_asset_header_t in version 2 assets
+typedef struct __attribute__((packed)) {
+    uint16_t tile_width;
+    uint16_t tile_height;
+} image_asset_tiling_t;
+
+// Tile position and size in pixels
+typedef struct {
+    uint32_t index;
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+} image_tile_t;
+
+// Streaming reader state (no heap, safe to keep on the stack)
+typedef struct {
+    image_asset_header_t header;
+    uint32_t tile_width;     // Stream order tiles (raster assets: one row per tile)
+    uint32_t tile_height;
+    const uint8_t *payload;
+    uint32_t pos;            // Byte offset into payload
+    uint32_t pixels_read;
+    // PackBits decoder state
+    uint8_t run_remaining;
+    uint8_t run_byte;
+    bool run_literal;
+    // Bit unpacker state
+    uint8_t cur_byte;
+    uint8_t bits_left;
+} image_reader_t;
+
+/**
+ * Get the image asset built into this firmware
+ * Either linked as a blob (default) or read from IMAGE_ASSET_FLASH_OFFSET
+ * @param size Output: asset size in bytes (UINT32_MAX when placed at a flash offset)
+ * @return Pointer to the asset in flash
+ */
+const uint8_t* image_asset_get(uint32_t *size);
+
+/**
+ * Open a reader on an image asset
+ * @param reader Reader state to initialize
+ * @param asset Pointer to the asset (header + payload)
+ * @param asset_size Size of the asset in bytes (for bounds checking)
+ * @return true on success, false if the header is invalid
+ */
+bool image_reader_open(image_reader_t *reader, const uint8_t *asset, uint32_t asset_size);
+
+/**
+ * Open a reader on an asset whose pixels are consumed in raster order
+ * Tiled assets stream tile by tile and would land in the wrong positions, so
+ * they are rejected; they need transmit_reconstruct_image_tiled()
+ * @param reader Reader state to initialize
+ * @param asset Pointer to the asset (header + payload)
+ * @param asset_size Size of the asset in bytes (for bounds checking)
+ * @return true on success, false if the header is invalid or the asset is tiled
+ */
+bool image_reader_open_raster(image_reader_t *reader, const uint8_t *asset, uint32_t asset_size);
+
+/**
+ * Read the next pixels from the asset, expanded to 8-bit grayscale
+ * @param reader Open reader
+ * @param dst Output buffer
+ * @param count Maximum number of pixels to read
+ * @return Number of pixels read (0 at end of image)
+ */
+uint32_t image_reader_read(image_reader_t *reader, uint8_t *dst, uint32_t count);
+
+/**
+ * Restart reading from the first pixel
+ * @param reader Open reader
+ */
+void image_reader_rewind(image_reader_t *reader);
+
+/**
+ * Number of tiles in the asset's stream order
+ * @param reader Open reader
+ * @return Tile count
+ */
+uint32_t image_reader_tile_count(const image_reader_t *reader);
+
+/**
+ * Position and size of a tile; its pixels are the next width * height pixels
+ * returned by image_reader_read() once the previous tiles have been read
+ * @param reader Open reader
+ * @param index Tile index (0 to image_reader_tile_count() - 1)
+ * @param tile Output: tile geometry
+ */
+void image_reader_tile_rect(const image_reader_t *reader, uint32_t index, image_tile_t *tile);
+
+#endif // IMAGE_ASSET_H
@@ -1,522 +0,0 @@
-// Auto-generated from image.jpg
-#ifndef IMAGE_DATA_H
-#define IMAGE_DATA_H
-
-#include <stdint.h>
-
-#define IMAGE_WIDTH 90
-#define IMAGE_HEIGHT 90
-#define IMAGE_SIZE 8100
-
-// Grayscale pixel data (8-bit per pixel)
-const uint8_t image_data[IMAGE_SIZE] = {
-    0xD3, 0xD3, 0xD3, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4,
-    0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9, 0xD9,
-    0xD7, 0xDB, 0xD8, 0xDA, 0xDA, 0xDA, 0xDF, 0xD7, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA,
-    0xD9, 0xD9, 0xD9, 0xD8, 0xD7, 0xD7, 0xD6, 0xD6, 0xD5, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4, 0xD3, 0xD2,
-    0xD2, 0xD1, 0xD0, 0xCF, 0xCF, 0xCE, 0xCD, 0xCC, 0xCD, 0xCC, 0xCB, 0xCB, 0xCB, 0xCA, 0xC9, 0xC8,
-    0xC9, 0xC8, 0xC7, 0xC6, 0xC6, 0xC6, 0xC5, 0xC4, 0xC4, 0xC3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD2, 0xD2,
-    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6,
-    0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xDB, 0xD8, 0xDA, 0xDB, 0xD8,
-    0xDB, 0xD8, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xDA, 0xDA, 0xDA,
-    0xDA, 0xD9, 0xD9, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD6, 0xD5, 0xD5, 0xD4, 0xD3, 0xD3, 0xD2, 0xD2,
-    0xD1, 0xD0, 0xD0, 0xD0, 0xCF, 0xCE, 0xCE, 0xCD, 0xCD, 0xCC, 0xCA, 0xC9, 0xC8, 0xC8, 0xC8, 0xC7,
-    0xC6, 0xC5, 0xC5, 0xC5, 0xD3, 0xD3, 0xD3, 0xD3, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4,
-    0xD4, 0xD4, 0xD4, 0xD4, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9,
-    0xDA, 0xDA, 0xDA, 0xDA, 0xDB, 0xDD, 0xD9, 0xDB, 0xDD, 0xD9, 0xDA, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB,
-    0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDA, 0xDA, 0xDA, 0xDA, 0xD9, 0xD9, 0xD9, 0xD9,
-    0xD9, 0xD8, 0xD7, 0xD6, 0xD5, 0xD5, 0xD4, 0xD3, 0xD3, 0xD2, 0xD1, 0xD1, 0xD1, 0xD0, 0xCF, 0xCF,
-    0xCF, 0xCE, 0xCE, 0xCD, 0xCC, 0xCB, 0xCA, 0xC9, 0xC9, 0xC8, 0xC7, 0xC6, 0xC6, 0xC5, 0xD3, 0xD3,
-    0xD3, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD6, 0xD6,
-    0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9, 0xD9, 0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDE,
-    0xDC, 0xDB, 0xDD, 0xDC, 0xDC, 0xDF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDB, 0xDB,
-    0xDB, 0xDB, 0xDA, 0xDA, 0xDA, 0xDA, 0xD9, 0xD8, 0xD8, 0xD8, 0xD8, 0xD7, 0xD6, 0xD5, 0xD5, 0xD4,
-    0xD3, 0xD2, 0xD2, 0xD2, 0xD1, 0xD0, 0xD0, 0xCF, 0xCE, 0xCE, 0xCE, 0xCE, 0xCD, 0xCC, 0xCC, 0xCB,
-    0xCA, 0xCA, 0xC9, 0xC9, 0xC8, 0xC7, 0xC6, 0xC6, 0xD3, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3,
-    0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD5, 0xD6, 0xD6, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9, 0xD9,
-    0xDA, 0xDA, 0xDB, 0xDB, 0xDB, 0xDC, 0xDC, 0xDC, 0xDC, 0xDE, 0xDF, 0xDB, 0xDC, 0xDF, 0xDD, 0xDD,
-    0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDD, 0xDD, 0xDC, 0xDC, 0xDB, 0xDB,
-    0xDB, 0xDA, 0xD9, 0xD9, 0xD9, 0xD9, 0xD8, 0xD7, 0xD6, 0xD5, 0xD4, 0xD4, 0xD3, 0xD3, 0xD2, 0xD1,
-    0xD1, 0xD0, 0xCF, 0xCF, 0xCF, 0xCE, 0xCD, 0xCC, 0xCD, 0xCC, 0xCB, 0xCA, 0xCA, 0xCA, 0xC9, 0xC8,
-    0xC7, 0xC7, 0xD3, 0xD3, 0xD2, 0xD2, 0xD2, 0xD3, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5,
-    0xD6, 0xD6, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9, 0xD9, 0xDA, 0xDA, 0xDC, 0xDC, 0xDC, 0xDC, 0xDD, 0xDD,
-    0xDD, 0xDE, 0xE1, 0xDD, 0xE1, 0xE0, 0xDE, 0xE2, 0xE0, 0xDE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xE0, 0xE0, 0xDF, 0xDF, 0xDE, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDA,
-    0xDA, 0xD9, 0xD8, 0xD7, 0xD6, 0xD5, 0xD5, 0xD4, 0xD3, 0xD2, 0xD2, 0xD1, 0xD0, 0xCF, 0xCF, 0xCE,
-    0xCD, 0xCC, 0xCD, 0xCD, 0xCC, 0xCB, 0xCB, 0xCB, 0xCA, 0xC9, 0xC9, 0xC8, 0xD3, 0xD3, 0xD3, 0xD3,
-    0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xD5, 0xD6, 0xD7, 0xD7, 0xD7, 0xD8, 0xD9, 0xD9, 0xDA,
-    0xDA, 0xDB, 0xDC, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDE, 0xDF, 0xDF, 0xDF, 0xE3, 0xD6, 0xDF, 0xE4,
-    0xE0, 0xE2, 0xE1, 0xE0, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xDF,
-    0xDF, 0xDF, 0xDE, 0xDE, 0xDE, 0xDD, 0xDC, 0xDC, 0xDC, 0xDC, 0xDB, 0xDA, 0xD9, 0xD8, 0xD7, 0xD6,
-    0xD6, 0xD5, 0xD3, 0xD2, 0xD2, 0xD1, 0xD0, 0xCF, 0xCF, 0xCE, 0xCD, 0xCC, 0xCD, 0xCC, 0xCB, 0xCB,
-    0xCB, 0xCB, 0xCB, 0xCA, 0xCA, 0xC9, 0xD4, 0xD4, 0xD3, 0xD3, 0xD4, 0xD4, 0xD4, 0xD5, 0xD4, 0xD5,
-    0xD5, 0xD6, 0xD7, 0xD8, 0xD8, 0xD8, 0xDA, 0xDA, 0xDA, 0xDB, 0xDC, 0xDC, 0xDD, 0xDD, 0xDE, 0xDE,
-    0xDF, 0xDF, 0xDF, 0xE0, 0xE0, 0xE0, 0xE1, 0xCC, 0xD8, 0xE4, 0xE0, 0xE0, 0xE1, 0xE1, 0xE1, 0xE1,
-    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE1, 0xE0,
-    0xDF, 0xDE, 0xDF, 0xDE, 0xDE, 0xDD, 0xDC, 0xDB, 0xD9, 0xD8, 0xD8, 0xD7, 0xD5, 0xD4, 0xD4, 0xD3,
-    0xD2, 0xD1, 0xD0, 0xCF, 0xCE, 0xCD, 0xCC, 0xCB, 0xCA, 0xCA, 0xCB, 0xCB, 0xCA, 0xC9, 0xC9, 0xC9,
-    0xD5, 0xD4, 0xD4, 0xD5, 0xD8, 0xD9, 0xD8, 0xD7, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xD8, 0xD9, 0xD9,
-    0xDA, 0xDB, 0xDD, 0xE0, 0xE2, 0xE2, 0xE0, 0xDE, 0xDF, 0xE1, 0xE0, 0xDF, 0xE5, 0xE0, 0xE0, 0xDF,
-    0xE5, 0x9F, 0xD6, 0xE8, 0xDF, 0xE0, 0xE6, 0xDF, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE3, 0xE3,
-    0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE,
-    0xDE, 0xDD, 0xDC, 0xDB, 0xDB, 0xD9, 0xD8, 0xD7, 0xD5, 0xD4, 0xD3, 0xD1, 0xD1, 0xD0, 0xCF, 0xCE,
-    0xCE, 0xCD, 0xCC, 0xCB, 0xCB, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xD4, 0xD3, 0xD4, 0xD5, 0xD7, 0xD9,
-    0xD9, 0xD8, 0xD7, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDC, 0xDD, 0xDD, 0xDF, 0xE1, 0xE3, 0xE2,
-    0xE1, 0xDF, 0xE2, 0xE1, 0xE2, 0xE0, 0xE1, 0xE3, 0xDF, 0xE7, 0xDC, 0x76, 0xC1, 0xE6, 0xDF, 0xE4,
-    0xE0, 0xE3, 0xE4, 0xE4, 0xE4, 0xE4, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
-    0xE3, 0xE2, 0xE1, 0xE1, 0xE0, 0xE0, 0xDF, 0xDF, 0xDF, 0xDE, 0xDE, 0xDD, 0xDC, 0xDB, 0xDB, 0xDA,
-    0xD8, 0xD7, 0xD6, 0xD5, 0xD4, 0xD3, 0xD2, 0xD2, 0xD1, 0xD0, 0xCE, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC,
-    0xCB, 0xCB, 0xC9, 0xC9, 0xD9, 0xD9, 0xD8, 0xD7, 0xD7, 0xD6, 0xD6, 0xD6, 0xD8, 0xD9, 0xDA, 0xDB,
-    0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE5, 0xE6, 0xE7, 0xE7, 0xE6, 0xE3, 0xE2, 0xE4, 0xE3,
-    0xE0, 0xE6, 0xE0, 0xEE, 0xC4, 0x5D, 0xA1, 0xE9, 0xE0, 0xE7, 0xE0, 0xE7, 0xE4, 0xE4, 0xE3, 0xE3,
-    0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE2, 0xE2, 0xE2, 0xE2, 0xE3, 0xE3, 0xE2, 0xE2,
-    0xE1, 0xE1, 0xE0, 0xE0, 0xDF, 0xDE, 0xDD, 0xDD, 0xDC, 0xDB, 0xDA, 0xD9, 0xD8, 0xD6, 0xD5, 0xD4,
-    0xD4, 0xD3, 0xD2, 0xD2, 0xCF, 0xCE, 0xCE, 0xCD, 0xCD, 0xCD, 0xCB, 0xCB, 0xC9, 0xC9, 0xE4, 0xE3,
-    0xE1, 0xDF, 0xDD, 0xDC, 0xDC, 0xDC, 0xDB, 0xDB, 0xDC, 0xDC, 0xDD, 0xDD, 0xDD, 0xDE, 0xDF, 0xE0,
-    0xE0, 0xE2, 0xE3, 0xE4, 0xE4, 0xE4, 0xE3, 0xE4, 0xE4, 0xE5, 0xE4, 0xE4, 0xE5, 0xE8, 0x9C, 0x65,
-    0x7E, 0xE0, 0xE4, 0xE3, 0xE4, 0xE3, 0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE4, 0xE4,
-    0xE4, 0xE3, 0xE3, 0xE3, 0xE2, 0xE2, 0xE0, 0xE0, 0xE0, 0xE0, 0xDF, 0xDE, 0xDE, 0xDD, 0xDF, 0xDE,
-    0xDD, 0xDD, 0xDC, 0xDB, 0xDA, 0xD9, 0xD9, 0xD7, 0xD6, 0xD5, 0xD4, 0xD3, 0xD2, 0xD2, 0xD1, 0xD1,
-    0xD0, 0xD0, 0xCF, 0xCE, 0xCC, 0xCB, 0xCA, 0xCA, 0xE4, 0xE4, 0xE3, 0xE3, 0xE2, 0xE2, 0xE4, 0xE4,
-    0xE2, 0xE2, 0xE2, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE4, 0xE4,
-    0xE6, 0xE9, 0xE5, 0xE4, 0xE9, 0xE1, 0xEE, 0xD6, 0x7B, 0x6F, 0x64, 0xBE, 0xEC, 0xE0, 0xE6, 0xE2,
-    0xE5, 0xE5, 0xE5, 0xE6, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE6, 0xE6, 0xE5, 0xE5, 0xE5,
-    0xE3, 0xE3, 0xE4, 0xE3, 0xE3, 0xE2, 0xE1, 0xE0, 0xDF, 0xDE, 0xDD, 0xDD, 0xDD, 0xDC, 0xDB, 0xD9,
-    0xDA, 0xD8, 0xD6, 0xD5, 0xD4, 0xD3, 0xD2, 0xD1, 0xD2, 0xD2, 0xD1, 0xD1, 0xD1, 0xD0, 0xCE, 0xCD,
-    0xCC, 0xCC, 0xDA, 0xDA, 0xDA, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xE1, 0xE2, 0xE2, 0xE3, 0xE4, 0xE5,
-    0xE5, 0xE6, 0xE6, 0xE7, 0xE7, 0xE8, 0xE8, 0xE9, 0xEA, 0xEB, 0xED, 0xF1, 0xEA, 0xE7, 0xEE, 0xE5,
-    0xF2, 0xBB, 0x74, 0x71, 0x60, 0x91, 0xED, 0xEA, 0xE7, 0xEA, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8,
-    0xE8, 0xE8, 0xE9, 0xE9, 0xE8, 0xE8, 0xE7, 0xE7, 0xE6, 0xE6, 0xE8, 0xE8, 0xE9, 0xE9, 0xE9, 0xE7,
-    0xE6, 0xE5, 0xE3, 0xE2, 0xE1, 0xE1, 0xE0, 0xDF, 0xDE, 0xDD, 0xDB, 0xD9, 0xD7, 0xD6, 0xD5, 0xD4,
-    0xD3, 0xD2, 0xD0, 0xD0, 0xCF, 0xCF, 0xCF, 0xCE, 0xCD, 0xCD, 0xCD, 0xCD, 0xD8, 0xD7, 0xD6, 0xD7,
-    0xD8, 0xD9, 0xD8, 0xD8, 0xDA, 0xDA, 0xDB, 0xDD, 0xDE, 0xDF, 0xE0, 0xE0, 0xE2, 0xE3, 0xE4, 0xE5,
-    0xE6, 0xE7, 0xE9, 0xEA, 0xEC, 0xF0, 0xEE, 0xEB, 0xEE, 0xEE, 0xE9, 0x96, 0x78, 0x72, 0x65, 0x70,
-    0xD6, 0xF4, 0xE9, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEA, 0xEA, 0xE9, 0xE9,
-    0xE8, 0xE7, 0xE7, 0xE6, 0xE6, 0xE7, 0xE7, 0xE8, 0xE7, 0xE6, 0xE4, 0xE3, 0xE5, 0xE4, 0xE3, 0xE2,
-    0xE2, 0xE1, 0xDF, 0xDE, 0xDC, 0xDA, 0xD9, 0xD8, 0xD7, 0xD6, 0xD5, 0xD4, 0xD2, 0xD1, 0xD0, 0xCF,
-    0xCE, 0xCE, 0xCD, 0xCC, 0xCC, 0xCC, 0xE0, 0xDF, 0xDE, 0xDF, 0xE1, 0xE2, 0xE1, 0xE0, 0xDF, 0xDF,
-    0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE4, 0xE5, 0xE5, 0xE6, 0xE6, 0xE5, 0xE5, 0xE5, 0xE6, 0xE5, 0xE9,
-    0xEE, 0xEC, 0xEA, 0xF2, 0xDA, 0x77, 0x77, 0x76, 0x67, 0x5F, 0xB5, 0xF5, 0xE7, 0xEB, 0xEA, 0xEA,
-    0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEC, 0xEC, 0xEC, 0xEB, 0xEA, 0xE9, 0xE9, 0xE8, 0xE8, 0xE9,
-    0xEA, 0xEA, 0xEA, 0xE8, 0xE7, 0xE5, 0xE3, 0xE2, 0xE1, 0xE0, 0xDF, 0xDE, 0xDD, 0xDB, 0xDC, 0xDB,
-    0xDA, 0xD9, 0xD9, 0xD9, 0xD8, 0xD7, 0xD8, 0xD7, 0xD4, 0xD2, 0xD1, 0xD0, 0xCE, 0xCD, 0xCA, 0xCA,
-    0xE2, 0xE3, 0xE3, 0xE4, 0xE4, 0xE5, 0xE7, 0xE9, 0xE9, 0xE7, 0xE7, 0xEA, 0xEA, 0xE9, 0xE9, 0xEB,
-    0xE8, 0xE9, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB, 0xEC, 0xEE, 0xE8, 0xF2, 0xEC, 0xEA, 0xFA, 0xAF, 0x77,
-    0x7E, 0x6F, 0x6E, 0x67, 0x83, 0xF5, 0xE7, 0xED, 0xED, 0xEC, 0xEB, 0xEA, 0xEB, 0xEB, 0xEB, 0xEB,
-    0xEB, 0xEC, 0xED, 0xEE, 0xEE, 0xED, 0xEB, 0xEA, 0xE9, 0xE9, 0xEB, 0xEB, 0xEB, 0xEA, 0xE9, 0xE8,
-    0xE5, 0xE4, 0xE3, 0xE2, 0xE1, 0xE1, 0xDF, 0xDE, 0xDF, 0xDE, 0xDC, 0xDC, 0xDD, 0xDD, 0xDC, 0xDB,
-    0xDA, 0xD7, 0xD4, 0xD1, 0xCF, 0xCD, 0xCC, 0xCB, 0xCB, 0xCA, 0xDE, 0xDE, 0xDD, 0xDB, 0xDA, 0xD9,
-    0xDA, 0xDB, 0xDF, 0xDF, 0xE0, 0xE1, 0xE2, 0xE2, 0xE2, 0xE3, 0xE5, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7,
-    0xE8, 0xE9, 0xE7, 0xF3, 0xEA, 0xED, 0xF3, 0xE4, 0x88, 0x7C, 0x82, 0x73, 0x65, 0x69, 0x66, 0xCF,
-    0xF8, 0xF1, 0xF1, 0xF0, 0xF0, 0xEF, 0xEF, 0xF0, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEE, 0xEC,
-    0xEB, 0xEA, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE7, 0xE5, 0xE4, 0xE5, 0xE4, 0xE4, 0xE3, 0xE3, 0xE3,
-    0xE2, 0xE2, 0xDF, 0xDD, 0xDC, 0xDC, 0xDC, 0xDB, 0xDA, 0xD8, 0xD9, 0xD8, 0xD6, 0xD5, 0xD3, 0xD2,
-    0xD0, 0xCE, 0xD0, 0xCF, 0xE6, 0xE5, 0xE2, 0xE0, 0xDD, 0xDC, 0xDD, 0xDE, 0xE0, 0xE2, 0xE3, 0xE4,
-    0xE5, 0xE7, 0xE7, 0xE6, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE5, 0xE6, 0xE7, 0xE2, 0xE9, 0xE3, 0xEC,
-    0xF5, 0xC0, 0x78, 0x7D, 0x80, 0x74, 0x63, 0x73, 0x5C, 0x9D, 0xF9, 0xE5, 0xEC, 0xEC, 0xED, 0xED,
-    0xEC, 0xEC, 0xEC, 0xEC, 0xEE, 0xED, 0xEC, 0xEB, 0xEA, 0xE9, 0xE8, 0xE8, 0xE6, 0xE6, 0xE5, 0xE4,
-    0xE3, 0xE2, 0xE0, 0xE0, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xDF, 0xDF, 0xDE, 0xDE, 0xDD, 0xDC, 0xDB,
-    0xDB, 0xDA, 0xD8, 0xD6, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD2, 0xCF, 0xCD, 0xC9, 0xC9, 0xE2, 0xE1,
-    0xE0, 0xDD, 0xDC, 0xDC, 0xDD, 0xDE, 0xDD, 0xE1, 0xE3, 0xE3, 0xE5, 0xE8, 0xE8, 0xE7, 0xE7, 0xE7,
-    0xE7, 0xE7, 0xE7, 0xE8, 0xEA, 0xEB, 0xEE, 0xEB, 0xEF, 0xEE, 0xF3, 0x9B, 0x7F, 0x7A, 0x87, 0x76,
-    0x65, 0x6E, 0x63, 0x72, 0xDD, 0xE4, 0xE5, 0xE6, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE6, 0xE5,
-    0xE4, 0xE2, 0xE2, 0xE2, 0xE3, 0xE3, 0xE1, 0xE1, 0xE0, 0xE0, 0xDF, 0xDE, 0xDE, 0xDE, 0xDD, 0xDC,
-    0xDB, 0xDA, 0xDA, 0xD9, 0xD8, 0xD7, 0xDA, 0xD9, 0xD7, 0xD7, 0xD7, 0xD5, 0xD3, 0xD0, 0xCB, 0xCB,
-    0xCB, 0xCB, 0xCA, 0xC8, 0xC6, 0xC4, 0xC2, 0xC1, 0xD5, 0xD4, 0xD3, 0xD1, 0xD0, 0xD0, 0xD2, 0xD3,
-    0xD4, 0xD8, 0xDA, 0xDB, 0xDD, 0xE1, 0xE2, 0xE0, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE3, 0xE4,
-    0xE7, 0xEC, 0xED, 0xED, 0xDB, 0x82, 0x7F, 0x7F, 0x83, 0x78, 0x67, 0x68, 0x70, 0x61, 0xAA, 0xE9,
-    0xDC, 0xDD, 0xDD, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0xDD, 0xDC, 0xDB, 0xDA, 0xDA, 0xDB, 0xDC, 0xDD,
-    0xDD, 0xDC, 0xDC, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB, 0xDA, 0xD9, 0xD8, 0xD7, 0xD7, 0xD6, 0xD5, 0xD4,
-    0xD2, 0xD1, 0xD0, 0xCF, 0xCF, 0xCE, 0xCB, 0xC9, 0xC4, 0xC3, 0xC2, 0xC0, 0xBF, 0xBD, 0xBB, 0xB9,
-    0xBB, 0xBA, 0xD0, 0xCF, 0xCE, 0xCD, 0xCB, 0xCB, 0xCB, 0xCC, 0xCE, 0xD0, 0xD2, 0xD3, 0xD6, 0xD8,
-    0xDA, 0xD9, 0xD8, 0xD8, 0xD9, 0xD9, 0xD8, 0xD9, 0xDA, 0xDB, 0xD9, 0xDC, 0xDF, 0xEB, 0xA7, 0x78,
-    0x7F, 0x82, 0x7A, 0x7A, 0x68, 0x69, 0x71, 0x64, 0x7C, 0xDD, 0xD7, 0xD7, 0xD6, 0xD6, 0xD7, 0xD7,
-    0xD7, 0xD7, 0xD9, 0xD8, 0xD7, 0xD6, 0xD6, 0xD6, 0xD6, 0xD7, 0xD7, 0xD7, 0xD6, 0xD6, 0xD5, 0xD5,
-    0xD4, 0xD4, 0xD4, 0xD3, 0xD3, 0xD2, 0xD2, 0xD2, 0xD1, 0xD1, 0xCE, 0xCC, 0xCB, 0xCB, 0xCB, 0xCA,
-    0xC8, 0xC6, 0xC5, 0xC3, 0xC0, 0xBE, 0xBC, 0xBA, 0xB8, 0xB7, 0xB5, 0xB5, 0xCD, 0xCD, 0xCD, 0xCC,
-    0xCB, 0xCB, 0xCB, 0xCC, 0xCD, 0xCC, 0xCD, 0xCF, 0xD1, 0xD1, 0xD3, 0xD4, 0xD8, 0xD9, 0xD9, 0xDA,
-    0xDA, 0xDA, 0xDB, 0xDC, 0xE0, 0xD8, 0xE4, 0xD2, 0x84, 0x7C, 0x84, 0x81, 0x82, 0x83, 0x6A, 0x66,
-    0x66, 0x6A, 0x68, 0xB8, 0xDE, 0xDB, 0xD9, 0xD8, 0xD9, 0xDA, 0xD9, 0xD7, 0xD7, 0xD7, 0xD7, 0xD6,
-    0xD6, 0xD5, 0xD5, 0xD4, 0xD3, 0xD3, 0xD3, 0xD3, 0xD2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD1, 0xD0, 0xD0,
-    0xD0, 0xCF, 0xCF, 0xCE, 0xCE, 0xCC, 0xCB, 0xCA, 0xCA, 0xC9, 0xC7, 0xC5, 0xC5, 0xC3, 0xC1, 0xBF,
-    0xBD, 0xBB, 0xB9, 0xB8, 0xB6, 0xB6, 0xCB, 0xCC, 0xCD, 0xCE, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD0,
-    0xD0, 0xD2, 0xD3, 0xD2, 0xD3, 0xD6, 0xD4, 0xD5, 0xD6, 0xD7, 0xD7, 0xD7, 0xD8, 0xD8, 0xDC, 0xD9,
-    0xE7, 0xA3, 0x80, 0x87, 0x88, 0x87, 0x86, 0x86, 0x74, 0x6D, 0x69, 0x71, 0x61, 0x86, 0xE0, 0xDD,
-    0xD9, 0xD8, 0xD9, 0xD9, 0xD7, 0xD5, 0xD6, 0xD7, 0xD7, 0xD7, 0xD7, 0xD6, 0xD5, 0xD5, 0xD4, 0xD4,
-    0xD4, 0xD4, 0xD4, 0xD4, 0xD3, 0xD3, 0xD5, 0xD4, 0xD3, 0xD2, 0xD2, 0xD1, 0xD0, 0xCF, 0xCE, 0xCC,
-    0xCA, 0xC9, 0xC8, 0xC7, 0xC6, 0xC4, 0xC1, 0xC0, 0xBF, 0xBD, 0xBC, 0xBA, 0xB7, 0xB6, 0xB5, 0xB4,
-    0xD2, 0xD3, 0xD0, 0xD4, 0xD3, 0xD2, 0xD2, 0xD3, 0xD2, 0xD5, 0xCE, 0xD2, 0xD1, 0xD0, 0xD8, 0xD0,
-    0xD3, 0xD9, 0xD5, 0xD8, 0xD7, 0xD5, 0xDB, 0xD8, 0xD6, 0xE2, 0xC2, 0x7C, 0x7C, 0x84, 0x85, 0x8A,
-    0x8C, 0x82, 0x6F, 0x6D, 0x6D, 0x69, 0x5F, 0x5B, 0xA9, 0xE7, 0xDA, 0xDC, 0xDC, 0xD7, 0xD7, 0xD9,
-    0xD8, 0xD8, 0xD8, 0xD8, 0xD7, 0xD7, 0xD6, 0xD6, 0xD7, 0xD2, 0xD7, 0xD4, 0xD6, 0xD5, 0xD3, 0xD4,
-    0xD2, 0xD2, 0xD2, 0xD2, 0xD0, 0xCF, 0xCE, 0xCF, 0xCE, 0xCE, 0xCC, 0xC9, 0xC9, 0xCB, 0xC8, 0xC3,
-    0xC2, 0xC3, 0xC2, 0xBD, 0xBA, 0xB9, 0xB9, 0xB8, 0xB5, 0xB5, 0xCA, 0xD0, 0xCF, 0xD0, 0xCF, 0xD0,
-    0xD3, 0xD4, 0xD3, 0xCE, 0xDA, 0xD3, 0xD1, 0xD9, 0xD3, 0xD7, 0xD4, 0xD3, 0xD5, 0xD5, 0xD8, 0xDB,
-    0xDA, 0xDB, 0xE1, 0xE4, 0xC4, 0x92, 0xA0, 0x9F, 0xA1, 0xA5, 0xA6, 0xA1, 0x95, 0x99, 0x98, 0x91,
-    0x91, 0x7B, 0xB4, 0xDC, 0xD5, 0xD7, 0xD5, 0xD7, 0xD5, 0xD7, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
-    0xD4, 0xD3, 0xD1, 0xD1, 0xD5, 0xD3, 0xD2, 0xD2, 0xD4, 0xD4, 0xD4, 0xD3, 0xD1, 0xD2, 0xD5, 0xD6,
-    0xD4, 0xD1, 0xCD, 0xD0, 0xD2, 0xD1, 0xCC, 0xC9, 0xCB, 0xCE, 0xC9, 0xC8, 0xC6, 0xC3, 0xC2, 0xC1,
-    0xBE, 0xB9, 0xBB, 0xBA, 0xBF, 0xBB, 0xBB, 0xC1, 0xC7, 0xC6, 0xC4, 0xC6, 0xCB, 0xC6, 0xC9, 0xC9,
-    0xCA, 0xCE, 0xCB, 0xCA, 0xD1, 0xCD, 0xD3, 0xCE, 0xCD, 0xD2, 0xD0, 0xD8, 0xD4, 0xDD, 0xD5, 0xAD,
-    0xBD, 0xBA, 0xB8, 0xC1, 0xBC, 0xA4, 0x97, 0xA1, 0x9B, 0x9E, 0xA6, 0xA3, 0xCF, 0xDF, 0xD9, 0xD8,
-    0xD2, 0xD6, 0xD0, 0xD0, 0xD0, 0xCF, 0xCE, 0xCD, 0xCD, 0xCE, 0xCD, 0xCC, 0xCE, 0xCD, 0xCC, 0xCD,
-    0xCC, 0xCD, 0xCF, 0xC9, 0xCC, 0xCF, 0xD0, 0xCD, 0xCA, 0xCB, 0xCB, 0xCB, 0xD2, 0xCB, 0xC7, 0xC9,
-    0xCA, 0xC7, 0xC4, 0xC3, 0xC7, 0xC6, 0xC3, 0xC1, 0xC1, 0xC3, 0xC2, 0xC1, 0xC0, 0xC0, 0xCB, 0xCC,
-    0xD1, 0xD2, 0xCE, 0xD1, 0xD2, 0xD5, 0xD7, 0xD2, 0xD4, 0xD6, 0xD1, 0xCD, 0xCE, 0xD1, 0xCA, 0xC9,
-    0xCF, 0xD0, 0xD1, 0xD2, 0xCE, 0xD2, 0xD8, 0xD8, 0xD5, 0xA5, 0xB6, 0xC1, 0xBF, 0xBF, 0xBF, 0xA2,
-    0xA3, 0xAF, 0xAD, 0xB4, 0x99, 0x9B, 0xCE, 0xDA, 0xD4, 0xD4, 0xD1, 0xD4, 0xD0, 0xD0, 0xD3, 0xD1,
-    0xCF, 0xCE, 0xCF, 0xD0, 0xCF, 0xCF, 0xCE, 0xCE, 0xCC, 0xCE, 0xCE, 0xCB, 0xCF, 0xC9, 0xCB, 0xCA,
-    0xC8, 0xC6, 0xC8, 0xCC, 0xCB, 0xC7, 0xC7, 0xC6, 0xC7, 0xC7, 0xC4, 0xC1, 0xC0, 0xC3, 0xB9, 0xBB,
-    0xBD, 0xBD, 0xBC, 0xBA, 0xB9, 0xB9, 0xB8, 0xB8, 0x79, 0x78, 0x7A, 0x78, 0x77, 0x98, 0xA9, 0xAE,
-    0x9D, 0x73, 0x71, 0x80, 0xAB, 0xD3, 0xCB, 0xCE, 0xDC, 0xD9, 0xD4, 0xD9, 0xDA, 0xD6, 0xD9, 0xD7,
-    0xD6, 0xDC, 0xDB, 0xB3, 0xA2, 0x93, 0x96, 0x84, 0xB9, 0xB3, 0xAF, 0x85, 0x7F, 0x84, 0x85, 0xA2,
-    0xCA, 0xDF, 0xD5, 0xD6, 0xD7, 0xD3, 0xD3, 0xD2, 0xD0, 0xCF, 0xCD, 0xCD, 0xCD, 0xCE, 0xCE, 0xCD,
-    0xCC, 0xCD, 0xCF, 0xCB, 0xCF, 0xC9, 0xCE, 0xCF, 0xCC, 0xCD, 0xCD, 0xC9, 0xC8, 0xC9, 0xCA, 0xCA,
-    0xC5, 0xC6, 0xC6, 0xC3, 0xC3, 0xC6, 0xC9, 0xCA, 0xCB, 0xC6, 0xBD, 0xB5, 0xAF, 0xAB, 0xA9, 0xA9,
-    0xAC, 0xAB, 0x47, 0x3F, 0x4D, 0x61, 0x51, 0x66, 0x69, 0x6E, 0x6F, 0x61, 0x5D, 0x52, 0x4F, 0x5C,
-    0x66, 0x74, 0x7A, 0x88, 0x95, 0xAE, 0xBB, 0xBE, 0xCF, 0xD5, 0xD3, 0xD6, 0xCB, 0xC0, 0x89, 0x54,
-    0x74, 0x61, 0xA1, 0xB3, 0xB2, 0x6B, 0x65, 0x4D, 0x7B, 0xAF, 0xD2, 0xE6, 0xDB, 0xDB, 0xDB, 0xD1,
-    0xD4, 0xD3, 0xD5, 0xD4, 0xD3, 0xD1, 0xD0, 0xD0, 0xCF, 0xCF, 0xD2, 0xCE, 0xCE, 0xBC, 0xD1, 0xCE,
-    0xCD, 0xCB, 0xCB, 0xCC, 0xCD, 0xCD, 0xCC, 0xCB, 0xCC, 0xCC, 0xD0, 0xD1, 0xD1, 0xCF, 0xCB, 0xC0,
-    0xAC, 0x9A, 0x80, 0x75, 0x68, 0x61, 0x5E, 0x5C, 0x5A, 0x58, 0x5D, 0x5A, 0x49, 0x43, 0x60, 0x85,
-    0x60, 0x6B, 0x68, 0x71, 0x6B, 0x71, 0x64, 0x61, 0x62, 0x68, 0x6F, 0x5F, 0x58, 0x58, 0x58, 0x5C,
-    0x5C, 0x60, 0x73, 0x85, 0x7F, 0x6F, 0x7B, 0xAF, 0x87, 0x58, 0x7F, 0x6A, 0x96, 0xA4, 0xA4, 0x68,
-    0x6D, 0x4B, 0x76, 0xA6, 0xC0, 0xC3, 0xC3, 0xC7, 0xC8, 0xC7, 0xCD, 0xD1, 0xCD, 0xCE, 0xD0, 0xD0,
-    0xCF, 0xCF, 0xD1, 0xD2, 0xD1, 0xCF, 0xD0, 0xAB, 0xCE, 0xD3, 0xCF, 0xCC, 0xD0, 0xC8, 0xC5, 0xC9,
-    0xCF, 0xCC, 0xC3, 0xBC, 0xAF, 0xA8, 0x9B, 0x89, 0x78, 0x6B, 0x62, 0x5E, 0x5E, 0x5C, 0x5E, 0x61,
-    0x63, 0x61, 0x5C, 0x5A, 0x58, 0x53, 0x49, 0x4E, 0x79, 0xAF, 0x92, 0xA2, 0x79, 0x55, 0x6C, 0x7A,
-    0x7D, 0x65, 0x5B, 0x70, 0x81, 0x83, 0x63, 0x58, 0x5A, 0x5B, 0x5C, 0x5A, 0x52, 0x57, 0x76, 0x4F,
-    0x6F, 0xB3, 0x8A, 0x66, 0x86, 0x7B, 0x9A, 0xAA, 0xAB, 0x69, 0x60, 0x52, 0x73, 0xA7, 0x7F, 0x70,
-    0x7B, 0x83, 0x84, 0x8C, 0x95, 0x9C, 0xA5, 0xA9, 0xAD, 0xB1, 0xB4, 0xB8, 0xBC, 0xBF, 0xBB, 0xC6,
-    0xD0, 0x9B, 0xBE, 0xC8, 0xCC, 0xD1, 0xCF, 0xD2, 0xD3, 0xCB, 0xB7, 0xA3, 0x9B, 0x9E, 0x85, 0x79,
-    0x6E, 0x6B, 0x6D, 0x6C, 0x6A, 0x69, 0x6E, 0x6E, 0x6D, 0x6A, 0x64, 0x5E, 0x5F, 0x63, 0x5B, 0x55,
-    0x67, 0x7D, 0xB0, 0xD6, 0xC7, 0xCB, 0x94, 0x44, 0x79, 0x8C, 0x8A, 0x75, 0x7E, 0x83, 0x74, 0x76,
-    0x60, 0x4E, 0x45, 0x4C, 0x53, 0x62, 0x5D, 0x65, 0x81, 0x58, 0x64, 0xB6, 0x88, 0x77, 0x82, 0x84,
-    0x97, 0xA9, 0xAC, 0x71, 0x69, 0x55, 0x76, 0xA6, 0x6E, 0x5F, 0x5F, 0x69, 0x60, 0x5C, 0x5B, 0x61,
-    0x6A, 0x6D, 0x84, 0x88, 0x9C, 0xA8, 0xC2, 0xCD, 0xD7, 0xE3, 0xBE, 0x70, 0xBD, 0xE2, 0xD9, 0xD8,
-    0xD1, 0xBE, 0xB6, 0xA8, 0xA5, 0x96, 0x97, 0xAD, 0x9F, 0x89, 0x88, 0x89, 0x89, 0xA0, 0xB5, 0xA9,
-    0xAC, 0x9C, 0x8F, 0x7A, 0x79, 0x6B, 0x81, 0xA1, 0x96, 0x82, 0x8A, 0x92, 0x99, 0x9F, 0x9E, 0xA7,
-    0x94, 0x83, 0x89, 0x80, 0x7E, 0x7E, 0x78, 0x7C, 0x81, 0x77, 0x50, 0x5B, 0x70, 0x67, 0x60, 0x5F,
-    0x6B, 0x59, 0x5B, 0x4E, 0x68, 0xB9, 0x7A, 0x4E, 0x6E, 0x59, 0xA6, 0xAC, 0xAF, 0x58, 0x55, 0x42,
-    0x67, 0xAB, 0x7C, 0x73, 0x74, 0x69, 0x67, 0x67, 0x5C, 0x5A, 0x58, 0x60, 0x62, 0x59, 0x57, 0x59,
-    0x6A, 0x77, 0x77, 0xB8, 0xA9, 0x4D, 0xAD, 0xBC, 0xB7, 0xAE, 0x94, 0xA0, 0xA8, 0x8A, 0x81, 0x7D,
-    0x7B, 0x74, 0x75, 0x7B, 0x83, 0x7B, 0x7D, 0x94, 0xCA, 0xD9, 0xCA, 0xC3, 0xB9, 0xA3, 0x9D, 0xA9,
-    0xB3, 0xBA, 0xBA, 0xAE, 0x73, 0x7D, 0x7C, 0x7A, 0x85, 0x8C, 0x88, 0x92, 0x93, 0x6D, 0x5D, 0x70,
-    0x6C, 0x6E, 0x7A, 0x6C, 0x3D, 0x7A, 0xC4, 0x9F, 0x9A, 0x8C, 0x99, 0xAD, 0x6A, 0x3B, 0x55, 0xBC,
-    0x8E, 0x6E, 0x6C, 0x72, 0xA9, 0xAD, 0xB1, 0x7B, 0x66, 0x5E, 0x71, 0xA7, 0x93, 0x62, 0x56, 0x48,
-    0x44, 0x51, 0x4E, 0x3F, 0x3D, 0x4C, 0x52, 0x62, 0x58, 0x49, 0x4D, 0x4B, 0x36, 0x71, 0xAA, 0x73,
-    0xA4, 0xAD, 0xB0, 0x9D, 0x9D, 0x74, 0x60, 0x5D, 0x71, 0x78, 0x7B, 0x77, 0x82, 0x7F, 0x7E, 0x80,
-    0x81, 0x81, 0x7A, 0x8E, 0x98, 0x83, 0x7E, 0x8D, 0x94, 0x9B, 0x86, 0x8C, 0x7D, 0x77, 0x6A, 0x70,
-    0x7A, 0x74, 0x7C, 0x84, 0x84, 0x7E, 0x8C, 0x6A, 0x57, 0x6F, 0x76, 0x70, 0x6F, 0x72, 0x42, 0x74,
-    0xCD, 0xC5, 0xC0, 0xBE, 0xC5, 0xA0, 0x5C, 0x4F, 0x81, 0xAD, 0x99, 0x93, 0x91, 0x9D, 0xA8, 0xA6,
-    0xA7, 0x9D, 0x79, 0x79, 0x90, 0xA5, 0x56, 0x2D, 0x30, 0x4B, 0x40, 0x36, 0x34, 0x37, 0x41, 0x3A,
-    0x35, 0x2E, 0x35, 0x3B, 0x2C, 0x3B, 0x41, 0x6C, 0xB2, 0xB9, 0xAA, 0xB2, 0xB9, 0xA0, 0x8F, 0x6D,
-    0x51, 0x48, 0x50, 0x6A, 0x7C, 0x7A, 0x77, 0x82, 0x80, 0x84, 0x86, 0x66, 0x26, 0x27, 0x2B, 0x21,
-    0x24, 0x32, 0x3A, 0x3F, 0x2E, 0x49, 0x48, 0x45, 0x78, 0x78, 0x82, 0x78, 0x7E, 0x87, 0x8A, 0x7F,
-    0x92, 0x7C, 0x6D, 0x73, 0x70, 0x6A, 0x67, 0x80, 0x8A, 0x99, 0xCB, 0xC7, 0xE1, 0xBC, 0x48, 0x2A,
-    0x3B, 0x3C, 0x58, 0xB9, 0xAA, 0xA8, 0xA7, 0xB3, 0xAA, 0x9E, 0xA6, 0xA0, 0x87, 0x82, 0x9C, 0xA3,
-    0x90, 0x7F, 0x3E, 0x32, 0x2B, 0x31, 0x32, 0x41, 0x35, 0x3C, 0x29, 0x28, 0x51, 0x59, 0x4C, 0x4E,
-    0x2B, 0x5C, 0xB8, 0xA4, 0xA6, 0xA1, 0x9D, 0x88, 0x8F, 0x66, 0x53, 0x6E, 0x6B, 0x6D, 0x73, 0x81,
-    0x79, 0x84, 0x7F, 0x88, 0x99, 0x71, 0x34, 0x2D, 0x24, 0x1D, 0x2E, 0x31, 0x2C, 0x28, 0x1C, 0x2C,
-    0x23, 0x22, 0x73, 0x7B, 0x84, 0x7F, 0x8B, 0x8C, 0x89, 0x8B, 0x98, 0x83, 0x7B, 0x80, 0x77, 0x7F,
-    0x82, 0x97, 0xC1, 0xC3, 0xBF, 0xA1, 0x81, 0x52, 0x22, 0x38, 0x30, 0x27, 0x51, 0xB6, 0xAD, 0xA2,
-    0xB4, 0xB0, 0xAC, 0xA2, 0xA7, 0xA6, 0x9A, 0x9C, 0x92, 0x9C, 0xC3, 0xA1, 0x31, 0x1F, 0x24, 0x36,
-    0x2E, 0x2B, 0x62, 0x39, 0x1D, 0x21, 0x31, 0x32, 0x2D, 0x21, 0x26, 0x61, 0xB3, 0xB1, 0x99, 0xA4,
-    0xB4, 0x9D, 0x84, 0x64, 0x57, 0x84, 0x95, 0xA3, 0x9D, 0x97, 0xA1, 0x9B, 0x93, 0x85, 0x80, 0x96,
-    0x47, 0x26, 0x2E, 0x1F, 0x33, 0x34, 0x30, 0x36, 0x34, 0x2B, 0x1A, 0x1B, 0x78, 0x83, 0x86, 0x82,
-    0x8E, 0x8D, 0x88, 0x92, 0x9B, 0x8A, 0x7F, 0x88, 0x7E, 0x81, 0x76, 0x73, 0x5B, 0x56, 0x5D, 0x39,
-    0x23, 0x27, 0x20, 0x14, 0x2B, 0x17, 0x49, 0xBA, 0xA9, 0xBB, 0xB4, 0xC5, 0xAE, 0xA5, 0x9D, 0xA7,
-    0x9C, 0xA8, 0x92, 0x9A, 0xB9, 0x7F, 0x27, 0x39, 0x39, 0x2E, 0x23, 0x32, 0x9C, 0x32, 0x25, 0x1C,
-    0x25, 0x53, 0x46, 0x55, 0x95, 0xA2, 0x68, 0x9D, 0x6A, 0x94, 0xA2, 0x7E, 0x81, 0x76, 0x72, 0x84,
-    0x82, 0x7F, 0x81, 0x7E, 0x89, 0x95, 0x96, 0x53, 0x29, 0x93, 0x7C, 0x34, 0x30, 0x2E, 0x2C, 0x16,
-    0x13, 0x21, 0x26, 0x1E, 0x1C, 0x1D, 0x7A, 0x81, 0x84, 0x80, 0x88, 0x90, 0x8E, 0x91, 0x96, 0x90,
-    0x77, 0x81, 0x7F, 0x80, 0x78, 0x74, 0x66, 0x60, 0x47, 0x27, 0x2A, 0x1D, 0x2B, 0x1D, 0x21, 0x15,
-    0x4E, 0xBA, 0xB1, 0xBA, 0xA4, 0xC1, 0xAA, 0xA3, 0x9F, 0xA7, 0x9C, 0x98, 0xA0, 0x98, 0xB2, 0x88,
-    0x2F, 0x23, 0x29, 0x2E, 0x30, 0x50, 0xAE, 0x63, 0x2B, 0x2D, 0x56, 0x97, 0x9E, 0xAB, 0x85, 0xA0,
-    0x97, 0xA2, 0x98, 0x92, 0x6C, 0x7A, 0x78, 0x65, 0x5D, 0x63, 0x65, 0x5D, 0x6D, 0x72, 0x65, 0x8A,
-    0xA9, 0x6D, 0x37, 0x6D, 0x94, 0x19, 0x18, 0x1C, 0x16, 0x24, 0x3B, 0x28, 0x0B, 0x12, 0x14, 0x16,
-    0x7D, 0x88, 0x8F, 0x7B, 0x80, 0x92, 0x8A, 0x88, 0x87, 0x89, 0x76, 0x80, 0x80, 0x86, 0x83, 0x73,
-    0x61, 0x4A, 0x27, 0x2C, 0x34, 0x22, 0x1D, 0x20, 0x30, 0x2C, 0x43, 0xBB, 0xB0, 0xB5, 0xC8, 0xB6,
-    0xB1, 0xA4, 0x9E, 0xA0, 0xA2, 0xA8, 0x98, 0x9D, 0xAB, 0x97, 0x42, 0x10, 0x19, 0x3F, 0x6A, 0x8E,
-    0xA9, 0x95, 0x52, 0x6C, 0xAE, 0x92, 0xBB, 0x91, 0x44, 0x74, 0x84, 0x76, 0x71, 0x91, 0xC6, 0xBE,
-    0x97, 0x99, 0x97, 0x7C, 0x8A, 0x7B, 0x85, 0x8A, 0x71, 0x91, 0xA7, 0xCD, 0xAC, 0x6B, 0x79, 0x57,
-    0x49, 0x59, 0x49, 0x42, 0x47, 0x43, 0x3C, 0x4E, 0x45, 0x13, 0x70, 0x71, 0x77, 0x4C, 0x3A, 0x58,
-    0x43, 0x52, 0x54, 0x70, 0x63, 0x70, 0x7C, 0x69, 0x5B, 0x6E, 0x49, 0x36, 0x36, 0x34, 0x41, 0x3A,
-    0x2F, 0x45, 0x49, 0x41, 0x67, 0xB0, 0xB1, 0xAE, 0xAD, 0xB0, 0xAE, 0x9E, 0xA3, 0xA7, 0x95, 0x99,
-    0x9D, 0x9C, 0xAA, 0x8B, 0x7B, 0x71, 0x14, 0x5E, 0x76, 0x9D, 0xA8, 0x71, 0x59, 0x58, 0x61, 0x7C,
-    0x75, 0x59, 0x50, 0x77, 0x72, 0x81, 0x58, 0x7A, 0x8E, 0x7F, 0x77, 0x92, 0x82, 0x83, 0x96, 0x7E,
-    0x9B, 0xB8, 0xAC, 0xAE, 0xA3, 0x9B, 0x87, 0x6E, 0x74, 0x8B, 0x93, 0xA4, 0x73, 0x4F, 0x41, 0x43,
-    0x61, 0x69, 0x68, 0x39, 0x36, 0x36, 0x32, 0x2D, 0x2C, 0x25, 0x29, 0x30, 0x29, 0x40, 0x3C, 0x48,
-    0x61, 0x4C, 0x65, 0x55, 0x29, 0x2D, 0x22, 0x2F, 0x25, 0x27, 0x26, 0x3F, 0x49, 0x26, 0x5F, 0xB5,
-    0xBD, 0xB4, 0xAC, 0xB9, 0xAE, 0xA2, 0x9C, 0xA1, 0x97, 0x96, 0x9A, 0x99, 0x98, 0x72, 0x74, 0x7B,
-    0x23, 0x5F, 0x7C, 0x79, 0x7F, 0x5C, 0x5B, 0x8D, 0x7F, 0x60, 0x66, 0x5D, 0x57, 0x64, 0x58, 0x75,
-    0x59, 0x61, 0x71, 0x59, 0x51, 0x7E, 0x50, 0x67, 0x73, 0x6E, 0x6D, 0x78, 0x64, 0x6B, 0x5A, 0x59,
-    0x56, 0x5D, 0x65, 0x69, 0x6E, 0x5D, 0x41, 0x3E, 0x34, 0x32, 0x4C, 0x36, 0x37, 0x14, 0x1C, 0x20,
-    0x22, 0x22, 0x25, 0x22, 0x1B, 0x13, 0x24, 0x29, 0x2C, 0x3D, 0x40, 0x37, 0x31, 0x41, 0x33, 0x2E,
-    0x38, 0x26, 0x22, 0x20, 0x3F, 0x52, 0x53, 0x39, 0x5D, 0xB7, 0xB3, 0xB9, 0xB6, 0xB7, 0xB1, 0xA4,
-    0x93, 0x9A, 0x99, 0x94, 0x9A, 0x94, 0x68, 0x62, 0x5C, 0x61, 0x72, 0x70, 0x7C, 0x76, 0x70, 0x5B,
-    0x65, 0x88, 0x72, 0x7B, 0x5D, 0x55, 0x72, 0x40, 0x51, 0x60, 0x91, 0x72, 0x5F, 0x64, 0x46, 0x78,
-    0x6C, 0x68, 0x73, 0x5F, 0x4F, 0x31, 0x64, 0x64, 0x61, 0x5F, 0x5E, 0x6D, 0x6F, 0x66, 0x59, 0x43,
-    0x44, 0x43, 0x39, 0x21, 0x26, 0x3E, 0x42, 0x18, 0x27, 0x23, 0x18, 0x14, 0x0A, 0x19, 0x16, 0x1C,
-    0x18, 0x20, 0x27, 0x2C, 0x2A, 0x10, 0x1D, 0x33, 0x30, 0x27, 0x22, 0x1E, 0x22, 0x1E, 0x46, 0x35,
-    0x35, 0x3D, 0x5D, 0xBA, 0xB3, 0xB2, 0xA7, 0xB2, 0xB1, 0x9D, 0x97, 0xA0, 0x90, 0x8A, 0xA0, 0x93,
-    0x6B, 0x54, 0x6E, 0x69, 0x6C, 0x5F, 0x64, 0x72, 0x5B, 0x47, 0x68, 0x71, 0x6C, 0x68, 0x6E, 0x5A,
-    0x5D, 0x6A, 0x46, 0x62, 0x75, 0x73, 0x51, 0x77, 0x49, 0x67, 0x64, 0x60, 0x6A, 0x66, 0x63, 0x32,
-    0x2F, 0x35, 0x26, 0x3A, 0x48, 0x33, 0x37, 0x26, 0x19, 0x00, 0x22, 0x39, 0x3F, 0x35, 0x2D, 0x3C,
-    0x2B, 0x0C, 0x2B, 0x22, 0x24, 0x23, 0x1D, 0x0F, 0x0E, 0x0F, 0x16, 0x12, 0x15, 0x24, 0x24, 0x3F,
-    0x27, 0x42, 0x3F, 0x28, 0x2C, 0x25, 0x15, 0x30, 0x34, 0x3C, 0x3E, 0x36, 0x66, 0xBA, 0xAE, 0xA9,
-    0xA7, 0xB8, 0xAD, 0xA1, 0x9A, 0x9E, 0x94, 0x8A, 0x9D, 0x99, 0x47, 0x3F, 0x62, 0x54, 0x57, 0x58,
-    0x51, 0x61, 0x54, 0x49, 0x44, 0x66, 0x63, 0x50, 0x5B, 0x53, 0x52, 0x4C, 0x46, 0x44, 0x47, 0x5B,
-    0x5F, 0x50, 0x3B, 0x6A, 0x65, 0x6F, 0x5B, 0x62, 0x5D, 0x2F, 0x27, 0x20, 0x34, 0x29, 0x26, 0x23,
-    0x1B, 0x1F, 0x1C, 0x1C, 0x1F, 0x2C, 0x42, 0x3C, 0x43, 0x69, 0x54, 0x42, 0x17, 0x14, 0x27, 0x18,
-    0x0E, 0x0F, 0x0E, 0x16, 0x0B, 0x10, 0x0D, 0x32, 0x5D, 0x5E, 0x4A, 0x67, 0x5C, 0x62, 0x78, 0x6A,
-    0x57, 0x31, 0x32, 0x38, 0x2A, 0x21, 0x63, 0xB6, 0xAB, 0xB4, 0xB4, 0xAA, 0xAB, 0xA3, 0x97, 0x96,
-    0x9C, 0x8F, 0x96, 0x9B, 0x3F, 0x33, 0x5C, 0x5C, 0x61, 0x67, 0x67, 0x4C, 0x43, 0x4C, 0x76, 0x6B,
-    0x6F, 0x74, 0x5B, 0x61, 0x62, 0x60, 0x43, 0x40, 0x53, 0x47, 0x66, 0x7D, 0x63, 0x73, 0x5E, 0x4C,
-    0x54, 0x53, 0x4A, 0x30, 0x37, 0x46, 0x5D, 0x42, 0x24, 0x1D, 0x0D, 0x02, 0x12, 0x1C, 0x1E, 0x2D,
-    0x2B, 0x1B, 0x1C, 0x29, 0x29, 0x22, 0x13, 0x35, 0x27, 0x50, 0x1E, 0x12, 0x1F, 0x2E, 0x27, 0x31,
-    0x3F, 0x50, 0x3E, 0x3E, 0x3B, 0x51, 0x46, 0x4C, 0x53, 0x57, 0x5D, 0x31, 0x24, 0x27, 0x2A, 0x24,
-    0x57, 0xB8, 0xB4, 0xB2, 0xAF, 0xB2, 0xA9, 0x99, 0x97, 0x98, 0x94, 0x8B, 0x97, 0x97, 0x3B, 0x13,
-    0x2A, 0x27, 0x20, 0x31, 0x44, 0x46, 0x4A, 0x40, 0x3A, 0x68, 0x5C, 0x54, 0x5C, 0x56, 0x53, 0x4A,
-    0x51, 0x5C, 0x57, 0x53, 0x58, 0x63, 0x65, 0x5F, 0x45, 0x35, 0x48, 0x4F, 0x42, 0x6A, 0x60, 0x68,
-    0x64, 0x55, 0x61, 0x61, 0x21, 0x09, 0x0E, 0x20, 0x18, 0x14, 0x10, 0x0E, 0x0A, 0x0F, 0x0D, 0x09,
-    0x1E, 0x25, 0x37, 0x51, 0x34, 0x58, 0x5B, 0x42, 0x41, 0x44, 0x3E, 0x39, 0x16, 0x3E, 0x42, 0x34,
-    0x35, 0x1F, 0x21, 0x3B, 0x30, 0x48, 0x27, 0x1B, 0x24, 0x1D, 0x54, 0xB1, 0xB0, 0xA8, 0xA5, 0xB1,
-    0xAB, 0x9C, 0x93, 0x94, 0x8B, 0x85, 0x8F, 0x97, 0x42, 0x25, 0x37, 0x1F, 0x0B, 0x1B, 0x3C, 0x53,
-    0x4A, 0x3A, 0x54, 0x5C, 0x66, 0x65, 0x50, 0x56, 0x51, 0x43, 0x46, 0x55, 0x5D, 0x4D, 0x5B, 0x4D,
-    0x4D, 0x4E, 0x55, 0x38, 0x61, 0x50, 0x49, 0x54, 0x4D, 0x51, 0x56, 0x35, 0x3D, 0x54, 0x5E, 0x24,
-    0x1C, 0x16, 0x16, 0x1F, 0x16, 0x01, 0x02, 0x0D, 0x09, 0x05, 0x17, 0x22, 0x37, 0x24, 0x12, 0x5B,
-    0x85, 0x51, 0x44, 0x3C, 0x25, 0x1A, 0x32, 0x3E, 0x2F, 0x29, 0x1B, 0x2B, 0x36, 0x2A, 0x25, 0x34,
-    0x2D, 0x26, 0x30, 0x23, 0x5F, 0xB7, 0xA9, 0xA9, 0xAF, 0xAE, 0xAE, 0x9D, 0x93, 0x96, 0x92, 0x8D,
-    0x95, 0x99, 0x52, 0x29, 0x33, 0x25, 0x11, 0x21, 0x45, 0x41, 0x42, 0x1C, 0x2C, 0x5D, 0x4E, 0x46,
-    0x51, 0x3D, 0x44, 0x33, 0x55, 0x56, 0x5C, 0x56, 0x54, 0x58, 0x37, 0x45, 0x5B, 0x48, 0x61, 0x48,
-    0x54, 0x42, 0x40, 0x4C, 0x50, 0x4B, 0x50, 0x47, 0x52, 0x62, 0x1E, 0x25, 0x25, 0x0F, 0x18, 0x15,
-    0x09, 0x01, 0x00, 0x01, 0x17, 0x1F, 0x1B, 0x15, 0x1D, 0x51, 0x52, 0x27, 0x16, 0x17, 0x19, 0x18,
-    0x37, 0x34, 0x32, 0x3F, 0x49, 0x65, 0x76, 0x63, 0x54, 0x5C, 0x69, 0x59, 0x56, 0x5E, 0x7E, 0xB4,
-    0xB3, 0xAF, 0xA7, 0xB1, 0xAC, 0x9E, 0x95, 0x99, 0x95, 0x90, 0x98, 0x9B, 0x45, 0x12, 0x17, 0x29,
-    0x2B, 0x2B, 0x39, 0x22, 0x2C, 0x1B, 0x1A, 0x31, 0x42, 0x31, 0x22, 0x1D, 0x1D, 0x39, 0x4F, 0x56,
-    0x47, 0x29, 0x56, 0x5C, 0x33, 0x34, 0x5E, 0x58, 0x60, 0x53, 0x48, 0x34, 0x3B, 0x3E, 0x40, 0x4D,
-    0x4A, 0x45, 0x4B, 0x66, 0x53, 0x03, 0x0F, 0x0B, 0x02, 0x0F, 0x02, 0x11, 0x34, 0x35, 0x19, 0x1D,
-    0x12, 0x1A, 0x1A, 0x1A, 0x21, 0x44, 0x41, 0x46, 0x50, 0x58, 0x5F, 0x60, 0x5D, 0x68, 0x67, 0x65,
-    0x60, 0x5E, 0x5D, 0x69, 0x52, 0x44, 0x3D, 0x39, 0x67, 0xAD, 0xAC, 0xA8, 0xA8, 0xAD, 0xA6, 0x9C,
-    0x97, 0x9A, 0x92, 0x8B, 0x94, 0x99, 0x42, 0x1C, 0x18, 0x1D, 0x24, 0x1D, 0x27, 0x23, 0x2B, 0x33,
-    0x21, 0x00, 0x2C, 0x19, 0x0B, 0x24, 0x1C, 0x31, 0x4F, 0x55, 0x55, 0x47, 0x5E, 0x5A, 0x45, 0x21,
-    0x5E, 0x66, 0x5E, 0x4E, 0x48, 0x30, 0x2A, 0x33, 0x3E, 0x4A, 0x45, 0x4D, 0x49, 0x4C, 0x74, 0x34,
-    0x00, 0x07, 0x09, 0x0B, 0x04, 0x1F, 0x48, 0x3C, 0x20, 0x06, 0x08, 0x09, 0x0D, 0x0E, 0x38, 0x56,
-    0x59, 0x5F, 0x5B, 0x5D, 0x5C, 0x65, 0x58, 0x59, 0x58, 0x5D, 0x54, 0x47, 0x54, 0x5A, 0x1F, 0x2E,
-    0x37, 0x22, 0x54, 0xAB, 0xAD, 0x9C, 0x9D, 0xA9, 0xA3, 0x9B, 0x96, 0x99, 0x8F, 0x87, 0x8F, 0x93,
-    0x78, 0x62, 0x62, 0x51, 0x52, 0x51, 0x4A, 0x37, 0x2F, 0x31, 0x26, 0x08, 0x18, 0x07, 0x1B, 0x21,
-    0x25, 0x26, 0x41, 0x32, 0x35, 0x43, 0x4A, 0x55, 0x4B, 0x36, 0x4C, 0x4C, 0x66, 0x4A, 0x61, 0x68,
-    0x3D, 0x39, 0x3A, 0x40, 0x49, 0x50, 0x47, 0x48, 0x5A, 0x4D, 0x03, 0x02, 0x12, 0x15, 0x06, 0x18,
-    0x17, 0x0D, 0x0F, 0x02, 0x0D, 0x09, 0x00, 0x14, 0x3D, 0x43, 0x51, 0x4F, 0x53, 0x53, 0x4D, 0x56,
-    0x52, 0x4B, 0x6D, 0xA4, 0x93, 0x95, 0x94, 0x70, 0x5F, 0x4D, 0x40, 0x2F, 0x62, 0xAC, 0xA9, 0xA4,
-    0xA8, 0xA2, 0xA3, 0x98, 0x93, 0x96, 0x90, 0x89, 0x8E, 0x8E, 0x77, 0x5D, 0x6A, 0x67, 0x69, 0x66,
-    0x53, 0x2C, 0x18, 0x1D, 0x23, 0x1B, 0x2F, 0x2F, 0x2B, 0x22, 0x1F, 0x29, 0x26, 0x24, 0x1D, 0x1E,
-    0x31, 0x33, 0x39, 0x4A, 0x44, 0x45, 0x5D, 0x4A, 0x32, 0x40, 0x49, 0x2D, 0x2E, 0x34, 0x38, 0x42,
-    0x43, 0x40, 0x48, 0x1F, 0x06, 0x05, 0x03, 0x09, 0x07, 0x10, 0x09, 0x0C, 0x15, 0x12, 0x0A, 0x0C,
-    0x02, 0x20, 0x33, 0x3B, 0x54, 0x4B, 0x4D, 0x51, 0x4A, 0x4B, 0x4E, 0x59, 0x98, 0x9B, 0xA2, 0x95,
-    0x9A, 0xA5, 0xA4, 0xA3, 0x9D, 0x9E, 0x97, 0x9B, 0x9E, 0x9F, 0x9A, 0xA3, 0x9D, 0x94, 0x90, 0x94,
-    0x8F, 0x8A, 0x8F, 0x8F, 0x73, 0x59, 0x5D, 0x5E, 0x5A, 0x50, 0x57, 0x4B, 0x12, 0x15, 0x19, 0x20,
-    0x4B, 0x50, 0x3F, 0x46, 0x3C, 0x2C, 0x07, 0x0E, 0x0E, 0x11, 0x18, 0x13, 0x1A, 0x2B, 0x20, 0x23,
-    0x2A, 0x45, 0x2C, 0x30, 0x3D, 0x29, 0x3F, 0x4A, 0x3D, 0x49, 0x51, 0x4E, 0x51, 0x30, 0x01, 0x04,
-    0x02, 0x00, 0x10, 0x08, 0x01, 0x05, 0x1A, 0x10, 0x13, 0x1B, 0x20, 0x25, 0x2B, 0x29, 0x41, 0x53,
-    0x48, 0x4A, 0x49, 0x42, 0x4B, 0x91, 0x93, 0x94, 0x93, 0x95, 0x96, 0x8D, 0x8D, 0x93, 0x91, 0x8D,
-    0x8C, 0x8F, 0x8A, 0x8C, 0x8C, 0x8D, 0x96, 0x91, 0x90, 0x94, 0x8C, 0x87, 0x90, 0x93, 0x80, 0x77,
-    0x6B, 0x65, 0x65, 0x50, 0x59, 0x54, 0x26, 0x13, 0x12, 0x33, 0x4A, 0x2B, 0x46, 0x4B, 0x6F, 0x70,
-    0x47, 0x4E, 0x2F, 0x16, 0x25, 0x2D, 0x51, 0x77, 0x36, 0x06, 0x23, 0x1D, 0x19, 0x2B, 0x3F, 0x2E,
-    0x31, 0x3C, 0x40, 0x4C, 0x45, 0x4F, 0x5B, 0x37, 0x00, 0x02, 0x01, 0x07, 0x0B, 0x01, 0x03, 0x00,
-    0x10, 0x00, 0x08, 0x1D, 0x21, 0x23, 0x27, 0x28, 0x2D, 0x36, 0x3E, 0x48, 0x40, 0x4B, 0x84, 0x90,
-    0x8E, 0x92, 0x92, 0x89, 0x8E, 0x8D, 0x8C, 0x8F, 0x8D, 0x86, 0x8C, 0x8A, 0x88, 0x89, 0x88, 0x8A,
-    0x89, 0x82, 0x84, 0x8A, 0x8A, 0x87, 0x8A, 0x8F, 0x98, 0x8C, 0x85, 0x8A, 0x8E, 0x88, 0x82, 0x77,
-    0x62, 0x44, 0x46, 0x54, 0x50, 0x33, 0x24, 0x64, 0x76, 0x53, 0x57, 0x63, 0x40, 0x6B, 0x73, 0x7A,
-    0x76, 0x64, 0x51, 0x1A, 0x05, 0x14, 0x15, 0x11, 0x1B, 0x27, 0x25, 0x33, 0x2E, 0x3D, 0x44, 0x43,
-    0x46, 0x20, 0x00, 0x00, 0x01, 0x04, 0x01, 0x04, 0x00, 0x00, 0x0F, 0x00, 0x08, 0x0F, 0x20, 0x23,
-    0x2F, 0x2C, 0x1F, 0x0F, 0x21, 0x24, 0x34, 0x77, 0x88, 0x8C, 0x85, 0x94, 0x87, 0x8C, 0x94, 0x95,
-    0x8C, 0x8E, 0x90, 0x8C, 0x89, 0x8C, 0x86, 0x87, 0x89, 0x86, 0x81, 0x82, 0x84, 0x84, 0x80, 0x82,
-    0x88, 0x8A, 0x84, 0x7E, 0x80, 0x83, 0x85, 0x85, 0x86, 0x86, 0x83, 0x83, 0x70, 0x5A, 0x5A, 0x6F,
-    0x6C, 0x7C, 0x75, 0x64, 0x5F, 0x5D, 0x48, 0x6C, 0x6A, 0x68, 0x62, 0x63, 0x58, 0x49, 0x0E, 0x00,
-    0x0C, 0x0C, 0x16, 0x21, 0x24, 0x20, 0x18, 0x2F, 0x31, 0x21, 0x3F, 0x1C, 0x07, 0x05, 0x07, 0x06,
-    0x00, 0x02, 0x00, 0x00, 0x0E, 0x00, 0x06, 0x0C, 0x23, 0x28, 0x2F, 0x2F, 0x18, 0x0F, 0x19, 0x19,
-    0x66, 0x90, 0x86, 0x88, 0x8B, 0x8D, 0x86, 0x8A, 0x81, 0x6E, 0x67, 0x61, 0x56, 0x8D, 0x86, 0x81,
-    0x86, 0x86, 0x83, 0x85, 0x7E, 0x85, 0x89, 0x85, 0x7F, 0x7F, 0x7D, 0x77, 0x66, 0x6A, 0x7A, 0x7E,
-    0x7A, 0x7C, 0x7A, 0x81, 0x79, 0x76, 0x59, 0x4C, 0x50, 0x72, 0x77, 0x7F, 0x7B, 0x7F, 0x78, 0x73,
-    0x72, 0x87, 0x83, 0x83, 0x79, 0x81, 0x74, 0x62, 0x51, 0x2E, 0x2C, 0x17, 0x16, 0x09, 0x0B, 0x1D,
-    0x1D, 0x22, 0x32, 0x34, 0x37, 0x22, 0x05, 0x00, 0x0A, 0x14, 0x06, 0x03, 0x01, 0x01, 0x13, 0x01,
-    0x04, 0x15, 0x22, 0x21, 0x16, 0x1B, 0x10, 0x14, 0x0B, 0x54, 0x87, 0x7E, 0x74, 0x68, 0x52, 0x4E,
-    0x83, 0x8F, 0x7F, 0x50, 0x4F, 0x3A, 0x31, 0x8A, 0x88, 0x83, 0x86, 0x83, 0x80, 0x85, 0x80, 0x7C,
-    0x74, 0x68, 0x5F, 0x5B, 0x57, 0x4F, 0x47, 0x4E, 0x68, 0x74, 0x72, 0x78, 0x72, 0x7B, 0x78, 0x74,
-    0x5B, 0x4B, 0x48, 0x71, 0x72, 0x75, 0x6E, 0x76, 0x73, 0x72, 0x76, 0x75, 0x74, 0x7B, 0x70, 0x7F,
-    0x78, 0x6F, 0x77, 0x85, 0x7D, 0x80, 0x7B, 0x74, 0x67, 0x6A, 0x68, 0x5D, 0x6C, 0x66, 0x4C, 0x3C,
-    0x1A, 0x09, 0x08, 0x0C, 0x07, 0x05, 0x00, 0x00, 0x11, 0x00, 0x02, 0x10, 0x18, 0x13, 0x03, 0x09,
-    0x0D, 0x00, 0x3B, 0x85, 0x7D, 0x80, 0x65, 0x4F, 0x28, 0x29, 0x84, 0x8C, 0x81, 0x54, 0x52, 0x41,
-    0x42, 0x78, 0x76, 0x7C, 0x6E, 0x68, 0x6D, 0x68, 0x67, 0x60, 0x5C, 0x5A, 0x57, 0x56, 0x55, 0x52,
-    0x42, 0x42, 0x55, 0x64, 0x68, 0x75, 0x6F, 0x77, 0x79, 0x76, 0x63, 0x45, 0x3D, 0x72, 0x6D, 0x6D,
-    0x68, 0x6B, 0x6C, 0x6F, 0x70, 0x65, 0x69, 0x6C, 0x75, 0x72, 0x7C, 0x76, 0x6B, 0x73, 0x6D, 0x77,
-    0x78, 0x82, 0x85, 0x7E, 0x89, 0x8C, 0x92, 0x8E, 0x7E, 0x47, 0x0A, 0x0A, 0x02, 0x02, 0x06, 0x00,
-    0x00, 0x00, 0x15, 0x00, 0x09, 0x04, 0x0E, 0x09, 0x04, 0x06, 0x00, 0x2E, 0x7B, 0x7E, 0x77, 0x85,
-    0x67, 0x4D, 0x37, 0x3D, 0x7B, 0x6D, 0x63, 0x50, 0x46, 0x45, 0x45, 0x69, 0x62, 0x5F, 0x56, 0x54,
-    0x55, 0x50, 0x57, 0x55, 0x58, 0x5B, 0x5A, 0x57, 0x51, 0x4A, 0x48, 0x40, 0x46, 0x59, 0x5F, 0x6D,
-    0x68, 0x6F, 0x71, 0x69, 0x5B, 0x3E, 0x3C, 0x6E, 0x67, 0x6A, 0x61, 0x61, 0x66, 0x6A, 0x6F, 0x6D,
-    0x71, 0x6A, 0x6C, 0x6B, 0x74, 0x72, 0x7D, 0x71, 0x6F, 0x6C, 0x6B, 0x63, 0x76, 0x6C, 0x74, 0x77,
-    0x6C, 0x7C, 0x6E, 0x50, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x09, 0x02, 0x02, 0x1F, 0x05, 0x0F, 0x05,
-    0x07, 0x02, 0x02, 0x07, 0x15, 0x7B, 0x73, 0x75, 0x7A, 0x69, 0x5C, 0x43, 0x34, 0x38, 0x5E, 0x56,
-    0x4D, 0x4A, 0x3E, 0x44, 0x43, 0x67, 0x62, 0x53, 0x59, 0x5A, 0x51, 0x56, 0x54, 0x55, 0x54, 0x53,
-    0x5B, 0x67, 0x62, 0x51, 0x46, 0x3D, 0x3B, 0x53, 0x59, 0x65, 0x63, 0x6A, 0x66, 0x69, 0x59, 0x36,
-    0x34, 0x5F, 0x5E, 0x5A, 0x5C, 0x5C, 0x63, 0x64, 0x6A, 0x6D, 0x6C, 0x66, 0x67, 0x78, 0x69, 0x6C,
-    0x6E, 0x75, 0x70, 0x75, 0x72, 0x69, 0x79, 0x70, 0x6D, 0x76, 0x72, 0x77, 0x57, 0x5B, 0x37, 0x10,
-    0x21, 0x1C, 0x07, 0x04, 0x02, 0x01, 0x17, 0x00, 0x06, 0x0B, 0x03, 0x03, 0x01, 0x10, 0x6A, 0x6B,
-    0x76, 0x79, 0x87, 0x5B, 0x46, 0x3E, 0x36, 0x2E, 0x53, 0x5B, 0x51, 0x4E, 0x4E, 0x50, 0x50, 0x5A,
-    0x5E, 0x54, 0x57, 0x56, 0x4D, 0x52, 0x53, 0x57, 0x53, 0x50, 0x5F, 0x73, 0x66, 0x44, 0x50, 0x44,
-    0x39, 0x4F, 0x50, 0x58, 0x5B, 0x64, 0x66, 0x65, 0x4F, 0x33, 0x30, 0x49, 0x54, 0x5D, 0x58, 0x5A,
-    0x61, 0x62, 0x67, 0x67, 0x64, 0x68, 0x68, 0x68, 0x6E, 0x69, 0x68, 0x6A, 0x71, 0x6B, 0x6B, 0x65,
-    0x69, 0x73, 0x65, 0x62, 0x6F, 0x61, 0x54, 0x56, 0x63, 0x30, 0x26, 0x24, 0x23, 0x18, 0x09, 0x08,
-    0x0B, 0x00, 0x06, 0x05, 0x05, 0x04, 0x07, 0x5E, 0x6B, 0x6F, 0x82, 0x73, 0x8F, 0x69, 0x3B, 0x4B,
-    0x3C, 0x45, 0x51, 0x54, 0x52, 0x58, 0x5E, 0x5B, 0x5D, 0x5E, 0x54, 0x57, 0x57, 0x51, 0x54, 0x54,
-    0x51, 0x53, 0x57, 0x50, 0x5C, 0x79, 0x4C, 0x38, 0x54, 0x41, 0x37, 0x41, 0x4D, 0x51, 0x53, 0x5B,
-    0x5F, 0x5C, 0x5B, 0x43, 0x2D, 0x3A, 0x4B, 0x55, 0x53, 0x60, 0x60, 0x62, 0x5F, 0x5F, 0x6E, 0x68,
-    0x5D, 0x6B, 0x69, 0x6B, 0x70, 0x68, 0x74, 0x6D, 0x72, 0x66, 0x5F, 0x69, 0x65, 0x62, 0x70, 0x69,
-    0x59, 0x5E, 0x71, 0x3C, 0x26, 0x2D, 0x2B, 0x26, 0x20, 0x15, 0x00, 0x02, 0x00, 0x00, 0x07, 0x06,
-    0x48, 0x71, 0x73, 0x77, 0x7D, 0x79, 0x89, 0x7B, 0x4D, 0x5B, 0x53, 0x59, 0x5C, 0x57, 0x4F, 0x4F,
-    0x51, 0x4F, 0x55, 0x57, 0x54, 0x57, 0x59, 0x56, 0x54, 0x53, 0x4B, 0x4B, 0x4D, 0x4A, 0x63, 0x65,
-    0x2F, 0x4A, 0x54, 0x3E, 0x39, 0x32, 0x4D, 0x4C, 0x54, 0x5C, 0x5C, 0x56, 0x52, 0x3D, 0x2E, 0x3D,
-    0x4C, 0x54, 0x56, 0x5C, 0x59, 0x69, 0x60, 0x66, 0x66, 0x61, 0x69, 0x6A, 0x64, 0x66, 0x68, 0x64,
-    0x6D, 0x6B, 0x69, 0x68, 0x6D, 0x68, 0x5E, 0x63, 0x6C, 0x5D, 0x55, 0x48, 0x58, 0x48, 0x0D, 0x19,
-    0x15, 0x1A, 0x19, 0x13, 0x25, 0x26, 0x25, 0x06, 0x00, 0x18, 0x61, 0x6B, 0x70, 0x76, 0x77, 0x7B,
-    0x82, 0x83, 0x54, 0x52, 0x4D, 0x50, 0x50, 0x4F, 0x51, 0x52, 0x53, 0x54, 0x54, 0x55, 0x56, 0x54,
-    0x55, 0x53, 0x4C, 0x4A, 0x4F, 0x4A, 0x53, 0x47, 0x56, 0x53, 0x2C, 0x54, 0x58, 0x42, 0x3F, 0x2F,
-    0x48, 0x4A, 0x4F, 0x59, 0x5D, 0x53, 0x4B, 0x39, 0x33, 0x42, 0x53, 0x58, 0x5A, 0x57, 0x58, 0x69,
-    0x5E, 0x62, 0x5D, 0x5A, 0x65, 0x5D, 0x5C, 0x65, 0x64, 0x63, 0x63, 0x62, 0x68, 0x60, 0x63, 0x65,
-    0x67, 0x82, 0x71, 0x5A, 0x48, 0x47, 0x52, 0x5B, 0x21, 0x09, 0x05, 0x15, 0x1F, 0x1B, 0x2B, 0x3A,
-    0x48, 0x28, 0x24, 0x5B, 0x6F, 0x65, 0x6E, 0x73, 0x79, 0x7B, 0x81, 0x84, 0x5C, 0x45, 0x49, 0x4B,
-    0x48, 0x4A, 0x52, 0x53, 0x4F, 0x50, 0x51, 0x50, 0x52, 0x4D, 0x50, 0x54, 0x4D, 0x4E, 0x4A, 0x49,
-    0x54, 0x46, 0x4D, 0x4F, 0x3D, 0x5B, 0x5A, 0x47, 0x44, 0x3B, 0x3C, 0x4C, 0x49, 0x53, 0x5C, 0x56,
-    0x52, 0x46, 0x45, 0x4D, 0x5A, 0x5B, 0x5B, 0x53, 0x5C, 0x61, 0x5B, 0x59, 0x5C, 0x5C, 0x5E, 0x54,
-    0x5A, 0x65, 0x60, 0x65, 0x5C, 0x59, 0x64, 0x5D, 0x5B, 0x67, 0x65, 0x7D, 0x5C, 0x5E, 0x39, 0x43,
-    0x51, 0x5D, 0x49, 0x0B, 0x21, 0x3A, 0x42, 0x32, 0x2C, 0x23, 0x1F, 0x44, 0x60, 0x6E, 0x61, 0x68,
-    0x6E, 0x71, 0x74, 0x76, 0x79, 0x84, 0x67, 0x47, 0x47, 0x4B, 0x4B, 0x4C, 0x53, 0x53, 0x52, 0x55,
-    0x52, 0x4F, 0x50, 0x4A, 0x4E, 0x54, 0x4E, 0x50, 0x4A, 0x4C, 0x4A, 0x47, 0x53, 0x49, 0x3F, 0x5C,
-    0x59, 0x47, 0x48, 0x43, 0x31, 0x48, 0x48, 0x50, 0x55, 0x59, 0x5F, 0x58, 0x59, 0x55, 0x5C, 0x59,
-    0x5C, 0x57, 0x5D, 0x5D, 0x58, 0x5A, 0x5E, 0x5E, 0x63, 0x5B, 0x60, 0x61, 0x5A, 0x64, 0x5C, 0x58,
-    0x60, 0x5A, 0x59, 0x63, 0x6B, 0x71, 0x4D, 0x5D, 0x4D, 0x43, 0x53, 0x5B, 0x59, 0x26, 0x48, 0x70,
-    0x76, 0x69, 0x25, 0x43, 0x45, 0x4E, 0x5B, 0x5F, 0x5E, 0x6B, 0x69, 0x6E, 0x6D, 0x74, 0x70, 0x82,
-    0x6D, 0x4B, 0x42, 0x49, 0x4D, 0x4D, 0x4D, 0x50, 0x55, 0x5B, 0x51, 0x50, 0x4E, 0x4B, 0x4E, 0x4F,
-    0x49, 0x49, 0x53, 0x4D, 0x45, 0x49, 0x4C, 0x4D, 0x52, 0x5D, 0x5E, 0x4A, 0x50, 0x41, 0x30, 0x3D,
-    0x49, 0x4D, 0x4F, 0x56, 0x5D, 0x57, 0x5A, 0x51, 0x5A, 0x58, 0x5C, 0x60, 0x59, 0x5E, 0x55, 0x5D,
-    0x58, 0x56, 0x60, 0x5E, 0x63, 0x5E, 0x59, 0x62, 0x5C, 0x56, 0x61, 0x56, 0x57, 0x5D, 0x7C, 0x77,
-    0x59, 0x55, 0x45, 0x43, 0x58, 0x6A, 0x69, 0x3F, 0x14, 0x39, 0x4F, 0x50, 0x2B, 0x40, 0x4A, 0x4D,
-    0x58, 0x5E, 0x5B, 0x5B, 0x66, 0x6A, 0x6F, 0x73, 0x74, 0x7D, 0x74, 0x51, 0x4B, 0x4F, 0x50, 0x4C,
-    0x47, 0x48, 0x49, 0x47, 0x4A, 0x4B, 0x49, 0x4E, 0x52, 0x4F, 0x4D, 0x4A, 0x4F, 0x47, 0x44, 0x47,
-    0x44, 0x5D, 0x68, 0x65, 0x5E, 0x50, 0x51, 0x3B, 0x35, 0x34, 0x46, 0x4B, 0x4C, 0x50, 0x53, 0x4E,
-    0x55, 0x4D, 0x5A, 0x5A, 0x57, 0x62, 0x57, 0x5E, 0x56, 0x58, 0x54, 0x55, 0x56, 0x5A, 0x60, 0x5B,
-    0x5D, 0x5F, 0x5B, 0x54, 0x5B, 0x5A, 0x60, 0x68, 0x73, 0x6A, 0x5F, 0x4F, 0x4B, 0x51, 0x52, 0x59,
-    0x68, 0x54, 0x07, 0x11, 0x0F, 0x0A, 0x35, 0x3F, 0x42, 0x56, 0x4E, 0x4C, 0x5D, 0x5F, 0x61, 0x61,
-    0x6E, 0x67, 0x74, 0x74, 0x7B, 0x57, 0x48, 0x47, 0x4A, 0x4A, 0x4B, 0x50, 0x4E, 0x42, 0x4F, 0x51,
-    0x4B, 0x52, 0x56, 0x4E, 0x4D, 0x49, 0x48, 0x4D, 0x46, 0x44, 0x4C, 0x63, 0x57, 0x61, 0x55, 0x51,
-    0x4B, 0x36, 0x38, 0x33, 0x41, 0x4B, 0x48, 0x4D, 0x50, 0x4E, 0x59, 0x50, 0x5B, 0x59, 0x4E, 0x5E,
-    0x59, 0x5B, 0x5C, 0x52, 0x5A, 0x60, 0x54, 0x58, 0x5C, 0x56, 0x5D, 0x5B, 0x5A, 0x54, 0x58, 0x5C,
-    0x60, 0x78, 0x68, 0x67, 0x66, 0x55, 0x3E, 0x41, 0x3F, 0x44, 0x64, 0x6A, 0x3A, 0x13, 0x10, 0x01,
-    0x30, 0x3A, 0x49, 0x4A, 0x4A, 0x50, 0x55, 0x5D, 0x5D, 0x65, 0x67, 0x66, 0x69, 0x6D, 0x79, 0x63,
-    0x44, 0x4F, 0x3C, 0x4E, 0x4E, 0x48, 0x52, 0x4C, 0x4D, 0x4C, 0x50, 0x4C, 0x4D, 0x4E, 0x45, 0x46,
-    0x46, 0x43, 0x41, 0x3F, 0x4B, 0x58, 0x30, 0x38, 0x39, 0x2D, 0x3E, 0x3C, 0x35, 0x34, 0x38, 0x45,
-    0x3F, 0x47, 0x46, 0x49, 0x50, 0x4C, 0x5D, 0x59, 0x51, 0x5E, 0x5D, 0x5C, 0x63, 0x5D, 0x52, 0x57,
-    0x57, 0x5A, 0x5D, 0x53, 0x57, 0x5A, 0x4D, 0x53, 0x57, 0x55, 0x63, 0x66, 0x6A, 0x5F, 0x43, 0x48,
-    0x3F, 0x3A, 0x41, 0x37, 0x4A, 0x67, 0x5A, 0x0C, 0x00, 0x01, 0x30, 0x39, 0x45, 0x44, 0x46, 0x4E,
-    0x50, 0x54, 0x60, 0x64, 0x61, 0x66, 0x69, 0x69, 0x7D, 0x6F, 0x47, 0x46, 0x3D, 0x39, 0x43, 0x46,
-    0x52, 0x50, 0x47, 0x4C, 0x46, 0x41, 0x4F, 0x4F, 0x44, 0x52, 0x48, 0x47, 0x43, 0x30, 0x46, 0x5F,
-    0x47, 0x46, 0x43, 0x33, 0x3F, 0x39, 0x35, 0x2C, 0x42, 0x67, 0x60, 0x48, 0x46, 0x48, 0x52, 0x50,
-    0x50, 0x56, 0x52, 0x57, 0x55, 0x4F, 0x51, 0x55, 0x55, 0x53, 0x4E, 0x52, 0x5B, 0x58, 0x5E, 0x5E,
-    0x51, 0x58, 0x62, 0x54, 0x5F, 0x50, 0x58, 0x50, 0x36, 0x3E, 0x35, 0x39, 0x3D, 0x3D, 0x45, 0x52,
-    0x6D, 0x38, 0x1D, 0x2E, 0x2E, 0x3A, 0x46, 0x44, 0x46, 0x4E, 0x53, 0x5B, 0x54, 0x5A, 0x59, 0x63,
-    0x67, 0x66, 0x78, 0x6E, 0x51, 0x48, 0x46, 0x33, 0x3C, 0x47, 0x4A, 0x49, 0x4C, 0x44, 0x3C, 0x3C,
-    0x4A, 0x51, 0x47, 0x41, 0x42, 0x45, 0x48, 0x2F, 0x4B, 0x63, 0x56, 0x4C, 0x51, 0x4D, 0x4D, 0x4F,
-    0x51, 0x55, 0x5A, 0x67, 0x6E, 0x5B, 0x58, 0x50, 0x56, 0x59, 0x50, 0x50, 0x50, 0x4B, 0x4E, 0x53,
-    0x51, 0x53, 0x56, 0x55, 0x52, 0x51, 0x56, 0x56, 0x5A, 0x59, 0x52, 0x5D, 0x65, 0x5A, 0x6D, 0x56,
-    0x54, 0x45, 0x32, 0x46, 0x2F, 0x3A, 0x3F, 0x37, 0x55, 0x5D, 0x67, 0x55, 0x4D, 0x58, 0x37, 0x3A,
-    0x3D, 0x3D, 0x44, 0x4B, 0x49, 0x4D, 0x57, 0x5B, 0x5C, 0x5C, 0x61, 0x6A, 0x71, 0x67, 0x54, 0x4A,
-    0x44, 0x36, 0x35, 0x46, 0x45, 0x49, 0x46, 0x3E, 0x43, 0x49, 0x47, 0x44, 0x43, 0x43, 0x3F, 0x3D,
-    0x3E, 0x29, 0x3E, 0x4E, 0x4C, 0x4A, 0x4C, 0x4C, 0x52, 0x44, 0x32, 0x2E, 0x3B, 0x2F, 0x2E, 0x39,
-    0x37, 0x33, 0x39, 0x41, 0x4F, 0x5B, 0x59, 0x59, 0x57, 0x50, 0x4D, 0x54, 0x5A, 0x56, 0x59, 0x55,
-    0x54, 0x50, 0x52, 0x53, 0x4F, 0x57, 0x53, 0x5B, 0x74, 0x6A, 0x5E, 0x44, 0x30, 0x43, 0x37, 0x40,
-    0x4E, 0x45, 0x57, 0x45, 0x46, 0x50, 0x50, 0x4D, 0x2A, 0x32, 0x3A, 0x3D, 0x43, 0x45, 0x47, 0x54,
-    0x59, 0x57, 0x60, 0x60, 0x64, 0x6C, 0x5D, 0x54, 0x56, 0x4E, 0x4E, 0x49, 0x43, 0x43, 0x40, 0x3E,
-    0x43, 0x49, 0x3F, 0x3A, 0x46, 0x49, 0x42, 0x3E, 0x3D, 0x40, 0x42, 0x39, 0x41, 0x4F, 0x54, 0x59,
-    0x49, 0x5D, 0x53, 0x3D, 0x5C, 0x36, 0x3F, 0x53, 0x56, 0x52, 0x45, 0x4F, 0x54, 0x41, 0x36, 0x38,
-    0x3A, 0x41, 0x46, 0x4A, 0x4F, 0x50, 0x4F, 0x53, 0x49, 0x49, 0x4A, 0x4B, 0x50, 0x53, 0x50, 0x51,
-    0x58, 0x67, 0x6A, 0x6A, 0x5E, 0x4F, 0x40, 0x45, 0x5C, 0x5C, 0x52, 0x3D, 0x33, 0x2F, 0x56, 0x44,
-    0x41, 0x43, 0x28, 0x34, 0x3D, 0x3E, 0x42, 0x43, 0x46, 0x58, 0x55, 0x4E, 0x59, 0x61, 0x64, 0x66,
-    0x52, 0x52, 0x59, 0x4E, 0x55, 0x4E, 0x4E, 0x3A, 0x3F, 0x36, 0x42, 0x43, 0x40, 0x44, 0x45, 0x42,
-    0x4B, 0x54, 0x49, 0x50, 0x4E, 0x47, 0x3D, 0x42, 0x43, 0x42, 0x47, 0x5C, 0x60, 0x64, 0x5C, 0x39,
-    0x50, 0x5E, 0x5E, 0x4C, 0x48, 0x59, 0x63, 0x6B, 0x6B, 0x73, 0x5F, 0x5A, 0x4B, 0x3C, 0x38, 0x38,
-    0x3B, 0x44, 0x47, 0x47, 0x48, 0x4A, 0x4D, 0x51, 0x50, 0x4E, 0x5F, 0x72, 0x67, 0x6A, 0x62, 0x5D,
-    0x52, 0x4D, 0x4D, 0x4F, 0x50, 0x48, 0x4B, 0x55, 0x5D, 0x30, 0x48, 0x50, 0x2D, 0x2F, 0x2B, 0x2A,
-    0x3D, 0x4B, 0x4A, 0x52, 0x53, 0x51, 0x4F, 0x59, 0x5C, 0x5F, 0x5C, 0x63, 0x52, 0x40, 0x45, 0x3B,
-    0x41, 0x38, 0x46, 0x44, 0x3D, 0x47, 0x48, 0x43, 0x45, 0x5B, 0x5E, 0x38, 0x1B, 0x1F, 0x1A, 0x18,
-    0x0D, 0x11, 0x18, 0x16, 0x25, 0x37, 0x37, 0x4D, 0x44, 0x33, 0x42, 0x31, 0x30, 0x3C, 0x50, 0x50,
-    0x2C, 0x39, 0x56, 0x4F, 0x64, 0x74, 0x7D, 0x75, 0x6E, 0x6D, 0x5E, 0x44, 0x3D, 0x3A, 0x3A, 0x3E,
-    0x40, 0x43, 0x4B, 0x4E, 0x4E, 0x5D, 0x5C, 0x67, 0x5F, 0x4D, 0x3C, 0x3D, 0x41, 0x3C, 0x4B, 0x55,
-    0x5A, 0x57, 0x4B, 0x3D, 0x4A, 0x4C, 0x4C, 0x50, 0x42, 0x29, 0x28, 0x2E, 0x2F, 0x39, 0x3F, 0x50,
-    0x4D, 0x5B, 0x5B, 0x59, 0x5C, 0x5A, 0x48, 0x39, 0x43, 0x42, 0x43, 0x44, 0x46, 0x44, 0x48, 0x43,
-    0x3F, 0x51, 0x55, 0x3B, 0x24, 0x16, 0x1B, 0x1A, 0x1A, 0x1F, 0x16, 0x0C, 0x0F, 0x09, 0x0B, 0x1C,
-    0x39, 0x4B, 0x58, 0x32, 0x4C, 0x27, 0x29, 0x3F, 0x52, 0x56, 0x1B, 0x24, 0x53, 0x2C, 0x57, 0x43,
-    0x4B, 0x64, 0x69, 0x6D, 0x7A, 0x82, 0x79, 0x6F, 0x63, 0x5A, 0x48, 0x37, 0x35, 0x35, 0x52, 0x46,
-    0x44, 0x4D, 0x48, 0x2A, 0x1D, 0x31, 0x57, 0x5A, 0x55, 0x55, 0x43, 0x48, 0x56, 0x36, 0x4E, 0x4C,
-    0x35, 0x4C, 0x53, 0x3B, 0x59, 0x56, 0x46, 0x36, 0x2B, 0x32, 0x3D, 0x44, 0x4A, 0x5C, 0x6C, 0x43,
-    0x51, 0x2B, 0x33, 0x43, 0x30, 0x3E, 0x3E, 0x3E, 0x35, 0x33, 0x32, 0x45, 0x22, 0x10, 0x19, 0x17,
-    0x19, 0x1E, 0x1B, 0x16, 0x15, 0x13, 0x1E, 0x23, 0x39, 0x4F, 0x57, 0x55, 0x4E, 0x2E, 0x3F, 0x32,
-    0x17, 0x32, 0x4E, 0x4E, 0x17, 0x20, 0x54, 0x29, 0x5F, 0x39, 0x37, 0x5A, 0x20, 0x5C, 0x50, 0x52,
-    0x69, 0x6E, 0x6D, 0x76, 0x77, 0x72, 0x6B, 0x37, 0x3C, 0x51, 0x52, 0x62, 0x5B, 0x37, 0x1C, 0x3E,
-    0x58, 0x51, 0x3D, 0x43, 0x31, 0x4A, 0x4A, 0x39, 0x4B, 0x4E, 0x32, 0x2C, 0x2D, 0x30, 0x50, 0x5A,
-    0x61, 0x60, 0x5E, 0x52, 0x47, 0x38, 0x34, 0x40, 0x63, 0x3C, 0x3D, 0x38, 0x32, 0x47, 0x35, 0x37,
-    0x21, 0x27, 0x33, 0x38, 0x15, 0x2E, 0x44, 0x45, 0x45, 0x3E, 0x40, 0x46, 0x49, 0x41, 0x3F, 0x4B,
-    0x5A, 0x6A, 0x73, 0x75, 0x5A, 0x40, 0x4C, 0x1F, 0x47, 0x67, 0x61, 0x48, 0x45, 0x55, 0x51, 0x40,
-    0x45, 0x39, 0x64, 0x37, 0x2B, 0x58, 0x23, 0x60, 0x3F, 0x3B, 0x6E, 0x1A, 0x54, 0x51, 0x3F, 0x56,
-    0x69, 0x4D, 0x49, 0x73, 0x72, 0x63, 0x4B, 0x32, 0x23, 0x43, 0x4A, 0x37, 0x2E, 0x3E, 0x34, 0x48,
-    0x52, 0x38, 0x48, 0x46, 0x2E, 0x2B, 0x24, 0x31, 0x49, 0x53, 0x54, 0x52, 0x62, 0x47, 0x4B, 0x63,
-    0x5C, 0x52, 0x3A, 0x40, 0x44, 0x24, 0x2C, 0x42, 0x2A, 0x40, 0x45, 0x63, 0x5E, 0x4D, 0x0A, 0x31,
-    0x5E, 0x5F, 0x6C, 0x76, 0x77, 0x74, 0x77, 0x7F, 0x6A, 0x71, 0x67, 0x75, 0x34, 0x60, 0x59, 0x2A,
-    0x4F, 0x2A, 0x3C, 0x29, 0x0C, 0x2D, 0x4A, 0x3A, 0x18, 0x2A, 0x49, 0x3B, 0x2C, 0x51, 0x4D, 0x58,
-    0x25, 0x57, 0x3E, 0x3B, 0x66, 0x1E, 0x51, 0x41, 0x0C, 0x1D, 0x67, 0x3C, 0x43, 0x60, 0x56, 0x4F,
-    0x45, 0x34, 0x21, 0x3B, 0x31, 0x4B, 0x52, 0x48, 0x41, 0x46, 0x47, 0x35, 0x4E, 0x4B, 0x25, 0x33,
-    0x22, 0x2C, 0x47, 0x55, 0x4E, 0x56, 0x5C, 0x30, 0x3A, 0x2B, 0x3C, 0x4F, 0x58, 0x4C, 0x51, 0x3D,
-    0x3A, 0x41, 0x3A, 0x5A, 0x58, 0x18, 0x35, 0x3A, 0x12, 0x2F, 0x51, 0x6A, 0x63, 0x24, 0x25, 0x6D,
-    0x30, 0x28, 0x64, 0x78, 0x2A, 0x47, 0x42, 0x5C, 0x5E, 0x3C, 0x4F, 0x1B, 0x38, 0x29, 0x21, 0x31,
-    0x42, 0x45, 0x11, 0x1A, 0x34, 0x15, 0x2F, 0x3C, 0x43, 0x5A, 0x59, 0x54, 0x54, 0x4A, 0x58, 0x1A,
-    0x46, 0x3F, 0x03, 0x20, 0x61, 0x39, 0x44, 0x56, 0x4B, 0x4F, 0x4A, 0x33, 0x20, 0x41, 0x3D, 0x37,
-    0x4D, 0x4A, 0x3A, 0x49, 0x52, 0x43, 0x4B, 0x4C, 0x22, 0x2D, 0x1F, 0x2A, 0x46, 0x54, 0x4F, 0x5E,
-    0x55, 0x4B, 0x49, 0x34, 0x45, 0x21, 0x4D, 0x65, 0x4E, 0x3C, 0x44, 0x44, 0x40, 0x4A, 0x3B, 0x31,
-    0x41, 0x2A, 0x0E, 0x34, 0x44, 0x59, 0x5C, 0x28, 0x25, 0x66, 0x2D, 0x22, 0x53, 0x73, 0x49, 0x4E,
-    0x61, 0x6F, 0x5C, 0x3A, 0x47, 0x23, 0x3C, 0x1E, 0x0D, 0x29, 0x3C, 0x38, 0x1A, 0x1B, 0x31, 0x2A,
-    0x33, 0x33, 0x29, 0x47, 0x18, 0x4A, 0x47, 0x30, 0x36, 0x59, 0x56, 0x4D, 0x1F, 0x1D, 0x62, 0x36,
-    0x41, 0x56, 0x4A, 0x48, 0x41, 0x2E, 0x1D, 0x3D, 0x51, 0x34, 0x48, 0x3D, 0x2B, 0x46, 0x45, 0x39,
-    0x55, 0x55, 0x27, 0x2B, 0x2C, 0x2D, 0x3F, 0x50, 0x4D, 0x4D, 0x5C, 0x52, 0x4E, 0x47, 0x4D, 0x3A,
-    0x51, 0x4D, 0x48, 0x4B, 0x3B, 0x45, 0x3E, 0x4B, 0x50, 0x4B, 0x51, 0x3C, 0x19, 0x35, 0x40, 0x50,
-    0x60, 0x4C, 0x4D, 0x5C, 0x53, 0x58, 0x5C, 0x67, 0x70, 0x51, 0x4C, 0x71, 0x59, 0x3D, 0x41, 0x1B,
-    0x2E, 0x21, 0x1D, 0x20, 0x33, 0x1F, 0x24, 0x25, 0x2B, 0x31, 0x3D, 0x2C, 0x39, 0x41, 0x21, 0x3F,
-    0x29, 0x13, 0x36, 0x19, 0x46, 0x46, 0x4D, 0x5B, 0x4F, 0x37, 0x3D, 0x50, 0x45, 0x47, 0x46, 0x34,
-    0x1F, 0x3B, 0x35, 0x37, 0x51, 0x38, 0x30, 0x4A, 0x3C, 0x3A, 0x56, 0x50, 0x23, 0x28, 0x38, 0x29,
-    0x3A, 0x48, 0x4B, 0x51, 0x53, 0x4C, 0x3C, 0x1D, 0x3E, 0x4C, 0x5A, 0x5C, 0x52, 0x3E, 0x40, 0x46,
-    0x35, 0x52, 0x51, 0x33, 0x40, 0x41, 0x13, 0x2E, 0x46, 0x4F, 0x5B, 0x48, 0x48, 0x3E, 0x4E, 0x64,
-    0x62, 0x6C, 0x61, 0x12, 0x38, 0x6C, 0x50, 0x35, 0x3F, 0x1F, 0x26, 0x13, 0x05, 0x15, 0x35, 0x19,
-    0x08, 0x18, 0x2C, 0x3B, 0x42, 0x3E, 0x3F, 0x3C, 0x30, 0x36, 0x21, 0x2C, 0x40, 0x12, 0x49, 0x39,
-    0x01, 0x1B, 0x59, 0x2C, 0x37, 0x4B, 0x45, 0x4B, 0x43, 0x29, 0x18, 0x3D, 0x37, 0x34, 0x4F, 0x3B,
-    0x37, 0x42, 0x40, 0x3A, 0x54, 0x4D, 0x1C, 0x23, 0x3A, 0x28, 0x3C, 0x2F, 0x2B, 0x4C, 0x4C, 0x4E,
-    0x14, 0x00, 0x07, 0x3D, 0x50, 0x4E, 0x51, 0x30, 0x38, 0x49, 0x3E, 0x46, 0x46, 0x0E, 0x16, 0x3A,
-    0x13, 0x2A, 0x3E, 0x48, 0x5E, 0x46, 0x11, 0x08, 0x20, 0x56, 0x60, 0x68, 0x42, 0x01, 0x33, 0x66,
-    0x4C, 0x2F, 0x31, 0x14, 0x2A, 0x20, 0x1B, 0x2A, 0x2F, 0x2D, 0x17, 0x25, 0x2F, 0x3D, 0x47, 0x44,
-    0x3D, 0x45, 0x47, 0x2C, 0x21, 0x1F, 0x35, 0x18, 0x49, 0x37, 0x04, 0x1E, 0x53, 0x28, 0x3D, 0x50,
-    0x44, 0x46, 0x42, 0x30, 0x22, 0x45, 0x2B, 0x50, 0x5D, 0x31, 0x43, 0x44, 0x41, 0x3F, 0x52, 0x4F,
-    0x0F, 0x18, 0x2E, 0x22, 0x34, 0x1B, 0x1C, 0x40, 0x46, 0x42, 0x23, 0x11, 0x04, 0x19, 0x48, 0x43,
-    0x45, 0x40, 0x3A, 0x42, 0x4C, 0x48, 0x2D, 0x06, 0x26, 0x35, 0x16, 0x37, 0x3F, 0x40, 0x52, 0x38,
-    0x03, 0x01, 0x0B, 0x3A, 0x5D, 0x5D, 0x4C, 0x28, 0x42, 0x54, 0x4B, 0x38, 0x38, 0x19, 0x27, 0x29,
-    0x20, 0x27, 0x32, 0x20, 0x11, 0x19, 0x32, 0x34, 0x37, 0x37, 0x3C, 0x41, 0x45, 0x3A, 0x2F, 0x1B,
-    0x2C, 0x2C, 0x3D, 0x3E, 0x1F, 0x2E, 0x52, 0x2B, 0x37, 0x49, 0x46, 0x46, 0x40, 0x2A, 0x22, 0x43,
-    0x3C, 0x3E, 0x3C, 0x52, 0x54, 0x47, 0x3F, 0x3F, 0x4B, 0x4B, 0x05, 0x0E, 0x1F, 0x1A, 0x21, 0x12,
-    0x10, 0x36, 0x46, 0x42, 0x2D, 0x2F, 0x27, 0x29, 0x48, 0x44, 0x44, 0x43, 0x3D, 0x3E, 0x41, 0x46,
-    0x45, 0x37, 0x41, 0x3B, 0x16, 0x38, 0x3F, 0x3C, 0x4E, 0x43, 0x39, 0x38, 0x35, 0x4C, 0x5C, 0x59,
-    0x58, 0x49, 0x4C, 0x4F, 0x44, 0x3A, 0x38, 0x13, 0x25, 0x31, 0x29, 0x20, 0x22, 0x19, 0x16, 0x1F,
-    0x2F, 0x2A, 0x28, 0x27, 0x2D, 0x37, 0x43, 0x3E, 0x36, 0x23, 0x1F, 0x20, 0x34, 0x31, 0x3F, 0x49,
-    0x49, 0x24, 0x38, 0x4A, 0x47, 0x47, 0x40, 0x2A, 0x21, 0x41, 0x4F, 0x43, 0x37, 0x4F, 0x53, 0x43,
-    0x37, 0x36, 0x4C, 0x4C
-};
-
-#endif // IMAGE_DATA_H
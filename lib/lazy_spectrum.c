@@ -0,0 +1,67 @@
+#include "lazy_spectrum.h"
+#include "dtft.h"
+#include <string.h>
+
+bool lazy_spectrum_init(lazy_spectrum_t *spectrum, const uint8_t *samples, int pattern_len,
+                        int hold, int repetitions, int num_bins) {
+    if (hold < 1) hold = 1;
+    const int num_samples = (pattern_len + hold - 1) / hold;
+    if (num_samples > LAZY_SPECTRUM_MAX_SAMPLES || num_bins > LAZY_SPECTRUM_MAX_BINS || num_bins < 2) {
+        return false;
+    }
+
+    memcpy(spectrum->samples, samples, num_samples);
+    spectrum->pattern_len = pattern_len;
+    spectrum->hold = hold;
+    spectrum->repetitions = repetitions;
+    spectrum->num_bins = num_bins;
+    spectrum->scale = NULL;
+    spectrum->computed = 0;
+    spectrum->bins_computed = 0;
+    return true;
+}
+
+/**
+ * Evaluate and cache bin k if it has not been computed yet
+ */
+static void ensure_bin(lazy_spectrum_t *spectrum, int k) {
+    if (spectrum->computed & (1ull << k)) {
+        return;
+    }
+
+    float *value = &spectrum->values[2*k];
+    spectrum->computed |= 1ull << k;
+    if (spectrum->scale && spectrum->scale[2*k] == 0.0f && spectrum->scale[2*k + 1] == 0.0f) {
+        value[0] = 0.0f;
+        value[1] = 0.0f;
+        spectrum->magnitudes[k] = 0.0f;
+        return;
+    }
+
+    calculate_dtft_bin(spectrum->samples, spectrum->pattern_len, spectrum->hold,
+                       spectrum->repetitions, spectrum->num_bins, k, value);
+    if (spectrum->scale) {
+        const float re = value[0];
+        const float im = value[1];
+        const float sr = spectrum->scale[2*k];
+        const float si = spectrum->scale[2*k + 1];
+        value[0] = re * sr - im * si;
+        value[1] = re * si + im * sr;
+    }
+    spectrum->magnitudes[k] = value[0] * value[0] + value[1] * value[1];
+    spectrum->bins_computed++;
+}
+
+void lazy_spectrum_set_scale(lazy_spectrum_t *spectrum, const float *scale) {
+    spectrum->scale = scale;
+}
+
+const float* lazy_spectrum_value(lazy_spectrum_t *spectrum, int k) {
+    ensure_bin(spectrum, k);
+    return &spectrum->values[2*k];
+}
+
+float lazy_spectrum_magnitude(lazy_spectrum_t *spectrum, int k) {
+    ensure_bin(spectrum, k);
+    return spectrum->magnitudes[k];
+}
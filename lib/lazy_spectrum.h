@@ -0,0 +1,58 @@
+#ifndef LAZY_SPECTRUM_H
+#define LAZY_SPECTRUM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pull-based DTFT: bins of a (sample-and-hold, repeated) pattern are computed
+// the first time they are requested and cached, so a matcher that settles
+// early never pays for the remaining bins.
+#define LAZY_SPECTRUM_MAX_BINS 64
+#define LAZY_SPECTRUM_MAX_SAMPLES 16
+
+typedef struct {
+    uint8_t samples[LAZY_SPECTRUM_MAX_SAMPLES];
+    int pattern_len;
+    int hold;
+    int repetitions;
+    int num_bins;
+    const float *scale;      // [re, im] factor per bin, or NULL
+    uint64_t computed;       // Bit k set once bin k is cached
+    int bins_computed;
+    float values[LAZY_SPECTRUM_MAX_BINS * 2];    // [real, imag] per bin
+    float magnitudes[LAZY_SPECTRUM_MAX_BINS];    // Squared magnitude per bin
+} lazy_spectrum_t;
+
+/**
+ * Set up a lazy spectrum; no bins are computed yet
+ * @param spectrum Spectrum to initialize
+ * @param samples Sampled bits (ceil(pattern_len / hold) values)
+ * @param pattern_len Samples per period after the hold
+ * @param hold Samples each sampled bit is held for (1 = no hold)
+ * @param repetitions Number of periods in the transformed signal
+ * @param num_bins Number of frequency points from 0 to π
+ * @return false if the sizes exceed the LAZY_SPECTRUM_MAX_* limits
+ */
+bool lazy_spectrum_init(lazy_spectrum_t *spectrum, const uint8_t *samples, int pattern_len,
+                        int hold, int repetitions, int num_bins);
+
+/**
+ * Multiply each bin by a complex factor as it is computed (e.g. to rescale
+ * the repetition gain); bins whose factor is zero are never transformed
+ * @param spectrum Spectrum from lazy_spectrum_init(), before any bin is requested
+ * @param scale [real, imag] per bin (num_bins * 2 floats, kept by reference), or NULL
+ */
+void lazy_spectrum_set_scale(lazy_spectrum_t *spectrum, const float *scale);
+
+/**
+ * Complex value of bin k, computed on first use
+ * @return Pointer to [real, imag]
+ */
+const float* lazy_spectrum_value(lazy_spectrum_t *spectrum, int k);
+
+/**
+ * Squared magnitude of bin k, computed on first use
+ */
+float lazy_spectrum_magnitude(lazy_spectrum_t *spectrum, int k);
+
+#endif // LAZY_SPECTRUM_H
@@ -0,0 +1,222 @@
+#include "link_adapt.h"
+#include "gpio_control.h"
+#include "pico/stdlib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// Probe set: constant, alternating, half-period and irregular patterns with
+// their complements, so every sampling phase and transition density is covered
+static const uint8_t probe_patterns[] = {0x55, 0xAA, 0x4C, 0xB3, 0x33, 0xCC, 0x69, 0x96,
+                                         0x0F, 0xF0, 0x5A, 0xA5, 0x3C, 0xC3, 0x00, 0xFF};
+#define NUM_PROBE_PATTERNS (sizeof(probe_patterns) / sizeof(probe_patterns[0]))
+
+bool link_adapt_init(link_adapt_t *adapt, const link_adapt_config_t *config) {
+    memset(adapt, 0, sizeof(*adapt));
+    if (config->num_periods < 1 || config->num_periods > LINK_ADAPT_MAX_STEPS ||
+        config->num_divisors < 1 || config->num_divisors > LINK_ADAPT_MAX_STEPS ||
+        config->probes < 1 || config->interval_rows < 1) {
+        printf("Error: invalid link adaptation config\n");
+        return false;
+    }
+    for (int i = 0; i < config->num_divisors; i++) {
+        if (config->divisors[i] < 1) {
+            printf("Error: sampling divisors must be at least 1\n");
+            return false;
+        }
+    }
+    adapt->config = *config;
+    set_bit_period_us(config->periods_us[0]);
+    return true;
+}
+
+/**
+ * Send the probe patterns with one setting and add them to its history
+ * @param bound Output: mean absolute error (pixel levels) of the history plus
+ *              LINK_ADAPT_CONFIDENCE_Z standard errors; the setting meets a
+ *              target if this does
+ * @param pixel_us Output: average transfer time per pixel
+ */
+static void probe_setting(link_adapt_t *adapt, uint32_t row, int period_index, int divisor_index,
+                          link_adapt_transfer_fn transfer, void *ctx, float *bound, float *pixel_us) {
+    const link_adapt_config_t *config = &adapt->config;
+    const uint32_t period = config->periods_us[period_index];
+    const int divisor = config->divisors[divisor_index];
+
+    set_bit_period_us(period);
+    absolute_time_t start_time = get_absolute_time();
+    uint32_t abs_error = 0;
+    uint64_t squared_error = 0;
+    for (int p = 0; p < config->probes; p++) {
+        uint8_t value = probe_patterns[p % NUM_PROBE_PATTERNS];
+        uint32_t error = abs((int)transfer(value, divisor, ctx) - value);
+        abs_error += error;
+        squared_error += error * error;
+    }
+    int64_t elapsed = absolute_time_diff_us(start_time, get_absolute_time());
+
+    // Errors are mostly 0 with rare large ones, so one round of probes is
+    // often error-free at a marginal setting; the history and the bound keep
+    // such a round from passing it
+    link_adapt_history_t *history = &adapt->history[period_index][divisor_index];
+    history->weight += config->probes;
+    history->error_sum += abs_error;
+    history->squared_sum += squared_error;
+    const float n = history->weight;
+    const float error = history->error_sum / n;
+    const float variance = n > 1.0f ? (history->squared_sum - n * error * error) / (n - 1.0f) : 0.0f;
+    *bound = error + LINK_ADAPT_CONFIDENCE_Z * sqrtf(fmaxf(variance, 0.0f) / n);
+    *pixel_us = (float)elapsed / config->probes;
+    adapt->probe_transfers += config->probes;
+    adapt->probe_time_us += elapsed;
+
+    printf("ADAPT_PROBE ROW=%lu PERIOD_US=%lu DIVISOR=%d ERROR=%.2f BOUND=%.2f PIXEL_US=%.1f\n",
+           (unsigned long)row, (unsigned long)period, divisor, error, *bound, *pixel_us);
+}
+
+int link_adapt_row(link_adapt_t *adapt, uint32_t row, link_adapt_transfer_fn transfer, void *ctx) {
+    const link_adapt_config_t *config = &adapt->config;
+    adapt->rows++;
+    if (row % config->interval_rows != 0) {
+        return config->divisors[adapt->divisor_index];
+    }
+    adapt->probe_rounds++;
+    for (int p = 0; p < config->num_periods; p++) {
+        for (int d = 0; d < config->num_divisors; d++) {
+            link_adapt_history_t *history = &adapt->history[p][d];
+            history->weight *= LINK_ADAPT_HISTORY_DECAY;
+            history->error_sum *= LINK_ADAPT_HISTORY_DECAY;
+            history->squared_sum *= LINK_ADAPT_HISTORY_DECAY;
+        }
+    }
+
+    const int current_period = adapt->period_index;
+    const int current_divisor = adapt->divisor_index;
+    float bound;
+    float pixel_us;
+    probe_setting(adapt, row, current_period, current_divisor, transfer, ctx, &bound, &pixel_us);
+    const bool current_ok = bound <= config->error_target;
+
+    // Neighbours: one step faster on either ladder, or one step slower if the target was missed
+    int candidates[2][2];
+    int num_candidates = 0;
+    const int step = current_ok ? 1 : -1;
+    if (current_period + step >= 0 && current_period + step < config->num_periods) {
+        candidates[num_candidates][0] = current_period + step;
+        candidates[num_candidates][1] = current_divisor;
+        num_candidates++;
+    }
+    if (current_divisor + step >= 0 && current_divisor + step < config->num_divisors) {
+        candidates[num_candidates][0] = current_period;
+        candidates[num_candidates][1] = current_divisor + step;
+        num_candidates++;
+    }
+
+    // Fastest setting under the target. Over the target the current setting is
+    // never kept: the lowest-error slower neighbour is taken if none meets it,
+    // so a missed target always backs off, down to the slowest setting
+    int best_period = current_period;
+    int best_divisor = current_divisor;
+    float best_us = current_ok ? pixel_us : INFINITY;
+    float lowest_bound = INFINITY;
+    int lowest_period = current_period;
+    int lowest_divisor = current_divisor;
+    for (int c = 0; c < num_candidates; c++) {
+        float candidate_bound;
+        float candidate_us;
+        probe_setting(adapt, row, candidates[c][0], candidates[c][1], transfer, ctx,
+                      &candidate_bound, &candidate_us);
+        const float limit = current_ok ? config->error_target * LINK_ADAPT_UPGRADE_MARGIN
+                                       : config->error_target;
+        if (candidate_bound <= limit && candidate_us < best_us) {
+            best_us = candidate_us;
+            best_period = candidates[c][0];
+            best_divisor = candidates[c][1];
+        }
+        if (candidate_bound < lowest_bound) {
+            lowest_bound = candidate_bound;
+            lowest_period = candidates[c][0];
+            lowest_divisor = candidates[c][1];
+        }
+    }
+
+    const char *reason;
+    if (best_us == INFINITY) {
+        best_period = lowest_period;
+        best_divisor = lowest_divisor;
+        reason = num_candidates > 0 ? "over_target_slower" : "over_target_slowest";
+    } else if (best_period == current_period && best_divisor == current_divisor) {
+        reason = "keep";
+    } else {
+        reason = current_ok ? "faster" : "slower";
+    }
+
+    if (best_period != current_period || best_divisor != current_divisor) {
+        adapt->changes++;
+    }
+    adapt->period_index = best_period;
+    adapt->divisor_index = best_divisor;
+    set_bit_period_us(config->periods_us[best_period]);
+
+    printf("ADAPT_DECISION ROW=%lu PERIOD_US=%lu DIVISOR=%d REASON=%s\n",
+           (unsigned long)row, (unsigned long)config->periods_us[best_period],
+           config->divisors[best_divisor], reason);
+    return config->divisors[best_divisor];
+}
+
+uint32_t link_adapt_image(link_adapt_t *adapt, image_reader_t *reader, uint32_t num_pixels,
+                          link_adapt_transfer_fn transfer, void *ctx, uint8_t *reconstructed,
+                          link_adapt_image_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    const uint32_t width = reader->header.width;
+    absolute_time_t start_time = get_absolute_time();
+    int divisor = adapt->config.divisors[adapt->divisor_index];
+
+    uint32_t i;
+    for (i = 0; i < num_pixels; i++) {
+        if (i % width == 0) {
+            divisor = link_adapt_row(adapt, i / width, transfer, ctx);
+            stats->rows_per_period[adapt->period_index]++;
+            stats->rows_per_divisor[adapt->divisor_index]++;
+        }
+
+        uint8_t value;
+        if (image_reader_read(reader, &value, 1) != 1) {
+            break;
+        }
+        reconstructed[i] = transfer(value, divisor, ctx);
+        stats->correct += reconstructed[i] == value;
+        stats->abs_error += abs((int)reconstructed[i] - value);
+    }
+
+    stats->pixels = i;
+    stats->time_us = absolute_time_diff_us(start_time, get_absolute_time());
+    return i;
+}
+
+void link_adapt_print_stats(const link_adapt_t *adapt, const link_adapt_image_stats_t *stats) {
+    const link_adapt_config_t *config = &adapt->config;
+    float seconds = stats->time_us / 1000000.0f;
+
+    printf("Pixels: %lu, correct: %lu (%.2f%%), mean abs error: %.2f\n",
+           (unsigned long)stats->pixels, (unsigned long)stats->correct,
+           stats->pixels > 0 ? 100.0f * stats->correct / stats->pixels : 0.0f,
+           stats->pixels > 0 ? (float)stats->abs_error / stats->pixels : 0.0f);
+    printf("Time: %.2f s, %.1f pixels/s, goodput %.1f correct pixels/s\n", seconds,
+           seconds > 0 ? stats->pixels / seconds : 0.0f,
+           seconds > 0 ? stats->correct / seconds : 0.0f);
+    printf("Probe rounds: %lu, probe transfers: %lu (%.1f%% of time), setting changes: %lu\n",
+           (unsigned long)adapt->probe_rounds, (unsigned long)adapt->probe_transfers,
+           stats->time_us > 0 ? 100.0f * adapt->probe_time_us / stats->time_us : 0.0f,
+           (unsigned long)adapt->changes);
+    printf("Rows per bit period:");
+    for (int p = 0; p < config->num_periods; p++) {
+        printf(" %luus=%lu", (unsigned long)config->periods_us[p], (unsigned long)stats->rows_per_period[p]);
+    }
+    printf("\nRows per divisor:");
+    for (int d = 0; d < config->num_divisors; d++) {
+        printf(" 1/%d=%lu", config->divisors[d], (unsigned long)stats->rows_per_divisor[d]);
+    }
+    printf("\n");
+}
@@ -0,0 +1,110 @@
+#ifndef LINK_ADAPT_H
+#define LINK_ADAPT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "image_asset.h"
+
+// Closed-loop bit period / sampling divisor controller. Before a row (every
+// interval_rows rows) known probe patterns are sent with the current setting
+// and its neighbours on the period and divisor ladders; the fastest setting
+// whose mean absolute probe error stays under the target is used for the row.
+// Errors are rare but large, so each setting keeps its probe history, weighted
+// down by LINK_ADAPT_HISTORY_DECAY per round, and its error counts as the mean
+// plus LINK_ADAPT_CONFIDENCE_Z standard errors of that history. A faster
+// setting must beat the target by LINK_ADAPT_UPGRADE_MARGIN to be taken
+// (hysteresis against probe noise). If the current setting misses the target
+// the controller steps to a slower neighbour, the fastest one under the target
+// or else the one with the lowest error, until the slowest setting.
+// Every probe and decision is logged (ADAPT_PROBE / ADAPT_DECISION lines).
+#define LINK_ADAPT_MAX_STEPS 8
+#define LINK_ADAPT_UPGRADE_MARGIN 0.5f
+#define LINK_ADAPT_CONFIDENCE_Z 1.0f
+#define LINK_ADAPT_HISTORY_DECAY 0.75f
+
+/**
+ * Send one pixel and decode it with the given sampling divisor
+ * (the bit period is already set with set_bit_period_us())
+ */
+typedef uint8_t (*link_adapt_transfer_fn)(uint8_t value, int sample_divisor, void *ctx);
+
+typedef struct {
+    uint32_t periods_us[LINK_ADAPT_MAX_STEPS];  // Bit periods, slowest first
+    int num_periods;
+    uint8_t divisors[LINK_ADAPT_MAX_STEPS];     // Sampling divisors, full rate (1) first
+    int num_divisors;
+    float error_target;      // Max mean absolute probe error (pixel levels)
+    int probes;              // Probe patterns per setting
+    int interval_rows;       // Rows between probe rounds
+} link_adapt_config_t;
+
+// Decayed probe errors of one setting
+typedef struct {
+    float weight;            // Probes
+    float error_sum;
+    float squared_sum;
+} link_adapt_history_t;
+
+typedef struct {
+    link_adapt_config_t config;
+    int period_index;
+    int divisor_index;
+    link_adapt_history_t history[LINK_ADAPT_MAX_STEPS][LINK_ADAPT_MAX_STEPS];  // [period][divisor]
+    // Stats
+    uint32_t rows;
+    uint32_t probe_rounds;
+    uint32_t probe_transfers;
+    uint32_t changes;
+    int64_t probe_time_us;
+} link_adapt_t;
+
+typedef struct {
+    uint32_t pixels;
+    uint32_t correct;
+    uint64_t abs_error;
+    int64_t time_us;         // Including probes
+    uint32_t rows_per_period[LINK_ADAPT_MAX_STEPS];
+    uint32_t rows_per_divisor[LINK_ADAPT_MAX_STEPS];
+} link_adapt_image_stats_t;
+
+/**
+ * Initialize a controller at the slowest period and full sampling rate
+ * @param adapt Controller state
+ * @param config Ladders, error target and probe schedule
+ * @return false on invalid configuration
+ */
+bool link_adapt_init(link_adapt_t *adapt, const link_adapt_config_t *config);
+
+/**
+ * Probe if a round is due and apply the chosen setting (bit period set via set_bit_period_us())
+ * @param adapt Controller state
+ * @param row Row about to be sent (for the log)
+ * @param transfer Pixel transfer used for the probes
+ * @param ctx Passed to transfer
+ * @return Sampling divisor to use for the row
+ */
+int link_adapt_row(link_adapt_t *adapt, uint32_t row, link_adapt_transfer_fn transfer, void *ctx);
+
+/**
+ * Transmit and reconstruct the first num_pixels of an image, adapting per row
+ * @param adapt Initialized controller
+ * @param reader Open reader positioned at the first pixel
+ * @param num_pixels Pixels to process
+ * @param transfer Pixel transfer
+ * @param ctx Passed to transfer
+ * @param reconstructed Output: num_pixels decoded values
+ * @param stats Output: accuracy, time and setting histogram
+ * @return Pixels processed
+ */
+uint32_t link_adapt_image(link_adapt_t *adapt, image_reader_t *reader, uint32_t num_pixels,
+                          link_adapt_transfer_fn transfer, void *ctx, uint8_t *reconstructed,
+                          link_adapt_image_stats_t *stats);
+
+/**
+ * Print controller and image statistics
+ * @param adapt Controller state
+ * @param stats Statistics from link_adapt_image()
+ */
+void link_adapt_print_stats(const link_adapt_t *adapt, const link_adapt_image_stats_t *stats);
+
+#endif // LINK_ADAPT_H
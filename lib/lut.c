@@ -6,9 +6,22 @@ float sin_lut[LUT_SIZE] __attribute__((aligned(8)));
 float cos_lut[LUT_SIZE] __attribute__((aligned(8)));
 
 void init_trig_lut(void) {
-    for (int i = 0; i < LUT_SIZE; i++) {
+    // One quarter wave of sinf() (LUT_SIZE / 4 + 1 calls); the rest of both
+    // tables follows by symmetry, which keeps it on the startup path cheap
+    const int quarter = LUT_SIZE / 4;
+    for (int i = 0; i <= quarter; i++) {
         float angle = (2.0f * M_PI * i) / LUT_SIZE;
         sin_lut[i] = sinf(angle);
-        cos_lut[i] = cosf(angle);
+    }
+    sin_lut[0] = 0.0f;
+    sin_lut[quarter] = 1.0f;
+    for (int i = 1; i < quarter; i++) {
+        sin_lut[2 * quarter - i] = sin_lut[i];
+    }
+    for (int i = 0; i < 2 * quarter; i++) {
+        sin_lut[2 * quarter + i] = -sin_lut[i];
+    }
+    for (int i = 0; i < LUT_SIZE; i++) {
+        cos_lut[i] = sin_lut[(i + quarter) & LUT_MASK];
     }
 }
@@ -0,0 +1,233 @@
+#include "mem_stats.h"
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include <malloc.h>
+#include <stdio.h>
+#include <string.h>
+
+// Stack regions from the SDK linker script; host builds (PICO_ON_DEVICE=0,
+// host/sim) watermark below the painting frame instead
+#if !defined(PICO_ON_DEVICE) || PICO_ON_DEVICE
+#define MEM_STACK_FROM_LINKER 1
+extern uint32_t __StackBottom, __StackTop, __StackOneBottom, __StackOneTop;
+#else
+#define MEM_STACK_FROM_LINKER 0
+#endif
+
+// Words left unpainted below mem_stack_paint()'s own frame
+#define MEM_STACK_PAINT_MARGIN 64
+#define MEM_STATS_PRINT_SITES 8
+
+static atomic_uint allocations;
+static atomic_uint frees;
+static atomic_uint failures;
+static atomic_uint bytes_requested;
+static atomic_uint live_blocks;
+static atomic_uint live_bytes;
+static atomic_uint peak_bytes;
+static _Atomic(mem_site_t *) sites;
+
+static uint32_t *stack_bottom[2];
+static uint32_t *stack_top[2];
+#if !MEM_STACK_FROM_LINKER
+// Host: the unpainted words below the painting frame as mem_stack_paint() left
+// them; a later call that overwrites one has gone that deep
+static uint32_t stack_margin[2][MEM_STACK_PAINT_MARGIN];
+#endif
+
+static void record_max(atomic_uint *max, uint32_t value) {
+    uint32_t current = atomic_load_explicit(max, memory_order_relaxed);
+    while (value > current &&
+           !atomic_compare_exchange_weak_explicit(max, &current, value, memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+    }
+}
+
+static void* record_allocation(void *ptr, size_t size, mem_site_t *site) {
+    if (!ptr) {
+        atomic_fetch_add_explicit(&failures, 1, memory_order_relaxed);
+        return NULL;
+    }
+    const uint32_t block = (uint32_t)malloc_usable_size(ptr);
+    atomic_fetch_add_explicit(&allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&bytes_requested, (uint32_t)size, memory_order_relaxed);
+    atomic_fetch_add_explicit(&live_blocks, 1, memory_order_relaxed);
+    record_max(&peak_bytes, atomic_fetch_add_explicit(&live_bytes, block, memory_order_relaxed) + block);
+
+    // First allocation from this site: push it on the site list
+    if (!atomic_exchange(&site->registered, true)) {
+        site->next = atomic_load(&sites);
+        while (!atomic_compare_exchange_weak(&sites, &site->next, site)) {
+        }
+    }
+    atomic_fetch_add_explicit(&site->allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&site->bytes, (uint32_t)size, memory_order_relaxed);
+    record_max(&site->largest, (uint32_t)size);
+    return ptr;
+}
+
+void* mem_stats_malloc(size_t size, mem_site_t *site) {
+    return record_allocation(malloc(size), size, site);
+}
+
+void* mem_stats_calloc(size_t count, size_t size, mem_site_t *site) {
+    return record_allocation(calloc(count, size), count * size, site);
+}
+
+void mem_stats_free(void *ptr) {
+    if (!ptr) {
+        return;
+    }
+    atomic_fetch_add_explicit(&frees, 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&live_blocks, 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&live_bytes, (uint32_t)malloc_usable_size(ptr), memory_order_relaxed);
+    free(ptr);
+}
+
+void mem_stats_get_heap(mem_heap_stats_t *stats) {
+    stats->allocations = atomic_load(&allocations);
+    stats->frees = atomic_load(&frees);
+    stats->failures = atomic_load(&failures);
+    stats->bytes_requested = atomic_load(&bytes_requested);
+    stats->live_blocks = atomic_load(&live_blocks);
+    stats->live_bytes = atomic_load(&live_bytes);
+    stats->peak_bytes = atomic_load(&peak_bytes);
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    struct mallinfo2 info = mallinfo2();
+#else
+    struct mallinfo info = mallinfo();
+#endif
+    stats->arena_bytes = (uint32_t)(info.arena + info.hblkhd);
+}
+
+int mem_stats_get_sites(mem_site_stats_t *out, int max_sites) {
+    int count = 0;
+    for (mem_site_t *site = atomic_load(&sites); site; site = site->next) {
+        mem_site_stats_t entry = {
+            .file = site->file,
+            .line = site->line,
+            .allocations = atomic_load(&site->allocations),
+            .bytes = atomic_load(&site->bytes),
+            .largest = atomic_load(&site->largest),
+        };
+        if (entry.allocations == 0) {
+            continue;
+        }
+
+        // Insert in order of bytes, dropping the smallest once out[] is full
+        int i = count < max_sites ? count++ : max_sites;
+        while (i > 0 && out[i - 1].bytes < entry.bytes) {
+            if (i < max_sites) {
+                out[i] = out[i - 1];
+            }
+            i--;
+        }
+        if (i < max_sites) {
+            out[i] = entry;
+        }
+    }
+    return count;
+}
+
+void mem_stats_reset(void) {
+    atomic_store(&allocations, 0);
+    atomic_store(&frees, 0);
+    atomic_store(&failures, 0);
+    atomic_store(&bytes_requested, 0);
+    atomic_store(&peak_bytes, atomic_load(&live_bytes));
+    for (mem_site_t *site = atomic_load(&sites); site; site = site->next) {
+        atomic_store(&site->allocations, 0);
+        atomic_store(&site->bytes, 0);
+        atomic_store(&site->largest, 0);
+    }
+}
+
+void mem_stats_print(void) {
+    // Stacks first, before printing deepens this one
+    mem_stack_stats_t stacks[2];
+    bool painted[2];
+    for (int core = 0; core < 2; core++) {
+        painted[core] = mem_stack_get(core, &stacks[core]);
+    }
+
+    mem_heap_stats_t heap;
+    mem_stats_get_heap(&heap);
+    printf("Heap: %lu allocations (%lu failed), %lu frees, %lu bytes requested\n",
+           (unsigned long)heap.allocations, (unsigned long)heap.failures, (unsigned long)heap.frees,
+           (unsigned long)heap.bytes_requested);
+    printf("Heap: %lu blocks / %lu bytes live, peak %lu bytes, allocator arena %lu bytes\n",
+           (unsigned long)heap.live_blocks, (unsigned long)heap.live_bytes,
+           (unsigned long)heap.peak_bytes, (unsigned long)heap.arena_bytes);
+
+    mem_site_stats_t top[MEM_STATS_PRINT_SITES];
+    int num_sites = mem_stats_get_sites(top, MEM_STATS_PRINT_SITES);
+    for (int i = 0; i < num_sites && i < MEM_STATS_PRINT_SITES; i++) {
+        const char *name = strrchr(top[i].file, '/');
+        printf("  %s:%d  %lu allocations, %lu bytes, largest %lu\n", name ? name + 1 : top[i].file,
+               top[i].line, (unsigned long)top[i].allocations, (unsigned long)top[i].bytes,
+               (unsigned long)top[i].largest);
+    }
+
+    for (int core = 0; core < 2; core++) {
+        if (painted[core]) {
+            printf("Stack Core%d: %lu of %lu bytes used\n", core, (unsigned long)stacks[core].used,
+                   (unsigned long)stacks[core].size);
+        }
+    }
+}
+
+void __attribute__((noinline)) mem_stack_paint(void) {
+    const unsigned int core = get_core_num() & 1;
+    volatile uint32_t here = 0;
+    const uintptr_t frame = (uintptr_t)&here & ~(uintptr_t)3;
+    uint32_t *end = (uint32_t *)(frame - MEM_STACK_PAINT_MARGIN * sizeof(uint32_t));
+#if MEM_STACK_FROM_LINKER
+    uint32_t *bottom = core ? &__StackOneBottom : &__StackBottom;
+    uint32_t *top = core ? &__StackOneTop : &__StackTop;
+#else
+    uint32_t *bottom = (uint32_t *)(frame - MEM_STACK_HOST_BYTES);
+    uint32_t *top = (uint32_t *)frame;
+#endif
+
+    // Volatile stores, so the loop is not turned into a memset() call whose
+    // own frame would sit in the painted range
+    for (volatile uint32_t *word = bottom; word < end; word++) {
+        *word = MEM_STACK_PATTERN;
+    }
+#if !MEM_STACK_FROM_LINKER
+    for (int i = 0; i < MEM_STACK_PAINT_MARGIN; i++) {
+        stack_margin[core][i] = ((volatile uint32_t *)end)[i];
+    }
+#endif
+    stack_bottom[core] = bottom;
+    stack_top[core] = top;
+    (void)here;
+}
+
+bool mem_stack_get(int core, mem_stack_stats_t *stats) {
+    if (core < 0 || core > 1 || !stack_bottom[core]) {
+        return false;
+    }
+    const volatile uint32_t *word = stack_bottom[core];
+#if MEM_STACK_FROM_LINKER
+    while (word < stack_top[core] && *word == MEM_STACK_PATTERN) {
+        word++;
+    }
+#else
+    // Depth from the painting frame: the painted words, then the margin
+    const volatile uint32_t *margin = stack_top[core] - MEM_STACK_PAINT_MARGIN;
+    while (word < margin && *word == MEM_STACK_PATTERN) {
+        word++;
+    }
+    if (word == margin) {
+        int i = 0;
+        while (i < MEM_STACK_PAINT_MARGIN && margin[i] == stack_margin[core][i]) {
+            i++;
+        }
+        word = margin + i;
+    }
+#endif
+    stats->size = (uint32_t)((stack_top[core] - stack_bottom[core]) * sizeof(uint32_t));
+    stats->used = (uint32_t)((stack_top[core] - word) * sizeof(uint32_t));
+    return true;
+}
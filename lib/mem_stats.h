@@ -0,0 +1,123 @@
+#ifndef MEM_STATS_H
+#define MEM_STATS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+// Heap and stack footprint instrumentation
+//
+// lib/ allocates through MEM_MALLOC(), MEM_CALLOC() and MEM_FREE(), and
+// buffers a lib/ function returns are freed with MEM_FREE(). With MEM_STATS
+// set each call site keeps a static record of its allocations, and the totals
+// track live and peak bytes in the allocator's block sizes
+// (malloc_usable_size()). Counters are atomic, so both cores may allocate.
+// Without MEM_STATS the macros are plain malloc(), calloc() and free().
+//
+// Stacks are watermarked: mem_stack_paint() fills the unused part of the
+// calling core's stack with a pattern, and mem_stack_get() finds the deepest
+// word overwritten since. On the Pico the region is the core's whole stack
+// from the linker script; in the host simulator, which has no fixed stacks,
+// it is MEM_STACK_HOST_BYTES below the frame that painted it, and the depth
+// is counted from there. The words just below that frame hold the painter's
+// own frame and are not painted; a copy of them taken by mem_stack_paint()
+// shows which a later call overwrote.
+#ifndef MEM_STATS
+#define MEM_STATS 0
+#endif
+
+#define MEM_STACK_HOST_BYTES (64 * 1024)
+#define MEM_STACK_PATTERN 0x5AC3A55Cu
+
+// Static record of one MEM_MALLOC() / MEM_CALLOC() call site
+typedef struct mem_site {
+    const char *file;
+    int line;
+    atomic_uint allocations;
+    atomic_uint bytes;          // Requested, summed over every allocation
+    atomic_uint largest;        // Largest single request
+    atomic_bool registered;
+    struct mem_site *next;
+} mem_site_t;
+
+void* mem_stats_malloc(size_t size, mem_site_t *site);
+void* mem_stats_calloc(size_t count, size_t size, mem_site_t *site);
+void mem_stats_free(void *ptr);
+
+#if MEM_STATS
+#define MEM_MALLOC(size) \
+    ({ static mem_site_t mem_site_ = {.file = __FILE__, .line = __LINE__}; \
+       mem_stats_malloc((size), &mem_site_); })
+#define MEM_CALLOC(count, size) \
+    ({ static mem_site_t mem_site_ = {.file = __FILE__, .line = __LINE__}; \
+       mem_stats_calloc((count), (size), &mem_site_); })
+#define MEM_FREE(ptr) mem_stats_free(ptr)
+#else
+#define MEM_MALLOC(size) malloc(size)
+#define MEM_CALLOC(count, size) calloc((count), (size))
+#define MEM_FREE(ptr) free(ptr)
+#endif
+
+typedef struct {
+    uint32_t allocations;       // Successful MEM_MALLOC() / MEM_CALLOC() calls
+    uint32_t frees;             // MEM_FREE() calls on non-NULL pointers
+    uint32_t failures;          // Allocations that returned NULL
+    uint32_t bytes_requested;   // Summed over every allocation (wraps at 4 GB)
+    uint32_t live_blocks;
+    uint32_t live_bytes;        // Block sizes of the live allocations
+    uint32_t peak_bytes;        // Most live bytes since the last reset
+    uint32_t arena_bytes;       // Heap the allocator holds for everything (mallinfo)
+} mem_heap_stats_t;
+
+typedef struct {
+    const char *file;
+    int line;
+    uint32_t allocations;
+    uint32_t bytes;
+    uint32_t largest;
+} mem_site_stats_t;
+
+typedef struct {
+    uint32_t size;              // Bytes watermarked
+    uint32_t used;              // Deepest use since the paint, in bytes
+} mem_stack_stats_t;
+
+/**
+ * Heap counters since the last reset (zero without MEM_STATS)
+ */
+void mem_stats_get_heap(mem_heap_stats_t *stats);
+
+/**
+ * Call sites that allocated since the last reset, most bytes first
+ * @param sites Output array
+ * @param max_sites Entries in sites
+ * @return Sites written
+ */
+int mem_stats_get_sites(mem_site_stats_t *sites, int max_sites);
+
+/**
+ * Reset the allocation counters and call sites; live blocks are kept and the
+ * peak restarts at the live bytes, so a stage can be measured on its own
+ */
+void mem_stats_reset(void);
+
+/**
+ * Print the heap counters, the top call sites and both cores' stack use
+ */
+void mem_stats_print(void);
+
+/**
+ * Watermark the unused part of the calling core's stack
+ * Call once per core at the start of its entry point (main(), the Core1 worker).
+ */
+void mem_stack_paint(void);
+
+/**
+ * Stack use of a core since its mem_stack_paint()
+ * @param core 0 or 1
+ * @return false if that core's stack was not painted
+ */
+bool mem_stack_get(int core, mem_stack_stats_t *stats);
+
+#endif // MEM_STATS_H
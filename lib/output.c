@@ -4,6 +4,12 @@
 
 void plot_dtft_spectrum(float *magnitudes, int num_points) {
     printf("\n========== DTFT SPECTRUM ==========\n");
+    if (num_points > OUTPUT_MAX_POINTS) {
+        num_points = OUTPUT_MAX_POINTS;
+    }
+    if (num_points <= 0) {
+        return;
+    }
     
     // Find max magnitude
     float max_magnitude = 0.0f;
@@ -20,7 +26,7 @@ void plot_dtft_spectrum(float *magnitudes, int num_points) {
     int max_height = 25;  // Maximum height for display
     
     // Convert to bar heights (0 to max_height for display)
-    int bar_heights[num_points];
+    int bar_heights[OUTPUT_MAX_POINTS];
     for (int k = 0; k < num_points; k++) {
         bar_heights[k] = (int)((magnitudes[k] / max_magnitude) * max_height);
     }
@@ -46,7 +52,7 @@ void plot_dtft_spectrum(float *magnitudes, int num_points) {
     
     // Print frequency labels at major intervals (aligned to column positions)
     // Labels at: 0, 0.25π, 0.5π, 0.75π, 1.0π (covering 0 to π)
-    char label_line[num_points + 1];
+    char label_line[OUTPUT_MAX_POINTS + 1];
     memset(label_line, ' ', num_points);
     label_line[num_points] = '\0';
     
@@ -1,10 +1,13 @@
 #ifndef OUTPUT_H
 #define OUTPUT_H
 
+#define OUTPUT_MAX_POINTS 256   // Widest spectrum plot_dtft_spectrum() draws
+
 /**
  * Plot DTFT spectrum in terminal with adaptive scaling
  * @param magnitudes Array of DTFT magnitudes
- * @param num_points Number of frequency points in the magnitudes array
+ * @param num_points Number of frequency points in the magnitudes array (the
+ *        first OUTPUT_MAX_POINTS are drawn)
  */
 void plot_dtft_spectrum(float *magnitudes, int num_points);
 
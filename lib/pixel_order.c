@@ -0,0 +1,162 @@
+#include "pixel_order.h"
+#include <stdio.h>
+
+// Adam7 passes: first column, first row, column step, row step
+static const uint8_t adam7_passes[7][4] = {
+    {0, 0, 8, 8}, {4, 0, 8, 8}, {0, 4, 4, 8}, {2, 0, 4, 4},
+    {0, 2, 2, 4}, {1, 0, 2, 2}, {0, 1, 1, 2},
+};
+
+static const char *const order_names[PIXEL_ORDER_COUNT] = {
+    "raster", "adam7", "mipmap", "zorder", "hilbert",
+};
+
+const char *pixel_order_name(int order) {
+    return order >= 0 && order < PIXEL_ORDER_COUNT ? order_names[order] : "unknown";
+}
+
+bool pixel_order_begin(pixel_order_iter_t *iter, int order, uint32_t width, uint32_t height) {
+    if (order < 0 || order >= PIXEL_ORDER_COUNT) {
+        printf("Error: unknown pixel order %d\n", order);
+        return false;
+    }
+    if (width == 0 || height == 0) {
+        printf("Error: empty image\n");
+        return false;
+    }
+
+    *iter = (pixel_order_iter_t){.order = order, .width = width, .height = height};
+    const uint32_t larger = width > height ? width : height;
+    iter->side = 1;
+    while (iter->side < larger) {
+        iter->side <<= 1;
+    }
+    // Coarsest mipmap grid: the largest power of two below the larger side
+    iter->step = iter->side > 1 ? iter->side >> 1 : 1;
+    if (order == PIXEL_ORDER_ADAM7) {
+        iter->x = adam7_passes[0][0];
+        iter->y = adam7_passes[0][1];
+    }
+    return true;
+}
+
+/**
+ * Morton decode: x from the even bits, y from the odd bits
+ */
+static void zorder_position(uint32_t index, uint32_t *x, uint32_t *y) {
+    uint32_t px = 0;
+    uint32_t py = 0;
+    for (int bit = 0; bit < 16; bit++) {
+        px |= ((index >> (2 * bit)) & 1) << bit;
+        py |= ((index >> (2 * bit + 1)) & 1) << bit;
+    }
+    *x = px;
+    *y = py;
+}
+
+/**
+ * Hilbert curve index to position on a side x side square (side a power of two)
+ */
+static void hilbert_position(uint32_t side, uint32_t index, uint32_t *x, uint32_t *y) {
+    uint32_t px = 0;
+    uint32_t py = 0;
+    uint32_t t = index;
+    for (uint32_t s = 1; s < side; s <<= 1) {
+        uint32_t rx = 1 & (t >> 1);
+        uint32_t ry = 1 & (t ^ rx);
+        if (ry == 0) {
+            if (rx == 1) {
+                px = s - 1 - px;
+                py = s - 1 - py;
+            }
+            uint32_t swap = px;
+            px = py;
+            py = swap;
+        }
+        px += s * rx;
+        py += s * ry;
+        t >>= 2;
+    }
+    *x = px;
+    *y = py;
+}
+
+bool pixel_order_next(pixel_order_iter_t *iter, uint32_t *x, uint32_t *y) {
+    switch (iter->order) {
+        case PIXEL_ORDER_RASTER:
+            if (iter->y >= iter->height) {
+                return false;
+            }
+            *x = iter->x;
+            *y = iter->y;
+            if (++iter->x == iter->width) {
+                iter->x = 0;
+                iter->y++;
+            }
+            return true;
+
+        case PIXEL_ORDER_ADAM7:
+            while (iter->pass < 7) {
+                const uint8_t *pass = adam7_passes[iter->pass];
+                if (iter->y >= iter->height) {
+                    if (++iter->pass < 7) {
+                        iter->x = adam7_passes[iter->pass][0];
+                        iter->y = adam7_passes[iter->pass][1];
+                    }
+                } else if (iter->x >= iter->width) {
+                    iter->x = pass[0];
+                    iter->y += pass[3];
+                } else {
+                    *x = iter->x;
+                    *y = iter->y;
+                    iter->x += pass[2];
+                    return true;
+                }
+            }
+            return false;
+
+        case PIXEL_ORDER_MIPMAP:
+            while (iter->step > 0) {
+                const uint32_t step = iter->step;
+                if (iter->y >= iter->height) {
+                    iter->step >>= 1;
+                    iter->x = 0;
+                    iter->y = 0;
+                } else if (iter->x >= iter->width) {
+                    iter->x = 0;
+                    iter->y += step;
+                } else {
+                    const uint32_t px = iter->x;
+                    const uint32_t py = iter->y;
+                    iter->x += step;
+                    // Points on the coarser grid were sent by an earlier level
+                    const bool coarse_start = step == (iter->side > 1 ? iter->side >> 1 : 1);
+                    if (coarse_start || (px & step) || (py & step)) {
+                        *x = px;
+                        *y = py;
+                        return true;
+                    }
+                }
+            }
+            return false;
+
+        default:
+            // ZORDER and HILBERT: walk the curve, skipping positions outside the image
+            while (iter->curve_index < iter->side * iter->side) {
+                uint32_t px;
+                uint32_t py;
+                if (iter->order == PIXEL_ORDER_ZORDER) {
+                    zorder_position(iter->curve_index, &px, &py);
+                } else {
+                    hilbert_position(iter->side, iter->curve_index, &px, &py);
+                }
+                iter->curve_index++;
+                if (px < iter->width && py < iter->height) {
+                    *x = px;
+                    *y = py;
+                    return true;
+                }
+            }
+            return false;
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef PIXEL_ORDER_H
+#define PIXEL_ORDER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pixel transmission orders. The sender walks the image in one of these orders
+// and the reconstructor maps the n-th received pixel back to (x, y) with the
+// same iterator; pixel_order.py implements the same mappings for host tools.
+//
+// Progressive orders give a full-frame preview early:
+//   ADAM7   PNG interlace passes over 8x8 blocks: 1/64 of the pixels, then 1/64,
+//           1/32, 1/16, 1/8, 1/4 and the remaining 1/2, each pass in raster order
+//   MIPMAP  power-of-two levels, coarse to fine: the pixels on a grid of step S
+//           (the largest power of two below the larger side), then those on the
+//           S/2 grid not sent yet, down to step 1
+// Locality orders keep consecutive pixels close together (no early preview):
+//   ZORDER  Morton curve over the enclosing power-of-two square
+//   HILBERT Hilbert curve over the enclosing power-of-two square
+// Curve positions outside the image are skipped.
+#define PIXEL_ORDER_RASTER 0
+#define PIXEL_ORDER_ADAM7 1
+#define PIXEL_ORDER_MIPMAP 2
+#define PIXEL_ORDER_ZORDER 3
+#define PIXEL_ORDER_HILBERT 4
+#define PIXEL_ORDER_COUNT 5
+
+typedef struct {
+    int order;
+    uint32_t width;
+    uint32_t height;
+    uint32_t x;             // Next position (raster, ADAM7, MIPMAP)
+    uint32_t y;
+    uint32_t pass;          // ADAM7 pass
+    uint32_t step;          // MIPMAP grid step
+    uint32_t side;          // Curve square side (ZORDER, HILBERT)
+    uint32_t curve_index;   // Next curve position
+} pixel_order_iter_t;
+
+/**
+ * Start walking an image in an order
+ * @param iter Iterator to initialize
+ * @param order PIXEL_ORDER_*
+ * @param width Image width
+ * @param height Image height
+ * @return false on an unknown order or empty image
+ */
+bool pixel_order_begin(pixel_order_iter_t *iter, int order, uint32_t width, uint32_t height);
+
+/**
+ * Next pixel position; every pixel is visited exactly once
+ * @param iter Iterator
+ * @param x Output: column
+ * @param y Output: row
+ * @return false once every pixel has been visited
+ */
+bool pixel_order_next(pixel_order_iter_t *iter, uint32_t *x, uint32_t *y);
+
+/**
+ * Name of an order as printed in logs and accepted by pixel_order.py
+ */
+const char *pixel_order_name(int order);
+
+#endif // PIXEL_ORDER_H
@@ -0,0 +1,49 @@
+#ifndef PT_H
+#define PT_H
+
+#include <stdint.h>
+
+// Protothreads: stackless coroutines built on a switch statement. A thread is
+// a function returning one of the PT_ states; it resumes at its last wait or
+// yield on the next call. Locals do not survive a wait, so keep the thread's
+// state in its context struct. No switch statements inside a thread body.
+
+typedef struct {
+    uint16_t lc;    // Resume point (source line), 0 = start
+} pt_t;
+
+#define PT_WAITING 0    // Blocked on a condition, did no work
+#define PT_YIELDED 1    // Did some work, more to come
+#define PT_ENDED   2    // Finished (restarts from the top on the next call)
+
+// The case labels below are reached both by falling through and by resuming
+#if defined(__GNUC__) && __GNUC__ >= 7
+#define PT_FALLTHROUGH __attribute__((fallthrough))
+#else
+#define PT_FALLTHROUGH ((void)0)
+#endif
+
+#define PT_INIT(pt) ((pt)->lc = 0)
+
+#define PT_BEGIN(pt) { char pt_yield_flag = 1; (void)pt_yield_flag; switch ((pt)->lc) { case 0:
+
+#define PT_END(pt) } PT_INIT(pt); return PT_ENDED; }
+
+// Return PT_WAITING until cond holds
+#define PT_WAIT_UNTIL(pt, cond)             \
+    do {                                    \
+        (pt)->lc = __LINE__; PT_FALLTHROUGH; \
+        case __LINE__:                      \
+        if (!(cond)) return PT_WAITING;     \
+    } while (0)
+
+// Give the scheduler a chance to run other threads
+#define PT_YIELD(pt)                            \
+    do {                                        \
+        pt_yield_flag = 0;                      \
+        (pt)->lc = __LINE__; PT_FALLTHROUGH;    \
+        case __LINE__:                          \
+        if (!pt_yield_flag) return PT_YIELDED;  \
+    } while (0)
+
+#endif // PT_H
@@ -0,0 +1,68 @@
+#include "receiver.h"
+#include "signal.h"
+#include "mem_stats.h"
+#include "pico/stdlib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool receiver_set_init(receiver_set_t *set, int num_channels, uint8_t sample_divisor) {
+    if (num_channels < 1 || num_channels > MAX_RECEIVERS || num_channels > SIGNAL_MAX_BATCH) {
+        printf("Error: receiver count must be between 1 and %d\n", MAX_RECEIVERS);
+        return false;
+    }
+
+    memset(set, 0, sizeof(*set));
+    set->num_channels = num_channels;
+    set->sample_divisor = sample_divisor;
+    for (int c = 0; c < num_channels; c++) {
+        set->channels[c].gpio = receiver_gpios[c];
+    }
+
+    init_receiver_gpios(num_channels);
+    return true;
+}
+
+bool receiver_set_transfer(receiver_set_t *set, uint16_t data, uint8_t num_bits,
+                           const uint8_t *expected, uint8_t *values) {
+    uint8_t *bits_recv = send_receive_data_multi(data, num_bits, set->sample_divisor,
+                                                 set->num_channels);
+    if (!bits_recv) {
+        return false;
+    }
+
+    uint8_t decoded[MAX_RECEIVERS];
+    absolute_time_t start_time = get_absolute_time();
+    process_patterns_batch(bits_recv, set->num_channels, set->sample_divisor, decoded);
+    set->decode_time_us += absolute_time_diff_us(start_time, get_absolute_time());
+    MEM_FREE(bits_recv);
+
+    for (int c = 0; c < set->num_channels; c++) {
+        receiver_channel_t *channel = &set->channels[c];
+        if (channel->frames > 0 && decoded[c] != channel->last_value) {
+            channel->changes++;
+        }
+        if (expected && decoded[c] != expected[c]) {
+            channel->mismatches++;
+        }
+        channel->last_value = decoded[c];
+        channel->frames++;
+        if (values) {
+            values[c] = decoded[c];
+        }
+    }
+    set->transfers++;
+    return true;
+}
+
+void receiver_set_print_stats(const receiver_set_t *set) {
+    printf("Receivers: %d, transfers: %lu, decode time: %.2f ms (%.1f us per transfer)\n",
+           set->num_channels, (unsigned long)set->transfers, set->decode_time_us / 1000.0f,
+           set->transfers > 0 ? (float)set->decode_time_us / set->transfers : 0.0f);
+    for (int c = 0; c < set->num_channels; c++) {
+        const receiver_channel_t *channel = &set->channels[c];
+        printf("  [RX%d] GPIO%-2d last=0x%02X frames=%lu mismatches=%lu changes=%lu\n",
+               c, channel->gpio, channel->last_value, (unsigned long)channel->frames,
+               (unsigned long)channel->mismatches, (unsigned long)channel->changes);
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef RECEIVER_H
+#define RECEIVER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio_control.h"
+
+// Decode state of one receiver channel
+typedef struct {
+    uint8_t gpio;           // Receiver pin
+    uint8_t last_value;     // Last decoded value
+    uint32_t frames;        // Patterns decoded
+    uint32_t mismatches;    // Decoded value differed from the expected one
+    uint32_t changes;       // Decoded value differed from the previous frame
+} receiver_channel_t;
+
+// Receivers sampled together on each clock and decoded as one batch
+typedef struct {
+    int num_channels;
+    uint8_t sample_divisor;
+    receiver_channel_t channels[MAX_RECEIVERS];
+    uint32_t transfers;         // Batched transfers completed
+    uint64_t decode_time_us;    // Time spent in batched DTFT + matching
+} receiver_set_t;
+
+/**
+ * Set up a receiver set and its input pins
+ * @param set Receiver set to initialize
+ * @param num_channels Number of receivers (1-MAX_RECEIVERS)
+ * @param sample_divisor Sampling rate divisor applied to every channel
+ * @return true on success
+ */
+bool receiver_set_init(receiver_set_t *set, int num_channels, uint8_t sample_divisor);
+
+/**
+ * Transmit one pattern, sample all receivers and decode them in one batch
+ * @param set Receiver set
+ * @param data Pattern driven on the transmitter
+ * @param num_bits Pattern length
+ * @param expected Expected value per channel for error counting (NULL to skip)
+ * @param values Output: decoded value per channel (may be NULL)
+ * @return true if the transfer completed
+ */
+bool receiver_set_transfer(receiver_set_t *set, uint16_t data, uint8_t num_bits,
+                           const uint8_t *expected, uint8_t *values);
+
+/**
+ * Print per-channel counters
+ * @param set Receiver set
+ */
+void receiver_set_print_stats(const receiver_set_t *set);
+
+#endif // RECEIVER_H
@@ -0,0 +1,169 @@
+#include "retransmit.h"
+#include "gpio_control.h"
+#include "signal.h"
+#include "mem_stats.h"
+#include "pico/stdlib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Pending pixel: accumulated receiver counts over all attempts so far
+typedef struct {
+    uint32_t index;
+    uint8_t counts[9];   // [num_bits, count...] like send_receive_data_soft()
+    uint8_t attempts;
+} pending_pixel_t;
+
+static pending_pixel_t pending[RETRANSMIT_MAX_PENDING];
+
+/**
+ * Send one pixel and add its counts to an accumulated record
+ */
+static bool transfer_pixel(uint8_t value, uint8_t oversample, uint8_t *counts) {
+    uint8_t *received = send_receive_data_soft(value, 8, oversample);
+    if (!received) {
+        return false;
+    }
+    for (int i = 1; i <= 8; i++) {
+        counts[i] += received[i];
+    }
+    MEM_FREE(received);
+    return true;
+}
+
+/**
+ * Evidence for a decision: its confidence (normalized margin) times the passes
+ * combined into it. The margin of the summed counts stays the same fraction
+ * of the reads while the reads behind it grow with every attempt, so a
+ * retried pixel at the same margin is that many times surer.
+ */
+static float decision_evidence(float confidence, int attempts) {
+    return confidence * attempts;
+}
+
+/**
+ * Retry passes over the pending pixels of one segment of the image
+ * @param segment Reader positioned at the first pixel of the segment
+ * @param segment_start Index of that pixel
+ * @param num_pending Entries in pending[] (indices ascending, all in the segment)
+ * @return Pixels still below the threshold after the last pass, -1 on failure
+ */
+static int retry_pending(const image_reader_t *segment, uint32_t segment_start, uint32_t num_pending,
+                         const retransmit_config_t *config, uint8_t *reconstructed,
+                         retransmit_stats_t *stats) {
+    for (int pass = 0; pass < config->max_retries && num_pending > 0; pass++) {
+        image_reader_t reader = *segment;
+        uint32_t position = segment_start;
+        uint32_t kept = 0;
+
+        for (uint32_t p = 0; p < num_pending; p++) {
+            pending_pixel_t *pixel = &pending[p];
+
+            // Skip forward to the next pending pixel
+            uint8_t value = 0;
+            while (position <= pixel->index) {
+                if (image_reader_read(&reader, &value, 1) != 1) {
+                    return -1;
+                }
+                position++;
+            }
+
+            if (!transfer_pixel(value, config->oversample, pixel->counts)) {
+                return -1;
+            }
+            pixel->attempts++;
+            stats->transfers++;
+            stats->retried[pass]++;
+
+            float confidence;
+            reconstructed[pixel->index] = process_pattern_soft_return_value(
+                pixel->counts, config->oversample * pixel->attempts, &confidence);
+            if (decision_evidence(confidence, pixel->attempts) < config->threshold) {
+                pending[kept++] = *pixel;
+            }
+        }
+
+        num_pending = kept;
+        if ((uint32_t)pass + 1 > stats->retry_passes) {
+            stats->retry_passes = pass + 1;
+        }
+    }
+    return (int)num_pending;
+}
+
+bool retransmit_image(image_reader_t *reader, uint32_t num_pixels, const retransmit_config_t *config,
+                      uint8_t *reconstructed, retransmit_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    if (config->oversample < 1 || config->max_retries < 0 ||
+        config->max_retries > RETRANSMIT_MAX_PASSES ||
+        config->oversample * (config->max_retries + 1) > 255) {
+        printf("Error: invalid retransmission config (oversample %d, retries %d)\n",
+               config->oversample, config->max_retries);
+        return false;
+    }
+
+    absolute_time_t start_time = get_absolute_time();
+    uint32_t num_pending = 0;
+    image_reader_t segment = *reader;
+    uint32_t segment_start = 0;
+
+    for (uint32_t i = 0; i < num_pixels; i++) {
+        uint8_t value;
+        if (image_reader_read(reader, &value, 1) != 1) {
+            num_pixels = i;
+            break;
+        }
+
+        uint8_t counts[9] = {8};
+        if (!transfer_pixel(value, config->oversample, counts)) {
+            return false;
+        }
+        stats->transfers++;
+
+        float confidence;
+        reconstructed[i] = process_pattern_soft_return_value(counts, config->oversample, &confidence);
+        if (decision_evidence(confidence, 1) < config->threshold) {
+            pending[num_pending].index = i;
+            memcpy(pending[num_pending].counts, counts, sizeof(counts));
+            pending[num_pending].attempts = 1;
+            num_pending++;
+        }
+
+        // List full: retry this segment now and start the next one here
+        if (num_pending == RETRANSMIT_MAX_PENDING) {
+            int left = retry_pending(&segment, segment_start, num_pending, config, reconstructed, stats);
+            if (left < 0) {
+                return false;
+            }
+            stats->low_confidence += left;
+            stats->segments++;
+            num_pending = 0;
+            segment = *reader;
+            segment_start = i + 1;
+        }
+    }
+    stats->pixels = num_pixels;
+
+    int left = retry_pending(&segment, segment_start, num_pending, config, reconstructed, stats);
+    if (left < 0) {
+        return false;
+    }
+    stats->low_confidence += left;
+    stats->segments++;
+
+    stats->time_us = absolute_time_diff_us(start_time, get_absolute_time());
+    return true;
+}
+
+void retransmit_print_stats(const retransmit_stats_t *stats) {
+    printf("Pixels: %lu, transfers: %lu (%.3f per pixel), time: %.2f s\n",
+           (unsigned long)stats->pixels, (unsigned long)stats->transfers,
+           stats->pixels > 0 ? (float)stats->transfers / stats->pixels : 0.0f,
+           stats->time_us / 1000000.0f);
+    for (uint32_t pass = 0; pass < stats->retry_passes; pass++) {
+        printf("  Retry pass %lu: %lu pixels resent\n",
+               (unsigned long)(pass + 1), (unsigned long)stats->retried[pass]);
+    }
+    printf("Below threshold after last pass: %lu (%lu retry segments)\n",
+           (unsigned long)stats->low_confidence, (unsigned long)stats->segments);
+}
@@ -0,0 +1,52 @@
+#ifndef RETRANSMIT_H
+#define RETRANSMIT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "image_asset.h"
+
+// Confidence-gated selective retransmission. Every pixel is sent once with
+// soft reception; pixels decoded below the confidence threshold are kept on a
+// pending list with their receiver counts. Retry passes resend only the
+// pending pixels, add the new counts to the old ones (combining attempts) and
+// re-decode; a pixel is done once its confidence times its attempts reaches
+// the threshold (the summed counts rest on that many more reads). Retries are batched: they run when the list fills up, over the
+// segment of the image sent since the previous batch, and at the end.
+#define RETRANSMIT_MAX_PENDING 1024
+#define RETRANSMIT_MAX_PASSES 8
+
+typedef struct {
+    float threshold;     // Retransmit while confidence x attempts is below this
+    int max_retries;     // Retry passes (0-RETRANSMIT_MAX_PASSES)
+    int oversample;      // Receiver reads per bit; oversample * (max_retries + 1) <= 255
+} retransmit_config_t;
+
+typedef struct {
+    uint32_t pixels;
+    uint32_t transfers;                         // Pixel transmissions including retries
+    uint32_t segments;                          // Retry batches (list flushes)
+    uint32_t retry_passes;                      // Most retry passes any batch needed
+    uint32_t retried[RETRANSMIT_MAX_PASSES];    // Pixels resent in each retry pass
+    uint32_t low_confidence;                    // Still below threshold after the last pass
+    int64_t time_us;
+} retransmit_stats_t;
+
+/**
+ * Transmit and reconstruct the first num_pixels of an image with selective retransmission
+ * @param reader Open reader positioned at the first pixel
+ * @param num_pixels Pixels to process
+ * @param config Threshold, retries and oversampling
+ * @param reconstructed Output: num_pixels decoded values
+ * @param stats Output: transfer statistics
+ * @return false on invalid configuration or transfer failure
+ */
+bool retransmit_image(image_reader_t *reader, uint32_t num_pixels, const retransmit_config_t *config,
+                      uint8_t *reconstructed, retransmit_stats_t *stats);
+
+/**
+ * Print retransmission statistics
+ * @param stats Statistics from retransmit_image()
+ */
+void retransmit_print_stats(const retransmit_stats_t *stats);
+
+#endif // RETRANSMIT_H
@@ -2,11 +2,16 @@
 #include "dtft.h"
 #include "output.h"
 #include "pico/time.h"
-#include "lib/dtft_lookup_n10.h"
+#include "dtft_table.h"
+#include "lazy_spectrum.h"
+#include "width_table.h"
+#include "startup.h"
+#include "mem_stats.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 #include <stdarg.h>
+#include <string.h>
 #include "pico/stdlib.h"
 
 // ARM Cortex-M33 DWT (Data Watchpoint and Trace) cycle counter
@@ -15,21 +20,34 @@
 #define DWT_CYCCNT  (*(volatile uint32_t *)0xE0001004)
 #define DEM_CR      (*(volatile uint32_t *)0xE000EDFC)
 
+// Host builds (PICO_ON_DEVICE=0, e.g. host/sim) have no DWT
+#if !defined(PICO_ON_DEVICE) || PICO_ON_DEVICE
+#define HAVE_DWT 1
+#else
+#define HAVE_DWT 0
+#endif
+
 /**
  * Initialize the DWT cycle counter
  * Call this once at startup before measuring cycles
  */
 void init_cycle_counter(void) {
+#if HAVE_DWT
     DEM_CR |= 0x01000000;  // Enable DWT
     DWT_CTRL |= 0x00000001;  // Enable cycle counter
+#endif
 }
 
 /**
  * Get current cycle count from DWT
- * @return Current CPU cycle count
+ * @return Current CPU cycle count (microseconds in host builds, which have no DWT)
  */
 static inline uint32_t get_cycle_count(void) {
+#if HAVE_DWT
     return DWT_CYCCNT;
+#else
+    return time_us_32();
+#endif
 }
 
 // DEBUG control: set to 1 for verbose logging/plotting, 0 for performance runs
@@ -63,13 +81,119 @@ float calculate_euclidean_distance(const float *spectrum1, const float *spectrum
     return sum;  // Return squared distance (sqrt is unnecessary for comparisons)
 }
 
+// Patterns whose lookup magnitudes differ by less than this (squared distance)
+// have the same magnitude spectrum: circular shifts and reversals of each other.
+// In the n10 table such ties differ by < 1e-5, distinct spectra by >= 5e4.
+#define MAGNITUDE_TIE_TOLERANCE 1.0f
+
+// Magnitude-equivalence class of each value (smallest value in its class)
+static uint8_t magnitude_class[256];
+static bool magnitude_class_ready = false;
+
+/**
+ * Group lookup table entries with identical magnitude spectra (computed once)
+ */
+static void init_magnitude_classes(void) {
+    for (int value = 0; value < 256; value++) {
+        magnitude_class[value] = value;
+        for (int other = 0; other < value; other++) {
+            if (magnitude_class[other] != other) continue;
+            float distance = 0.0f;
+            for (int freq = 0; freq < 41; freq++) {
+                float diff = dtft_table_magnitude(value, freq) - dtft_table_magnitude(other, freq);
+                distance += diff * diff;
+            }
+            if (distance < MAGNITUDE_TIE_TOLERANCE) {
+                magnitude_class[value] = other;
+                break;
+            }
+        }
+    }
+    magnitude_class_ready = true;
+}
+
+/**
+ * Squared distance between a computed complex spectrum and a lookup table entry
+ * (table stores squared magnitude and phase per bin)
+ * @param complex_values Computed DTFT [real0, imag0, ...] (41 points)
+ * @param value Lookup table entry
+ * @return Squared complex Euclidean distance
+ */
+static float complex_table_distance(const float *complex_values, int value) {
+    float sum = 0.0f;
+    for (int freq = 0; freq < 41; freq++) {
+        const DTFTPoint point = dtft_table_point(value, freq);
+        float amplitude = sqrtf(point.magnitude);
+        float diff_re = complex_values[2*freq] - amplitude * cosf(point.phase);
+        float diff_im = complex_values[2*freq + 1] - amplitude * sinf(point.phase);
+        sum += diff_re * diff_re + diff_im * diff_im;
+    }
+    return sum;
+}
+
+/**
+ * Pick the value whose complex spectrum is closest among the magnitude
+ * equivalents (circular shifts/reversals) of the magnitude best match
+ * @param complex_values Computed DTFT [real0, imag0, ...] (41 points)
+ * @param best_match Best match by magnitude distance
+ * @return Best match within its magnitude class
+ */
+static uint8_t resolve_magnitude_tie(const float *complex_values, uint8_t best_match) {
+    startup_tables_wait();  // Tables may still be building on Core1
+    if (!magnitude_class_ready) {
+        init_magnitude_classes();
+    }
+    uint8_t best_class = magnitude_class[best_match];
+    float min_complex_distance = INFINITY;
+    for (int value = best_class; value < 256; value++) {
+        if (magnitude_class[value] != best_class) continue;
+        float distance = complex_table_distance(complex_values, value);
+        if (distance < min_complex_distance) {
+            min_complex_distance = distance;
+            best_match = value;
+        }
+    }
+    return best_match;
+}
+
+/**
+ * Magnitude distance to both values of a complement pair: they share bins
+ * 1-40, so the pair costs one row and two DC terms
+ * @param computed_magnitudes Computed DTFT squared magnitudes (41 points)
+ * @param representative Value with the MSB clear (0-127)
+ * @param distance Output: squared distance of the closer value
+ * @return The closer of representative and its complement (representative on a tie)
+ */
+static inline uint8_t complement_pair_distance(const float *computed_magnitudes, int representative,
+                                               float *distance) {
+    const DTFTPoint *row = dtft_table_pair_row(representative);
+    float sum = 0.0f;
+    for (int freq = 1; freq < 41; freq++) {
+        float diff = computed_magnitudes[freq] - row[freq].magnitude;
+        sum += diff * diff;
+    }
+    const int complement = representative ^ DTFT_COMPLEMENT_MASK;
+    float dc_rep = computed_magnitudes[0] - dtft_table_dc(representative);
+    float dc_comp = computed_magnitudes[0] - dtft_table_dc(complement);
+    if (dc_comp * dc_comp < dc_rep * dc_rep) {
+        *distance = sum + dc_comp * dc_comp;
+        return complement;
+    }
+    *distance = sum + dc_rep * dc_rep;
+    return representative;
+}
+
 /**
  * Reconstruct pixel value from DTFT spectrum using Euclidean distance
- * @param computed_magnitudes Computed DTFT magnitudes (41 points)
+ * Magnitudes cannot tell circular shifts or reversals of a pattern apart, so
+ * when the best match has such equivalents the phase decides between them
+ * @param computed_magnitudes Computed DTFT squared magnitudes (41 points)
+ * @param complex_values Computed DTFT complex values (41 points, for tie-breaks)
  * @param num_frequencies Number of frequency points (should be 41)
  * @return Best matching pixel value (0-255)
  */
-uint8_t reconstruct_pixel_value(const float *computed_magnitudes, int num_frequencies) {
+uint8_t reconstruct_pixel_value(const float *computed_magnitudes, const float *complex_values,
+                                int num_frequencies) {
     if (num_frequencies != 41) {
         printf("Warning: Expected 41 frequency points, got %d\n", num_frequencies);
         return 0;
@@ -78,16 +202,10 @@ uint8_t reconstruct_pixel_value(const float *computed_magnitudes, int num_freque
     float min_distance = INFINITY;
     uint8_t best_match = 0;
     
-    // Compare with all 256 lookup table entries
-    for (int value = 0; value < 256; value++) {
-        // Extract magnitudes from lookup table
-        float lookup_magnitudes[41];
-        for (int freq = 0; freq < 41; freq++) {
-            lookup_magnitudes[freq] = dtft_lookup_n10[value][freq].magnitude;
-        }
-        
-        // Calculate Euclidean distance
-        float distance = calculate_euclidean_distance(computed_magnitudes, lookup_magnitudes, 41);
+    // Compare with all 256 lookup table entries, one complement pair per row
+    for (int pair = 0; pair < DTFT_NUM_PAIRS; pair++) {
+        float distance;
+        uint8_t value = complement_pair_distance(computed_magnitudes, pair, &distance);
         
         // Update best match
         if (distance < min_distance) {
@@ -96,6 +214,9 @@ uint8_t reconstruct_pixel_value(const float *computed_magnitudes, int num_freque
         }
     }
     
+    // Resolve magnitude ties (shifted/reversed patterns) with the phase
+    best_match = resolve_magnitude_tie(complex_values, best_match);
+    
     perf_printf("\n=== Pixel Value Reconstruction (Euclidean Distance) ===\n");
     perf_printf("Best match: 0x%02X (0b", best_match);
     for (int i = 7; i >= 0; i--) {
@@ -115,7 +236,7 @@ uint8_t reconstruct_pixel_value(const float *computed_magnitudes, int num_freque
     for (int value = 0; value < 256; value++) {
         float lookup_magnitudes[41];
         for (int freq = 0; freq < 41; freq++) {
-            lookup_magnitudes[freq] = dtft_lookup_n10[value][freq].magnitude;
+            lookup_magnitudes[freq] = dtft_table_magnitude(value, freq);
         }
         matches[value].value = value;
         matches[value].distance = calculate_euclidean_distance(computed_magnitudes, lookup_magnitudes, 41);
@@ -144,10 +265,518 @@ uint8_t reconstruct_pixel_value(const float *computed_magnitudes, int num_freque
     return best_match;
 }
 
+/**
+ * Reconstruct the pixel values of several channels in one lookup table scan
+ * Each complement-pair row is loaded once and compared against every channel
+ * @param magnitudes Computed squared magnitudes per channel
+ * @param complex_values Computed complex DTFT per channel (for tie-breaks)
+ * @param num_channels Number of channels
+ * @param values Output: best matching value per channel
+ */
+static void reconstruct_pixel_values_batch(const float (*magnitudes)[41],
+                                           const float (*complex_values)[41 * 2],
+                                           int num_channels, uint8_t *values) {
+    float min_distance[SIGNAL_MAX_BATCH];
+    for (int c = 0; c < num_channels; c++) {
+        min_distance[c] = INFINITY;
+        values[c] = 0;
+    }
+
+    for (int pair = 0; pair < DTFT_NUM_PAIRS; pair++) {
+        for (int c = 0; c < num_channels; c++) {
+            float distance;
+            uint8_t value = complement_pair_distance(magnitudes[c], pair, &distance);
+            if (distance < min_distance[c]) {
+                min_distance[c] = distance;
+                values[c] = value;
+            }
+        }
+    }
+
+    for (int c = 0; c < num_channels; c++) {
+        values[c] = resolve_magnitude_tie(complex_values[c], values[c]);
+    }
+}
+
+// Coarse-to-fine matcher: lookup table bins ordered by how much they vary
+// across the 256 entries. Bins with (near) constant table values add the same
+// amount to every candidate's distance and are never requested.
+static uint8_t lazy_bin_order[41];
+static int lazy_num_informative = 0;
+static float *lazy_suffix_bound = NULL;   // [256][lazy_num_informative + 1]
+static bool lazy_matcher_ready = false;
+static uint32_t lazy_pixels = 0;
+static uint32_t lazy_bins_total = 0;
+
+/**
+ * Order bins by table variance and precompute, per entry, an upper bound on the
+ * distance still to come from the bins not yet requested. Received bits are
+ * binary, so each computed squared magnitude lies in [0, max over the table].
+ */
+static bool init_lazy_matcher(void) {
+    float variance[41];
+    float max_magnitude[41];
+
+    lazy_num_informative = 0;
+    for (int freq = 0; freq < 41; freq++) {
+        float sum = 0.0f;
+        float sum_sq = 0.0f;
+        float min_value = INFINITY;
+        max_magnitude[freq] = 0.0f;
+        for (int value = 0; value < 256; value++) {
+            float m = dtft_table_magnitude(value, freq);
+            sum += m;
+            sum_sq += m * m;
+            if (m < min_value) min_value = m;
+            if (m > max_magnitude[freq]) max_magnitude[freq] = m;
+        }
+        variance[freq] = sum_sq / 256.0f - (sum / 256.0f) * (sum / 256.0f);
+        if (max_magnitude[freq] - min_value > MAGNITUDE_TIE_TOLERANCE) {
+            // Insertion by decreasing variance
+            int i = lazy_num_informative++;
+            while (i > 0 && variance[lazy_bin_order[i - 1]] < variance[freq]) {
+                lazy_bin_order[i] = lazy_bin_order[i - 1];
+                i--;
+            }
+            lazy_bin_order[i] = freq;
+        }
+    }
+
+    const int stride = lazy_num_informative + 1;
+    lazy_suffix_bound = MEM_MALLOC(256 * stride * sizeof(float));
+    if (!lazy_suffix_bound) {
+        return false;
+    }
+    for (int value = 0; value < 256; value++) {
+        float *bound = &lazy_suffix_bound[value * stride];
+        bound[lazy_num_informative] = 0.0f;
+        for (int i = lazy_num_informative - 1; i >= 0; i--) {
+            int freq = lazy_bin_order[i];
+            float t = dtft_table_magnitude(value, freq);
+            float far = max_magnitude[freq] - t > t ? max_magnitude[freq] - t : t;
+            bound[i] = bound[i + 1] + far * far;
+        }
+    }
+
+    lazy_matcher_ready = true;
+    return true;
+}
+
+/**
+ * Complex distance to a lookup entry over the informative bins, pulled lazily
+ */
+static float lazy_complex_distance(lazy_spectrum_t *spectrum, int value) {
+    float sum = 0.0f;
+    for (int i = 0; i < lazy_num_informative; i++) {
+        int freq = lazy_bin_order[i];
+        const float *x = lazy_spectrum_value(spectrum, freq);
+        const DTFTPoint point = dtft_table_point(value, freq);
+        float amplitude = sqrtf(point.magnitude);
+        float diff_re = x[0] - amplitude * cosf(point.phase);
+        float diff_im = x[1] - amplitude * sinf(point.phase);
+        sum += diff_re * diff_re + diff_im * diff_im;
+    }
+    return sum;
+}
+
+/**
+ * Complex distance to a lookup entry over the informative bins of a full spectrum
+ */
+static float soft_table_distance(const float *complex_values, int value) {
+    float sum = 0.0f;
+    for (int i = 0; i < lazy_num_informative; i++) {
+        int freq = lazy_bin_order[i];
+        const DTFTPoint point = dtft_table_point(value, freq);
+        float amplitude = sqrtf(point.magnitude);
+        float diff_re = complex_values[2*freq] - amplitude * cosf(point.phase);
+        float diff_im = complex_values[2*freq + 1] - amplitude * sinf(point.phase);
+        sum += diff_re * diff_re + diff_im * diff_im;
+    }
+    return sum;
+}
+
+/**
+ * Reconstruct a pixel value requesting bins most-discriminative first
+ * After each bin, candidates whose partial distance already exceeds the
+ * leader's worst case are dropped; matching stops once only the leader's
+ * magnitude class is left. Same result as reconstruct_pixel_value().
+ * @param spectrum Lazy spectrum of the received pattern
+ * @return Best matching pixel value (0-255)
+ */
+static uint8_t reconstruct_pixel_value_lazy(lazy_spectrum_t *spectrum) {
+    startup_tables_wait();
+    if (!magnitude_class_ready) {
+        init_magnitude_classes();
+    }
+
+    static uint8_t alive[256];
+    static float partial[256];
+    int num_alive = 256;
+    for (int value = 0; value < 256; value++) {
+        alive[value] = value;
+        partial[value] = 0.0f;
+    }
+
+    const int stride = lazy_num_informative + 1;
+    uint8_t best = 0;
+    for (int i = 0; i < lazy_num_informative; i++) {
+        const int freq = lazy_bin_order[i];
+        const float m = lazy_spectrum_magnitude(spectrum, freq);
+
+        float best_distance = INFINITY;
+        for (int a = 0; a < num_alive; a++) {
+            int value = alive[a];
+            float diff = m - dtft_table_magnitude(value, freq);
+            partial[value] += diff * diff;
+            if (partial[value] < best_distance) {
+                best_distance = partial[value];
+                best = value;
+            }
+        }
+
+        // Keep only candidates that could still beat the leader
+        float bound = best_distance + lazy_suffix_bound[best * stride + i + 1];
+        bound += bound * 1e-5f + MAGNITUDE_TIE_TOLERANCE;
+        int kept = 0;
+        bool single_class = true;
+        for (int a = 0; a < num_alive; a++) {
+            int value = alive[a];
+            if (partial[value] <= bound) {
+                alive[kept++] = value;
+                if (magnitude_class[value] != magnitude_class[best]) single_class = false;
+            }
+        }
+        num_alive = kept;
+        if (single_class) {
+            break;
+        }
+    }
+
+    // Tie-break within the magnitude class by phase (only if the class has several members)
+    if (num_alive > 1) {
+        float min_complex_distance = INFINITY;
+        uint8_t tie_winner = best;
+        for (int a = 0; a < num_alive; a++) {
+            int value = alive[a];
+            if (magnitude_class[value] != magnitude_class[best]) continue;
+            float distance = lazy_complex_distance(spectrum, value);
+            if (distance < min_complex_distance) {
+                min_complex_distance = distance;
+                tie_winner = value;
+            }
+        }
+        best = tie_winner;
+    }
+
+    lazy_pixels++;
+    lazy_bins_total += spectrum->bins_computed;
+    return best;
+}
+
+// Seeded search: candidates are visited outward in value from a predicted
+// value. Splitting a spectrum into its DC bin (set by the number of ones) and
+// the rest, the reverse triangle inequality bounds the squared distance to an
+// entry from below by (dc_x - dc_t)^2 + (|rest_x| - |rest_t|)^2. Prefix/suffix
+// ranges of both extend the bound to every candidate not yet visited.
+// Bounds are shrunk slightly so float rounding never prunes the true best.
+#define SEEDED_BOUND_SLACK 0.999f
+
+typedef struct {
+    float dc_min, dc_max;
+    float rest_min, rest_max;
+} norm_range_t;
+
+static float entry_dc[256];          // DC bin of each entry
+static float entry_rest[256];        // Norm of the other bins
+static norm_range_t prefix_range[256];   // Over values 0..v
+static norm_range_t suffix_range[256];   // Over values v..255
+static bool seeded_search_ready = false;
+
+// Seeded search statistics
+static uint32_t seeded_pixels = 0;
+static uint32_t seeded_candidates_total = 0;
+
+static void extend_range(norm_range_t *range, const norm_range_t *prev, int value) {
+    range->dc_min = fminf(prev->dc_min, entry_dc[value]);
+    range->dc_max = fmaxf(prev->dc_max, entry_dc[value]);
+    range->rest_min = fminf(prev->rest_min, entry_rest[value]);
+    range->rest_max = fmaxf(prev->rest_max, entry_rest[value]);
+}
+
+/**
+ * DC bins and rest norms of the lookup entries and their prefix/suffix ranges (computed once)
+ */
+static void init_seeded_search(void) {
+    for (int value = 0; value < 256; value++) {
+        float sum = 0.0f;
+        for (int freq = 1; freq < 41; freq++) {
+            float m = dtft_table_magnitude(value, freq);
+            sum += m * m;
+        }
+        entry_dc[value] = dtft_table_dc(value);
+        entry_rest[value] = sqrtf(sum);
+    }
+    const norm_range_t first = {entry_dc[0], entry_dc[0], entry_rest[0], entry_rest[0]};
+    const norm_range_t last = {entry_dc[255], entry_dc[255], entry_rest[255], entry_rest[255]};
+    prefix_range[0] = first;
+    for (int value = 1; value < 256; value++) {
+        extend_range(&prefix_range[value], &prefix_range[value - 1], value);
+    }
+    suffix_range[255] = last;
+    for (int value = 254; value >= 0; value--) {
+        extend_range(&suffix_range[value], &suffix_range[value + 1], value);
+    }
+    seeded_search_ready = true;
+}
+
+void init_matcher_tables(void) {
+    if (!magnitude_class_ready) {
+        init_magnitude_classes();
+    }
+    if (!seeded_search_ready) {
+        init_seeded_search();
+    }
+    if (!lazy_matcher_ready) {
+        init_lazy_matcher();
+    }
+}
+
+/**
+ * Distance from a value to a range (0 inside the range)
+ */
+static inline float range_gap(float x, float lo, float hi) {
+    if (x < lo) return lo - x;
+    if (x > hi) return x - hi;
+    return 0.0f;
+}
+
+/**
+ * Lower bound on the squared distance to any entry of a range
+ */
+static inline float range_bound(float dc, float rest, const norm_range_t *range) {
+    float gap_dc = range_gap(dc, range->dc_min, range->dc_max);
+    float gap_rest = range_gap(rest, range->rest_min, range->rest_max);
+    return (gap_dc * gap_dc + gap_rest * gap_rest) * SEEDED_BOUND_SLACK;
+}
+
+void seeded_search_begin(seeded_search_t *search, const float *computed_magnitudes, uint8_t seed) {
+    startup_tables_wait();
+    if (!seeded_search_ready) {
+        init_seeded_search();
+    }
+    if (!magnitude_class_ready) {
+        init_magnitude_classes();
+    }
+
+    float sum = 0.0f;
+    for (int freq = 1; freq < 41; freq++) {
+        sum += computed_magnitudes[freq] * computed_magnitudes[freq];
+    }
+    search->dc = computed_magnitudes[0];
+    search->rest = sqrtf(sum);
+    search->min_distance = INFINITY;
+    search->seed = seed;
+    search->best_match = seed;
+    search->radius = 0;
+    search->evaluated = 0;
+    search->done = false;
+}
+
+bool seeded_search_step(seeded_search_t *search, const float *computed_magnitudes,
+                        int max_candidates) {
+    const float dc = search->dc;
+    const float rest = search->rest;
+    const int seed = search->seed;
+    const uint32_t budget_end = search->evaluated + (uint32_t)max_candidates;
+
+    // Whole radii only, so a step may run one candidate over its budget
+    while (!search->done && search->evaluated < budget_end) {
+        const int radius = search->radius++;
+        const int low = seed - radius;
+        const int high = seed + radius;
+        if (low < 0 && high > 255) {
+            search->done = true;
+            break;
+        }
+
+        // Lower bound for every candidate at this radius or beyond
+        float bound = INFINITY;
+        if (low >= 0) {
+            bound = range_bound(dc, rest, &prefix_range[low]);
+        }
+        if (high <= 255) {
+            bound = fminf(bound, range_bound(dc, rest, &suffix_range[high]));
+        }
+        if (bound >= search->min_distance) {
+            search->done = true;
+            break;
+        }
+
+        for (int side = 0; side < (radius ? 2 : 1); side++) {
+            const int value = side ? high : low;
+            if (value < 0 || value > 255) continue;
+
+            // Skip entries whose own bound cannot beat the best, and the best's
+            // magnitude equivalents (the phase tie-break below picks among those)
+            float gap_dc = dc - entry_dc[value];
+            float gap_rest = rest - entry_rest[value];
+            if ((gap_dc * gap_dc + gap_rest * gap_rest) * SEEDED_BOUND_SLACK >= search->min_distance) continue;
+            if (search->min_distance < INFINITY &&
+                magnitude_class[value] == magnitude_class[search->best_match]) continue;
+
+            float lookup_magnitudes[41];
+            for (int freq = 0; freq < 41; freq++) {
+                lookup_magnitudes[freq] = dtft_table_magnitude(value, freq);
+            }
+            float distance = calculate_euclidean_distance(computed_magnitudes, lookup_magnitudes, 41);
+            search->evaluated++;
+
+            if (distance < search->min_distance) {
+                search->min_distance = distance;
+                search->best_match = value;
+            }
+        }
+    }
+    return search->done;
+}
+
+uint8_t seeded_search_finish(const seeded_search_t *search, const float *complex_values) {
+    seeded_pixels++;
+    seeded_candidates_total += search->evaluated;
+    return resolve_magnitude_tie(complex_values, search->best_match);
+}
+
+uint8_t reconstruct_pixel_value_seeded(const float *computed_magnitudes, const float *complex_values,
+                                       uint8_t seed) {
+    seeded_search_t search;
+    seeded_search_begin(&search, computed_magnitudes, seed);
+    while (!seeded_search_step(&search, computed_magnitudes, 256)) {
+    }
+    return seeded_search_finish(&search, complex_values);
+}
+
+void seeded_match_get_stats(uint32_t *pixels, uint32_t *candidates) {
+    *pixels = seeded_pixels;
+    *candidates = seeded_candidates_total;
+}
+
+void seeded_match_reset_stats(void) {
+    seeded_pixels = 0;
+    seeded_candidates_total = 0;
+}
+
+// Decode repetitions: the received period is transformed as if repeated this
+// many times, X_R(ω) = X_1(ω)·G_R(ω) with G_R(ω) = Σ_{r<R} e^{-jωPr}. The
+// lookup tables hold X_1·G_N (N = DTFT_N), so each bin is scaled by G_N/G_R to
+// the table's repetitions; bins where G_N is zero are zero in every entry and
+// are left zero without being transformed. Decisions are those of the n10 path.
+static int decode_repetitions = DTFT_N;
+static float repetition_scale[DTFT_NUM_FREQUENCIES * 2];   // [re, im] of G_N/G_R
+static bool repetition_scale_zero[DTFT_NUM_FREQUENCIES];
+
+/**
+ * Repetition gain of an 8-bit period at bin k of the 41-bin grid
+ * ω_k·P·r = π·(k·P·r)/40 is reduced to [0, 2π) in integers, so whole turns
+ * contribute exactly 1
+ */
+static void repetition_gain(int repetitions, int k, double *gain_re, double *gain_im) {
+    const long turn = 2 * (DTFT_NUM_FREQUENCIES - 1);
+    *gain_re = 0.0;
+    *gain_im = 0.0;
+    for (int r = 0; r < repetitions; r++) {
+        long phase = ((long)k * DTFT_BIT_DEPTH * r) % turn;
+        *gain_re += phase ? cos(M_PI * phase / (turn / 2)) : 1.0;
+        *gain_im -= phase ? sin(M_PI * phase / (turn / 2)) : 0.0;
+    }
+}
+
+bool set_decode_repetitions(int repetitions) {
+    if (repetitions < 1) {
+        printf("Error: decode repetitions must be at least 1 (got %d)\n", repetitions);
+        return false;
+    }
+
+    float scale[DTFT_NUM_FREQUENCIES * 2];
+    bool zero[DTFT_NUM_FREQUENCIES];
+    for (int k = 0; k < DTFT_NUM_FREQUENCIES; k++) {
+        double nr, ni, rr, ri;
+        repetition_gain(DTFT_N, k, &nr, &ni);
+        repetition_gain(repetitions, k, &rr, &ri);
+        zero[k] = fabs(nr) < 1e-9 && fabs(ni) < 1e-9;
+        if (zero[k]) {
+            scale[2*k] = 0.0f;
+            scale[2*k + 1] = 0.0f;
+            continue;
+        }
+        // A bin the table uses but R repetitions cancel cannot be recovered
+        double norm = rr * rr + ri * ri;
+        if (norm < 1e-18) {
+            printf("Error: %d repetitions cancel bin %d of the lookup table\n", repetitions, k);
+            return false;
+        }
+        scale[2*k] = (float)((nr * rr + ni * ri) / norm);
+        scale[2*k + 1] = (float)((ni * rr - nr * ri) / norm);
+    }
+
+    memcpy(repetition_scale, scale, sizeof(scale));
+    memcpy(repetition_scale_zero, zero, sizeof(zero));
+    decode_repetitions = repetitions;
+    return true;
+}
+
+int get_decode_repetitions(void) {
+    return decode_repetitions;
+}
+
+/**
+ * Scale a spectrum of decode_repetitions periods to the table's DTFT_N
+ * @param complex_values 41 bins [real, imag], scaled in place
+ */
+static void normalize_spectrum(float *complex_values) {
+    if (decode_repetitions == DTFT_N) {
+        return;
+    }
+    for (int k = 0; k < DTFT_NUM_FREQUENCIES; k++) {
+        const float re = complex_values[2*k];
+        const float im = complex_values[2*k + 1];
+        const float sr = repetition_scale[2*k];
+        const float si = repetition_scale[2*k + 1];
+        complex_values[2*k] = re * sr - im * si;
+        complex_values[2*k + 1] = re * si + im * sr;
+    }
+}
+
+/**
+ * 41-bin spectrum of sampled 0/1 bits as the lookup table sees it
+ * With DTFT_N repetitions this is calculate_dtft_zoh(); otherwise only bins
+ * the table uses are transformed over decode_repetitions periods and scaled
+ * @param samples Sampled bits
+ * @param pattern_len Samples per period after the hold
+ * @param hold Sampling divisor (1 = every bit sampled)
+ * @param complex_values Output: 41 bins [real, imag]
+ */
+static void decode_spectrum(const uint8_t *samples, int pattern_len, int hold,
+                            float *complex_values) {
+    if (decode_repetitions == DTFT_N) {
+        calculate_dtft_zoh(samples, pattern_len, hold, DTFT_N, DTFT_NUM_FREQUENCIES, complex_values);
+        return;
+    }
+    for (int k = 0; k < DTFT_NUM_FREQUENCIES; k++) {
+        if (repetition_scale_zero[k]) {
+            complex_values[2*k] = 0.0f;
+            complex_values[2*k + 1] = 0.0f;
+            continue;
+        }
+        calculate_dtft_bin(samples, pattern_len, hold, decode_repetitions, DTFT_NUM_FREQUENCIES, k,
+                           &complex_values[2*k]);
+    }
+    normalize_spectrum(complex_values);
+}
+
 uint8_t* repeat_pattern(uint8_t *pattern, int repetitions) {
     int pattern_len = pattern[0];  // Extract length from first element
     int total_len = pattern_len * repetitions;
-    uint8_t *buffer = malloc(total_len * sizeof(uint8_t));
+    uint8_t *buffer = MEM_MALLOC(total_len * sizeof(uint8_t));
     
     for (int rep = 0; rep < repetitions; rep++) {
         for (int i = 0; i < pattern_len; i++) {
@@ -171,19 +800,18 @@ void process_pattern(uint8_t *bits_sent) {
     printf("\n");
 #endif
 
-    // Repeat the pattern 10 times for DTFT analysis
-    uint8_t *signal_buffer = repeat_pattern(bits_sent, 10);
-    
-    // Get total buffer size
-    int total_len = pattern_len * 10;
-    
-    // Print the signal buffer for verification
+    // The DTFT runs over the pattern repeated decode_repetitions times; the
+    // repetition is folded into the kernel, so the buffer is only built for
+    // verification
 #if DEBUG
-    printf("Signal buffer (pattern repeated 10x): ");
+    uint8_t *signal_buffer = repeat_pattern(bits_sent, decode_repetitions);
+    int total_len = pattern_len * decode_repetitions;
+    printf("Signal buffer (pattern repeated %dx): ", decode_repetitions);
     for (int i = 0; i < total_len; i++) {
         printf("%d", signal_buffer[i]);
     }
     printf("\n");
+    MEM_FREE(signal_buffer);
 #endif
     
     // Compute DTFT with 41 frequency points from 0 to π to match lookup table
@@ -192,28 +820,14 @@ void process_pattern(uint8_t *bits_sent) {
     absolute_time_t start_time = get_absolute_time();
     uint32_t start_cycles = get_cycle_count();
     
-    float *complex_values = malloc(41 * 2 * sizeof(float));
+    float *complex_values = MEM_MALLOC(41 * 2 * sizeof(float));
     if (!complex_values) {
-        free(signal_buffer);
         return;
     }
     
     // Compute DTFT for frequencies 0 to π ONLY (41 points with spacing π/40)
     // This matches the lookup table generation exactly
-    for (int k = 0; k < 41; k++) {
-        float omega = (M_PI * k) / 40.0f;  // Frequency: 0, π/40, 2π/40, ..., 40π/40=π
-        float real_part = 0.0f;
-        float imag_part = 0.0f;
-        
-        for (int n = 0; n < total_len; n++) {
-            float angle = -omega * n;
-            real_part += signal_buffer[n] * cosf(angle);
-            imag_part += signal_buffer[n] * sinf(angle);
-        }
-        
-        complex_values[2*k] = real_part;
-        complex_values[2*k + 1] = imag_part;
-    }
+    decode_spectrum(&bits_sent[1], pattern_len, 1, complex_values);
     
     absolute_time_t end_time = get_absolute_time();
     uint32_t end_cycles = get_cycle_count();
@@ -229,7 +843,7 @@ void process_pattern(uint8_t *bits_sent) {
         
         // Compute squared magnitudes from complex values
         // (no sqrt needed - lookup table now stores squared magnitudes)
-        float *magnitudes = malloc(41 * sizeof(float));
+        float *magnitudes = MEM_MALLOC(41 * sizeof(float));
         if (magnitudes) {
             for (int k = 0; k < 41; k++) {
                 float real = complex_values[2*k];
@@ -247,7 +861,7 @@ void process_pattern(uint8_t *bits_sent) {
             // Print lookup table values for 0x4C for comparison
             printf("\nLookup table 0x4C (first 10 magnitudes):\n");
             for (int i = 0; i < 10; i++) {
-                printf("  freq[%d]: %.6f\n", i, dtft_lookup_n10[0x4C][i].magnitude);
+                printf("  freq[%d]: %.6f\n", i, dtft_table_magnitude(0x4C, i));
             }
 #endif
             
@@ -255,7 +869,7 @@ void process_pattern(uint8_t *bits_sent) {
             absolute_time_t recon_start_time = get_absolute_time();
             uint32_t recon_start_cycles = get_cycle_count();
             
-            uint8_t reconstructed_value = reconstruct_pixel_value(magnitudes, 41);
+            uint8_t reconstructed_value = reconstruct_pixel_value(magnitudes, complex_values, 41);
             
             absolute_time_t recon_end_time = get_absolute_time();
             uint32_t recon_end_cycles = get_cycle_count();
@@ -266,14 +880,28 @@ void process_pattern(uint8_t *bits_sent) {
 #if DEBUG
             plot_dtft_spectrum(magnitudes, 41);
 #endif
-            free(magnitudes);
+            MEM_FREE(magnitudes);
         }
         
-        free(complex_values);
+        MEM_FREE(complex_values);
     }
-    
-    // Free signal buffer
-    free(signal_buffer);
+}
+
+/**
+ * Decode a record that is not DTFT_BIT_DEPTH bits wide with its own table
+ * (process_pattern_width_return_value()); the 8-bit decoders call this first
+ * @param bits_recv Record (first element is the width), held bits at 1..width
+ * @param sample_divisor Sampling rate divisor used by the receiver
+ * @return Reconstructed value, or 0 for widths above 8 bits (they need
+ *         process_pattern_width_return_value())
+ */
+static uint8_t process_other_width(uint8_t *bits_recv, int sample_divisor) {
+    const int width = bits_recv[0];
+    if (width > DTFT_BIT_DEPTH) {
+        printf("Error: %d-bit pattern, use process_pattern_width_return_value()\n", width);
+        return 0;
+    }
+    return (uint8_t)process_pattern_width_return_value(bits_recv, sample_divisor);
 }
 
 uint8_t process_pattern_return_value(uint8_t *bits_sent) {
@@ -282,37 +910,23 @@ uint8_t process_pattern_return_value(uint8_t *bits_sent) {
     // Extract pattern length
     int pattern_len = bits_sent[0];
 
-    // Repeat the pattern 10 times for DTFT analysis
-    uint8_t *signal_buffer = repeat_pattern(bits_sent, 10);
-    
-    // Get total buffer size
-    int total_len = pattern_len * 10;
-    
+    // Other widths decode with their own table
+    if (pattern_len != DTFT_BIT_DEPTH) {
+        return process_other_width(bits_sent, 1);
+    }
+
+    // DTFT of the repeated pattern, scaled to the table's repetitions
     // Compute DTFT with 41 frequency points from 0 to π
-    float *complex_values = malloc(41 * 2 * sizeof(float));
+    float *complex_values = MEM_MALLOC(41 * 2 * sizeof(float));
     if (!complex_values) {
-        free(signal_buffer);
         return 0;
     }
     
     // Compute DTFT for frequencies 0 to π ONLY (41 points with spacing π/40)
-    for (int k = 0; k < 41; k++) {
-        float omega = (M_PI * k) / 40.0f;
-        float real_part = 0.0f;
-        float imag_part = 0.0f;
-        
-        for (int n = 0; n < total_len; n++) {
-            float angle = -omega * n;
-            real_part += signal_buffer[n] * cosf(angle);
-            imag_part += signal_buffer[n] * sinf(angle);
-        }
-        
-        complex_values[2*k] = real_part;
-        complex_values[2*k + 1] = imag_part;
-    }
+    decode_spectrum(&bits_sent[1], pattern_len, 1, complex_values);
     
     // Compute squared magnitudes from complex values
-    float *magnitudes = malloc(41 * sizeof(float));
+    float *magnitudes = MEM_MALLOC(41 * sizeof(float));
     uint8_t reconstructed_value = 0;
     
     if (magnitudes) {
@@ -323,17 +937,172 @@ uint8_t process_pattern_return_value(uint8_t *bits_sent) {
         }
         
         // Reconstruct pixel value using Euclidean distance
-        reconstructed_value = reconstruct_pixel_value(magnitudes, 41);
+        reconstructed_value = reconstruct_pixel_value(magnitudes, complex_values, 41);
         
-        free(magnitudes);
+        MEM_FREE(magnitudes);
     }
     
-    free(complex_values);
-    free(signal_buffer);
+    MEM_FREE(complex_values);
     
+    startup_first_pixel();
     return reconstructed_value;
 }
 
+/**
+ * Collect the bits the receiver actually sampled from a sample-and-hold record
+ * @param bits_recv Record (first element is length), held bits at 1..length
+ * @param sample_divisor Sampling rate divisor used by the receiver
+ * @param samples Output: sampled bits (up to 16)
+ * @return Number of sampled bits
+ */
+static int extract_held_samples(const uint8_t *bits_recv, int sample_divisor, uint8_t *samples) {
+    const int pattern_len = bits_recv[0];
+    int num_samples = 0;
+    for (int n = 0; n < pattern_len; n += sample_divisor) {
+        samples[num_samples++] = bits_recv[1 + n];
+    }
+    return num_samples;
+}
+
+uint8_t process_pattern_zoh_return_value(uint8_t *bits_recv, int sample_divisor) {
+    if (!bits_recv || sample_divisor < 1) return 0;
+    if (bits_recv[0] != DTFT_BIT_DEPTH) {
+        return process_other_width(bits_recv, sample_divisor);
+    }
+
+    const int pattern_len = bits_recv[0];
+    uint8_t samples[16];
+    extract_held_samples(bits_recv, sample_divisor, samples);
+
+    // DTFT of the repeated held pattern from the sampled bits only
+    float complex_values[41 * 2];
+    decode_spectrum(samples, pattern_len, sample_divisor, complex_values);
+
+    float magnitudes[41];
+    for (int k = 0; k < 41; k++) {
+        float real = complex_values[2*k];
+        float imag = complex_values[2*k + 1];
+        magnitudes[k] = real * real + imag * imag;  // Squared magnitude
+    }
+
+    uint8_t value = reconstruct_pixel_value(magnitudes, complex_values, 41);
+    startup_first_pixel();
+    return value;
+}
+
+void decode_pattern_spectrum(const uint8_t *bits_recv, int sample_divisor, float *complex_values,
+                             float *magnitudes) {
+    const int pattern_len = bits_recv[0];
+    uint8_t samples[16];
+    extract_held_samples(bits_recv, sample_divisor, samples);
+
+    decode_spectrum(samples, pattern_len, sample_divisor, complex_values);
+
+    for (int k = 0; k < 41; k++) {
+        magnitudes[k] = complex_values[2*k] * complex_values[2*k] +
+                        complex_values[2*k + 1] * complex_values[2*k + 1];
+    }
+}
+
+uint8_t process_pattern_seeded_return_value(uint8_t *bits_recv, int sample_divisor, uint8_t seed) {
+    if (!bits_recv || sample_divisor < 1) return 0;
+    if (bits_recv[0] != DTFT_BIT_DEPTH) {
+        return process_other_width(bits_recv, sample_divisor);
+    }
+
+    float complex_values[41 * 2];
+    float magnitudes[41];
+    decode_pattern_spectrum(bits_recv, sample_divisor, complex_values, magnitudes);
+
+    uint8_t value = reconstruct_pixel_value_seeded(magnitudes, complex_values, seed);
+    startup_first_pixel();
+    return value;
+}
+
+/**
+ * Harmonic bins k = h*DTFT_N of a record on its width's grid, as the reduced
+ * depth and width tables store them; only these carry energy on that grid.
+ * Their repetition gain is the repetition count itself (whole turns per
+ * period), so a spectrum of decode_repetitions periods is scaled by
+ * DTFT_N / decode_repetitions
+ * @param bits_recv Record (first element is the width), held bits at 1..width
+ * @param sample_divisor Sampling rate divisor used by the receiver
+ * @param num_bins Grid points from 0 to π (DTFT_N*width/2 + 1)
+ * @param num_harmonics Harmonics to compute (width/2 + 1)
+ * @param harmonics Output: [re, im] per harmonic
+ */
+static void decode_harmonics(const uint8_t *bits_recv, int sample_divisor, int num_bins,
+                             int num_harmonics, float *harmonics) {
+    const int pattern_len = bits_recv[0];
+    uint8_t samples[16];
+    extract_held_samples(bits_recv, sample_divisor, samples);
+
+    const float scale = (float)DTFT_N / decode_repetitions;
+    for (int h = 0; h < num_harmonics; h++) {
+        calculate_dtft_bin(samples, pattern_len, sample_divisor, decode_repetitions, num_bins,
+                           h * DTFT_N, &harmonics[2*h]);
+        if (decode_repetitions != DTFT_N) {
+            harmonics[2*h] *= scale;
+            harmonics[2*h + 1] *= scale;
+        }
+    }
+}
+
+uint8_t process_pattern_depth_return_value(uint8_t *bits_recv, int sample_divisor) {
+    if (!bits_recv || sample_divisor < 1) return 0;
+
+    const dtft_depth_table_t *table = dtft_depth_table(bits_recv[0]);
+    if (!table) {
+        printf("Error: no reduced depth table for %d-bit patterns\n", bits_recv[0]);
+        return 0;
+    }
+    float harmonics[(DTFT_DEPTH_MAX_BITS / 2 + 1) * 2];
+    decode_harmonics(bits_recv, sample_divisor, table->num_bins, table->num_harmonics, harmonics);
+
+    // Complex distance to every entry; no magnitude ties to resolve
+    const int num_values = 1 << table->bits;
+    const float *entry = table->entries;
+    float min_distance = INFINITY;
+    uint8_t best_match = 0;
+    for (int value = 0; value < num_values; value++, entry += 2 * table->num_harmonics) {
+        float distance = 0.0f;
+        for (int i = 0; i < 2 * table->num_harmonics; i++) {
+            float diff = harmonics[i] - entry[i];
+            distance += diff * diff;
+        }
+        if (distance < min_distance) {
+            min_distance = distance;
+            best_match = value;
+        }
+    }
+    startup_first_pixel();
+    return best_match;
+}
+
+uint16_t process_pattern_width_return_value(uint8_t *bits_recv, int sample_divisor) {
+    if (!bits_recv || sample_divisor < 1) return 0;
+
+    const int width = bits_recv[0];
+    if (width == DTFT_BIT_DEPTH) {
+        return process_pattern_zoh_return_value(bits_recv, sample_divisor);
+    }
+    if (width >= DTFT_DEPTH_MIN_BITS && width <= DTFT_DEPTH_MAX_BITS) {
+        return process_pattern_depth_return_value(bits_recv, sample_divisor);
+    }
+
+    // Other widths: table generated into the RAM cache on first use
+    const width_table_t *table = width_table_get(width);
+    if (!table) {
+        printf("Error: no decode table for %d-bit patterns\n", width);
+        return 0;
+    }
+    float harmonics[(WIDTH_TABLE_MAX_BITS / 2 + 1) * 2];
+    decode_harmonics(bits_recv, sample_divisor, table->num_bins, table->num_harmonics, harmonics);
+    uint16_t value = width_table_decode(table, harmonics);
+    startup_first_pixel();
+    return value;
+}
+
 void process_pattern_output_spectrum(uint8_t *bits_sent, int pixel_idx, int x, int y) {
     if (!bits_sent) return;
     
@@ -343,37 +1112,18 @@ void process_pattern_output_spectrum(uint8_t *bits_sent, int pixel_idx, int x, i
     // Extract pattern length
     int pattern_len = bits_sent[0];
 
-    // Repeat the pattern 10 times for DTFT analysis
-    uint8_t *signal_buffer = repeat_pattern(bits_sent, 10);
-    
-    // Get total buffer size
-    int total_len = pattern_len * 10;
-    
+    // DTFT of the repeated pattern, scaled to the table's repetitions
     // Compute DTFT with 41 frequency points from 0 to π
-    float *complex_values = malloc(41 * 2 * sizeof(float));
+    float *complex_values = MEM_MALLOC(41 * 2 * sizeof(float));
     if (!complex_values) {
-        free(signal_buffer);
         return;
     }
     
     // Compute DTFT for frequencies 0 to π ONLY (41 points with spacing π/40)
-    for (int k = 0; k < 41; k++) {
-        float omega = (M_PI * k) / 40.0f;
-        float real_part = 0.0f;
-        float imag_part = 0.0f;
-        
-        for (int n = 0; n < total_len; n++) {
-            float angle = -omega * n;
-            real_part += signal_buffer[n] * cosf(angle);
-            imag_part += signal_buffer[n] * sinf(angle);
-        }
-        
-        complex_values[2*k] = real_part;
-        complex_values[2*k + 1] = imag_part;
-    }
+    decode_spectrum(&bits_sent[1], pattern_len, 1, complex_values);
     
     // Compute squared magnitudes from complex values
-    float *magnitudes = malloc(41 * sizeof(float));
+    float *magnitudes = MEM_MALLOC(41 * sizeof(float));
     
     if (magnitudes) {
         for (int k = 0; k < 41; k++) {
@@ -391,9 +1141,138 @@ void process_pattern_output_spectrum(uint8_t *bits_sent, int pixel_idx, int x, i
         }
         printf("\nDTFT_SPECTRUM_END\n");
         
-        free(magnitudes);
+        MEM_FREE(magnitudes);
     }
     
-    free(complex_values);
-    free(signal_buffer);
+    MEM_FREE(complex_values);
+    startup_first_pixel();
+}
+
+void process_patterns_batch(const uint8_t *bits_recv, int num_channels, int sample_divisor,
+                            uint8_t *values) {
+    if (!bits_recv || num_channels < 1) return;
+    if (num_channels > SIGNAL_MAX_BATCH) {
+        printf("Warning: batch of %d channels truncated to %d\n", num_channels, SIGNAL_MAX_BATCH);
+        num_channels = SIGNAL_MAX_BATCH;
+    }
+
+    // Records are back to back: [len, bits...] per channel
+    const int pattern_len = bits_recv[0];
+    const int record_len = pattern_len + 1;
+
+    float complex_values[SIGNAL_MAX_BATCH][41 * 2];
+    float magnitudes[SIGNAL_MAX_BATCH][41];
+
+    // DTFTs of all channels first (sampled bits only), then one shared pass
+    // over the lookup table
+    for (int c = 0; c < num_channels; c++) {
+        uint8_t samples[16];
+        extract_held_samples(&bits_recv[c * record_len], sample_divisor, samples);
+        decode_spectrum(samples, pattern_len, sample_divisor, complex_values[c]);
+        for (int k = 0; k < 41; k++) {
+            float real = complex_values[c][2*k];
+            float imag = complex_values[c][2*k + 1];
+            magnitudes[c][k] = real * real + imag * imag;  // Squared magnitude
+        }
+    }
+
+    reconstruct_pixel_values_batch((const float (*)[41])magnitudes,
+                                   (const float (*)[41 * 2])complex_values,
+                                   num_channels, values);
+    startup_first_pixel();
+}
+
+uint8_t process_pattern_lazy_return_value(uint8_t *bits_recv, int sample_divisor) {
+    if (!bits_recv || sample_divisor < 1) return 0;
+    if (bits_recv[0] != DTFT_BIT_DEPTH) {
+        return process_other_width(bits_recv, sample_divisor);
+    }
+    startup_tables_wait();
+    if (!lazy_matcher_ready && !init_lazy_matcher()) {
+        return process_pattern_zoh_return_value(bits_recv, sample_divisor);
+    }
+
+    uint8_t samples[16];
+    extract_held_samples(bits_recv, sample_divisor, samples);
+
+    lazy_spectrum_t spectrum;
+    if (!lazy_spectrum_init(&spectrum, samples, bits_recv[0], sample_divisor, decode_repetitions, 41)) {
+        return process_pattern_zoh_return_value(bits_recv, sample_divisor);
+    }
+    if (decode_repetitions != DTFT_N) {
+        lazy_spectrum_set_scale(&spectrum, repetition_scale);
+    }
+    uint8_t value = reconstruct_pixel_value_lazy(&spectrum);
+    startup_first_pixel();
+    return value;
+}
+
+void lazy_match_get_stats(uint32_t *pixels, uint32_t *bins_computed) {
+    *pixels = lazy_pixels;
+    *bins_computed = lazy_bins_total;
+}
+
+void lazy_match_reset_stats(void) {
+    lazy_pixels = 0;
+    lazy_bins_total = 0;
+}
+
+uint8_t process_pattern_soft_return_value(const uint8_t *counts, int oversample, float *confidence) {
+    if (!counts || oversample < 1) {
+        if (confidence) *confidence = 0.0f;
+        return 0;
+    }
+
+    // DTFT is linear: transform the counts, then scale to fractional bit levels
+    const int pattern_len = counts[0];
+    const float scale = 1.0f / oversample;
+    float complex_values[41 * 2];
+    calculate_dtft_repeated(&counts[1], pattern_len, decode_repetitions, 41, complex_values);
+    normalize_spectrum(complex_values);
+    for (int k = 0; k < 41; k++) {
+        complex_values[2*k] *= scale;
+        complex_values[2*k + 1] *= scale;
+    }
+
+    // Soft values fall between table entries, so magnitude classes cannot be
+    // preselected reliably: compare complex spectra against every entry, over
+    // the informative bins only (the others are zero in every entry)
+    startup_tables_wait();
+    bool informative_only = lazy_matcher_ready || init_lazy_matcher();
+    float best_distance = INFINITY;
+    float second_distance = INFINITY;
+    uint8_t best_match = 0;
+    uint8_t second_match = 0;
+    for (int value = 0; value < 256; value++) {
+        float distance = informative_only ? soft_table_distance(complex_values, value)
+                                          : complex_table_distance(complex_values, value);
+        if (distance < best_distance) {
+            second_distance = best_distance;
+            second_match = best_match;
+            best_distance = distance;
+            best_match = value;
+        } else if (distance < second_distance) {
+            second_distance = distance;
+            second_match = value;
+        }
+    }
+
+    // Position between the two candidates: (d2 - d1) / |best - second|^2 is
+    // 1 on the best entry and 0 halfway to the runner-up, whatever the noise
+    // on bits both candidates agree on
+    if (confidence) {
+        float best_values[41 * 2];
+        for (int k = 0; k < 41; k++) {
+            const DTFTPoint point = dtft_table_point(best_match, k);
+            float amplitude = sqrtf(point.magnitude);
+            best_values[2*k] = amplitude * cosf(point.phase);
+            best_values[2*k + 1] = amplitude * sinf(point.phase);
+        }
+        float separation = informative_only ? soft_table_distance(best_values, second_match)
+                                            : complex_table_distance(best_values, second_match);
+        *confidence = separation > 0.0f ? (second_distance - best_distance) / separation : 0.0f;
+        if (*confidence > 1.0f) *confidence = 1.0f;
+    }
+    startup_first_pixel();
+    return best_match;
 }
@@ -2,12 +2,13 @@
 #define SIGNAL_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * Repeat a bit pattern N times to create a signal buffer
  * @param pattern Input bit pattern (first element contains the pattern length)
  * @param repetitions Number of times to repeat
- * @return Buffer of size pattern_len * repetitions (caller must free)
+ * @return Buffer of size pattern_len * repetitions (caller frees with MEM_FREE())
  */
 uint8_t* repeat_pattern(uint8_t *pattern, int repetitions);
 
@@ -19,11 +20,173 @@ void process_pattern(uint8_t *bits_sent);
 
 /**
  * Process a single pattern and return reconstructed pixel value
+ * Patterns of 1-7 bits are decoded with their own table
+ * (process_pattern_width_return_value()); wider ones are rejected and need
+ * that function
  * @param bits_sent Bit pattern array (first element is length)
  * @return Reconstructed pixel value (0-255)
  */
 uint8_t process_pattern_return_value(uint8_t *bits_sent);
 
+/**
+ * Reconstruct a pixel from a sample-and-hold record using only the sampled bits
+ * (calculate_dtft_zoh); same result as process_pattern_return_value() on the
+ * held record with sample_divisor times less DTFT work. Records of other
+ * widths go to process_pattern_width_return_value() (1-7 bits only).
+ * @param bits_recv Array where first element is length, rest are held bit values
+ * @param sample_divisor Sampling rate divisor used by the receiver
+ * @return Reconstructed pixel value (0-255)
+ */
+uint8_t process_pattern_zoh_return_value(uint8_t *bits_recv, int sample_divisor);
+
+/**
+ * Reconstruct pixel value searching outward from a predicted value
+ * Candidates are visited seed, seed +- 1, seed +- 2, ...; entries whose
+ * spectrum norm alone rules them out are skipped, and the search stops once
+ * that norm bound rules out every candidate left. Same result as the
+ * full 0-255 scan; with a good seed few candidates are evaluated.
+ * @param computed_magnitudes Computed DTFT squared magnitudes (41 points)
+ * @param complex_values Computed DTFT complex values (41 points, for tie-breaks)
+ * @param seed Predicted value (previous pixel or the pixel above)
+ * @return Best matching pixel value (0-255)
+ */
+uint8_t reconstruct_pixel_value_seeded(const float *computed_magnitudes, const float *complex_values,
+                                       uint8_t seed);
+
+// reconstruct_pixel_value_seeded() split into steps, for callers that must
+// return between candidates (see coop_image.c)
+typedef struct {
+    float dc;               // Norm terms of the computed spectrum
+    float rest;
+    float min_distance;
+    uint8_t seed;
+    uint8_t best_match;
+    int radius;             // Next radius to visit
+    uint32_t evaluated;
+    bool done;
+} seeded_search_t;
+
+/**
+ * Start a seeded search
+ * @param search Search state
+ * @param computed_magnitudes Computed DTFT squared magnitudes (41 points), kept
+ *                            unchanged until seeded_search_finish()
+ * @param seed Predicted value
+ */
+void seeded_search_begin(seeded_search_t *search, const float *computed_magnitudes, uint8_t seed);
+
+/**
+ * Continue a seeded search by about max_candidates evaluated candidates (a
+ * radius is visited whole, so one more may be evaluated)
+ * @param search Search state
+ * @param computed_magnitudes As passed to seeded_search_begin()
+ * @param max_candidates Candidates to evaluate in this step
+ * @return true once the search is done
+ */
+bool seeded_search_step(seeded_search_t *search, const float *computed_magnitudes,
+                        int max_candidates);
+
+/**
+ * Best match of a finished search, after the phase tie-break
+ * @param search Search state (seeded_search_step() returned true)
+ * @param complex_values Computed DTFT complex values (41 points)
+ * @return Reconstructed pixel value (0-255)
+ */
+uint8_t seeded_search_finish(const seeded_search_t *search, const float *complex_values);
+
+/**
+ * Spectrum half of process_pattern_seeded_return_value(), for callers that
+ * decode in two slices: the 41 bins of a held record and their squared
+ * magnitudes, ready for reconstruct_pixel_value_seeded()
+ * @param bits_recv Array where first element is length, rest are held bit values
+ * @param sample_divisor Sampling rate divisor used by the receiver (>= 1)
+ * @param complex_values Output: 41 bins [real, imag]
+ * @param magnitudes Output: 41 squared magnitudes
+ */
+void decode_pattern_spectrum(const uint8_t *bits_recv, int sample_divisor, float *complex_values,
+                             float *magnitudes);
+
+/**
+ * process_pattern_zoh_return_value() with the seeded candidate search
+ * (8-bit records; other widths decode as process_pattern_zoh_return_value())
+ * @param bits_recv Array where first element is length, rest are held bit values
+ * @param sample_divisor Sampling rate divisor used by the receiver
+ * @param seed Predicted value (previous pixel or the pixel above)
+ * @return Reconstructed pixel value (0-255)
+ */
+uint8_t process_pattern_seeded_return_value(uint8_t *bits_recv, int sample_divisor, uint8_t seed);
+
+/**
+ * Reconstruct a reduced bit depth level (1-7 bit record, dtft_depth_table())
+ * Only the harmonic bins of the depth's grid are computed and matched by
+ * complex distance against its 2^bits entries, so DTFT and matching work
+ * shrink with the depth.
+ * @param bits_recv Array where first element is length (the depth), rest are held bit values
+ * @param sample_divisor Sampling rate divisor used by the receiver
+ * @return Reconstructed level (0 to 2^bits - 1)
+ */
+uint8_t process_pattern_depth_return_value(uint8_t *bits_recv, int sample_divisor);
+
+/**
+ * Reconstruct a value of any width from 1 to 16 bits
+ * 8 bits use the n10 matcher (process_pattern_zoh_return_value()), 1-7 bits
+ * their reduced depth table and 9-16 bits a table generated into RAM on first
+ * use and cached (width_table.h), so records of mixed widths decode in turn.
+ * @param bits_recv Array where first element is length (the width), rest are held bit values
+ * @param sample_divisor Sampling rate divisor used by the receiver
+ * @return Reconstructed value (0 to 2^width - 1)
+ */
+uint16_t process_pattern_width_return_value(uint8_t *bits_recv, int sample_divisor);
+
+/**
+ * Reconstruct a pixel pulling DTFT bins on demand (lazy_spectrum.h): bins are
+ * requested in order of how well they discriminate the lookup entries and
+ * matching stops as soon as the winner is certain. Same result as
+ * process_pattern_zoh_return_value(), also for records of other widths.
+ * @param bits_recv Array where first element is length, rest are held bit values
+ * @param sample_divisor Sampling rate divisor used by the receiver
+ * @return Reconstructed pixel value (0-255)
+ */
+uint8_t process_pattern_lazy_return_value(uint8_t *bits_recv, int sample_divisor);
+
+/**
+ * Reconstruct a pixel from soft receiver counts and rate the decision
+ * The spectrum of the fractional bit levels (counts / oversample) is matched
+ * by complex distance against every table entry. Confidence is the position
+ * between the best and second-best entry, (d_second - d_best) / |best - second|^2:
+ * 1 on the best entry, 0 halfway to the runner-up.
+ * @param counts Array where first element is length, rest are high-read counts
+ *               (send_receive_data_soft(), or several attempts summed)
+ * @param oversample Reads per bit the counts were accumulated over
+ * @param confidence Output: decision confidence in [0, 1] (may be NULL)
+ * @return Reconstructed pixel value (0-255)
+ */
+uint8_t process_pattern_soft_return_value(const uint8_t *counts, int oversample, float *confidence);
+
+/**
+ * Bins computed by process_pattern_lazy_return_value() since the last reset
+ * @param pixels Output: pixels decoded
+ * @param bins_computed Output: DTFT bins evaluated over those pixels
+ */
+void lazy_match_get_stats(uint32_t *pixels, uint32_t *bins_computed);
+
+/**
+ * Reset the lazy matcher counters
+ */
+void lazy_match_reset_stats(void);
+
+/**
+ * Candidates evaluated by reconstruct_pixel_value_seeded() since the last reset
+ * @param pixels Output: pixels decoded
+ * @param candidates Output: lookup entries whose distance was computed
+ */
+void seeded_match_get_stats(uint32_t *pixels, uint32_t *candidates);
+
+/**
+ * Reset the seeded search counters
+ */
+void seeded_match_reset_stats(void);
+
 /**
  * Process pattern and output DTFT magnitude spectrum (for PC-side reconstruction)
  * @param bits_sent Array where first element is length, rest are bit values
@@ -33,6 +196,44 @@ uint8_t process_pattern_return_value(uint8_t *bits_sent);
  */
 void process_pattern_output_spectrum(uint8_t *bits_sent, int pixel_idx, int x, int y);
 
+// Most channels process_patterns_batch() handles per call
+#define SIGNAL_MAX_BATCH 8
+
+/**
+ * Process patterns received on several channels and return one value per channel
+ * The DTFTs are computed back to back, then the lookup table is scanned once
+ * with every row compared against all channels
+ * @param bits_recv num_channels records as returned by send_receive_data_multi()
+ * @param num_channels Number of channels (1-SIGNAL_MAX_BATCH)
+ * @param sample_divisor Receiver sampling rate divisor (only sampled bits are transformed)
+ * @param values Output: reconstructed value per channel
+ */
+void process_patterns_batch(const uint8_t *bits_recv, int num_channels, int sample_divisor,
+                            uint8_t *values);
+
+/**
+ * Set the number of periods the received pattern is transformed over
+ * (default DTFT_N, the lookup table's). Each bin is scaled by the ratio of the
+ * table's repetition gain to this one, so every matcher decides as on the n10
+ * path; with 1 the transform runs over a single period and only the bins the
+ * table uses are computed. Set before decoding starts.
+ * @param repetitions Periods (>= 1)
+ * @return false if repetitions is invalid or cancels a bin the table uses
+ */
+bool set_decode_repetitions(int repetitions);
+
+/**
+ * Periods the received pattern is transformed over (set_decode_repetitions())
+ */
+int get_decode_repetitions(void);
+
+/**
+ * Build the matchers' tables from the lookup table (magnitude classes, seeded
+ * search ranges, lazy bin order and bounds); each is otherwise built on the
+ * first pixel that needs it. Safe to run on Core1 before any decoding starts.
+ */
+void init_matcher_tables(void);
+
 /**
  * Initialize the ARM DWT cycle counter for performance measurement
  * Call this once at startup before measuring cycles
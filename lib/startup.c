@@ -0,0 +1,93 @@
+#include "startup.h"
+#include "dtft.h"
+#include "signal.h"
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include <stdio.h>
+
+// Steps per core; a step is committed (num_steps incremented) when it ends
+static startup_step_t steps[2][STARTUP_MAX_STEPS];
+static volatile int num_steps[2];
+static volatile bool profiling = false;
+static bool tables_on_core1 = false;
+static uint32_t first_pixel_us = 0;
+
+void startup_step_begin(const char *name) {
+    unsigned int core = get_core_num() & 1;
+    int i = num_steps[core];
+    if (i >= STARTUP_MAX_STEPS) {
+        return;
+    }
+    steps[core][i].name = name;
+    steps[core][i].start_us = time_us_32();
+    steps[core][i].end_us = steps[core][i].start_us;
+    profiling = true;
+}
+
+void startup_step_end(void) {
+    unsigned int core = get_core_num() & 1;
+    int i = num_steps[core];
+    if (i >= STARTUP_MAX_STEPS) {
+        return;
+    }
+    steps[core][i].end_us = time_us_32();
+    num_steps[core] = i + 1;
+}
+
+/**
+ * Matcher tables, timed as a step of the core building them
+ */
+static void build_tables(void *arg) {
+    (void)arg;
+    startup_step_begin("matcher tables");
+    init_matcher_tables();
+    startup_step_end();
+}
+
+void startup_tables_begin(void) {
+    tables_on_core1 = core1_run(build_tables, NULL);
+    if (!tables_on_core1) {
+        build_tables(NULL);
+    }
+}
+
+void startup_tables_wait(void) {
+    if (!tables_on_core1) {
+        return;
+    }
+    startup_step_begin("wait for core1 tables");
+    core1_wait();
+    startup_step_end();
+    tables_on_core1 = false;
+}
+
+void startup_first_pixel(void) {
+    if (!profiling || first_pixel_us) {
+        return;
+    }
+    first_pixel_us = time_us_32();
+    if (!first_pixel_us) {
+        first_pixel_us = 1;
+    }
+    startup_print_report();
+}
+
+uint32_t startup_first_pixel_us(void) {
+    return first_pixel_us;
+}
+
+void startup_print_report(void) {
+    printf("\n=== STARTUP ===\n");
+    printf("%-5s %-22s %10s %10s\n", "core", "step", "start_us", "time_us");
+    for (int core = 0; core < 2; core++) {
+        for (int i = 0; i < num_steps[core]; i++) {
+            const startup_step_t *step = &steps[core][i];
+            printf("%-5d %-22s %10lu %10lu\n", core, step->name, (unsigned long)step->start_us,
+                   (unsigned long)(step->end_us - step->start_us));
+        }
+    }
+    if (first_pixel_us) {
+        printf("STARTUP_FIRST_PIXEL_US=%lu\n", (unsigned long)first_pixel_us);
+    }
+    printf("===============\n\n");
+}
@@ -0,0 +1,60 @@
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Startup profiling and table initialization. Each init step at boot is timed
+// per core. The matcher tables are built on Core1 while Core0 brings up stdio
+// and the GPIOs and sends the first pixel; the first matcher that needs them
+// waits for Core1 (startup_tables_wait()). Times are from the timer start in
+// the SDK runtime init, so bootrom and flash boot time are not included.
+#define STARTUP_MAX_STEPS 12
+
+typedef struct {
+    const char *name;
+    uint32_t start_us;
+    uint32_t end_us;
+} startup_step_t;
+
+/**
+ * Start timing a boot step on the calling core
+ * @param name Step name (string literal, kept by reference)
+ */
+void startup_step_begin(const char *name);
+
+/**
+ * End the calling core's current boot step
+ */
+void startup_step_end(void);
+
+/**
+ * Build the matcher tables (init_matcher_tables()): on Core1 if its worker is
+ * running (init_core1_dtft()), otherwise on the calling core before returning
+ */
+void startup_tables_begin(void);
+
+/**
+ * Wait until the tables started with startup_tables_begin() are built
+ * Returns at once if they are; called by the matchers before using them.
+ */
+void startup_tables_wait(void);
+
+/**
+ * Record boot to first decoded pixel and print the startup report
+ * Only the first call after a startup step was recorded does anything.
+ */
+void startup_first_pixel(void);
+
+/**
+ * Boot to first decoded pixel
+ * @return Microseconds, 0 if no pixel was decoded yet
+ */
+uint32_t startup_first_pixel_us(void);
+
+/**
+ * Print each core's boot steps and the boot to first pixel time
+ */
+void startup_print_report(void);
+
+#endif // STARTUP_H
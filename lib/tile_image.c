@@ -0,0 +1,111 @@
+#include "tile_image.h"
+#include "pico/stdlib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Working buffers: the only per-image memory
+static uint8_t tile_source[TILE_MAX_PIXELS];
+static uint8_t tile_result[TILE_MAX_PIXELS];
+
+bool tile_image_process(image_reader_t *reader, tile_pixel_fn process, tile_output_fn output,
+                        void *ctx, tile_image_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+
+    if (reader->tile_width * reader->tile_height > TILE_MAX_PIXELS) {
+        printf("Error: %lux%lu tiles exceed TILE_MAX_PIXELS (%d)\n",
+               (unsigned long)reader->tile_width, (unsigned long)reader->tile_height, TILE_MAX_PIXELS);
+        return false;
+    }
+
+    const uint32_t num_tiles = image_reader_tile_count(reader);
+    absolute_time_t image_start = get_absolute_time();
+
+    for (uint32_t t = 0; t < num_tiles; t++) {
+        image_tile_t tile;
+        image_reader_tile_rect(reader, t, &tile);
+        const uint32_t tile_pixels = tile.width * tile.height;
+
+        if (image_reader_read(reader, tile_source, tile_pixels) != tile_pixels) {
+            printf("Error: image asset ended in tile %lu\n", (unsigned long)t);
+            return false;
+        }
+
+        tile_stats_t tile_stats = {.pixels = tile_pixels};
+        absolute_time_t tile_start = get_absolute_time();
+
+        for (uint32_t i = 0; i < tile_pixels; i++) {
+            uint8_t reconstructed = process(tile_source[i], ctx);
+            tile_result[i] = reconstructed;
+            if (reconstructed == tile_source[i]) {
+                tile_stats.correct++;
+            } else {
+                tile_stats.total_error += abs((int)tile_source[i] - (int)reconstructed);
+            }
+        }
+        tile_stats.time_us = absolute_time_diff_us(tile_start, get_absolute_time());
+
+        stats->tiles++;
+        stats->pixels += tile_pixels;
+        stats->correct += tile_stats.correct;
+        stats->total_error += tile_stats.total_error;
+        uint32_t tile_errors = tile_pixels - tile_stats.correct;
+        if (tile_errors > stats->worst_tile_errors) {
+            stats->worst_tile_errors = tile_errors;
+            stats->worst_tile = t;
+        }
+
+        if (output) {
+            output(&tile, tile_result, &tile_stats, ctx);
+        }
+    }
+
+    stats->time_us = absolute_time_diff_us(image_start, get_absolute_time());
+    return true;
+}
+
+void tile_image_print_tile(const image_tile_t *tile, const uint8_t *pixels,
+                           const tile_stats_t *stats, void *ctx) {
+    (void)ctx;
+    printf("TILE_START %lu X=%lu Y=%lu W=%lu H=%lu\n",
+           (unsigned long)tile->index, (unsigned long)tile->x, (unsigned long)tile->y,
+           (unsigned long)tile->width, (unsigned long)tile->height);
+
+    // One tile row per line
+    for (uint32_t row = 0; row < tile->height; row++) {
+        const uint8_t *line = &pixels[row * tile->width];
+        for (uint32_t col = 0; col < tile->width; col++) {
+            printf("%02X", line[col]);
+        }
+        printf("\n");
+    }
+
+    printf("TILE_END %lu CORRECT=%lu PIXELS=%lu ERROR=%llu TIME_US=%lld\n",
+           (unsigned long)tile->index, (unsigned long)stats->correct, (unsigned long)stats->pixels,
+           (unsigned long long)stats->total_error, (long long)stats->time_us);
+}
+
+void tile_image_print_header(const image_reader_t *reader) {
+    printf("TILED_IMAGE_START WIDTH=%lu HEIGHT=%lu TILE_WIDTH=%lu TILE_HEIGHT=%lu TILES=%lu\n",
+           (unsigned long)reader->header.width, (unsigned long)reader->header.height,
+           (unsigned long)reader->tile_width, (unsigned long)reader->tile_height,
+           (unsigned long)image_reader_tile_count(reader));
+}
+
+void tile_image_print_summary(const tile_image_stats_t *stats) {
+    uint64_t incorrect = stats->pixels - stats->correct;
+
+    printf("\n========== TILED PROCESSING COMPLETE ==========\n");
+    printf("Tiles: %lu, pixels: %llu\n", (unsigned long)stats->tiles, (unsigned long long)stats->pixels);
+    printf("Total time: %.2f seconds (%.2f ms per pixel)\n", stats->time_us / 1000000.0f,
+           stats->pixels > 0 ? stats->time_us / (float)stats->pixels / 1000.0f : 0.0f);
+    printf("Correct reconstructions: %llu/%llu (%.2f%%)\n",
+           (unsigned long long)stats->correct, (unsigned long long)stats->pixels,
+           stats->pixels > 0 ? (float)stats->correct * 100.0f / stats->pixels : 0.0f);
+    printf("Average error per incorrect pixel: %.2f\n",
+           incorrect > 0 ? (float)stats->total_error / incorrect : 0.0f);
+    printf("Worst tile: %lu (%lu mismatches)\n",
+           (unsigned long)stats->worst_tile, (unsigned long)stats->worst_tile_errors);
+    printf("Working memory: %u bytes of tile buffers\n", (unsigned)(2 * TILE_MAX_PIXELS));
+    printf("===============================================\n\n");
+}
@@ -0,0 +1,80 @@
+#ifndef TILE_IMAGE_H
+#define TILE_IMAGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "image_asset.h"
+
+// Tile-based image processing: source tiles are streamed from the asset,
+// transmitted and decoded pixel by pixel, and streamed out, so working memory
+// is two tile buffers regardless of the image size.
+#define TILE_MAX_PIXELS 4096
+
+// Statistics of one tile
+typedef struct {
+    uint32_t pixels;
+    uint32_t correct;
+    uint64_t total_error;    // Sum of |original - reconstructed| over mismatches
+    int64_t time_us;
+} tile_stats_t;
+
+// Statistics of a whole image
+typedef struct {
+    uint32_t tiles;
+    uint64_t pixels;
+    uint64_t correct;
+    uint64_t total_error;
+    int64_t time_us;
+    uint32_t worst_tile;     // Tile with the most mismatches
+    uint32_t worst_tile_errors;
+} tile_image_stats_t;
+
+/**
+ * Transmit and decode one pixel
+ * @param value Original pixel value
+ * @param ctx User context
+ * @return Reconstructed pixel value
+ */
+typedef uint8_t (*tile_pixel_fn)(uint8_t value, void *ctx);
+
+/**
+ * Receive a finished tile
+ * @param tile Tile geometry
+ * @param pixels Reconstructed pixels (tile->width * tile->height, raster order)
+ * @param stats Tile statistics
+ * @param ctx User context
+ */
+typedef void (*tile_output_fn)(const image_tile_t *tile, const uint8_t *pixels,
+                               const tile_stats_t *stats, void *ctx);
+
+/**
+ * Process an image tile by tile
+ * @param reader Open reader positioned at the first pixel
+ * @param process Pixel transfer function
+ * @param output Tile sink (e.g. tile_image_print_tile)
+ * @param ctx Passed to process and output
+ * @param stats Output: image statistics
+ * @return false if a tile exceeds TILE_MAX_PIXELS or the asset ends early
+ */
+bool tile_image_process(image_reader_t *reader, tile_pixel_fn process, tile_output_fn output,
+                        void *ctx, tile_image_stats_t *stats);
+
+/**
+ * Tile sink that prints a TILE_START/TILE_END block (see reassemble_tiles.py)
+ */
+void tile_image_print_tile(const image_tile_t *tile, const uint8_t *pixels,
+                           const tile_stats_t *stats, void *ctx);
+
+/**
+ * Print the TILED_IMAGE_START line describing the tile grid
+ * @param reader Open reader
+ */
+void tile_image_print_header(const image_reader_t *reader);
+
+/**
+ * Print image statistics
+ * @param stats Image statistics
+ */
+void tile_image_print_summary(const tile_image_stats_t *stats);
+
+#endif // TILE_IMAGE_H
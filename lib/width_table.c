@@ -0,0 +1,202 @@
+#include "width_table.h"
+#include "dtft_table.h"
+#include "mem_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define WIDTH_TABLE_SLOTS (WIDTH_TABLE_MAX_BITS - WIDTH_TABLE_MIN_BITS + 1)
+
+typedef struct {
+    width_table_t table;
+    float *data;            // entries or inverse, NULL while not cached
+    uint32_t last_use;
+} width_slot_t;
+
+static width_slot_t slots[WIDTH_TABLE_SLOTS];
+static size_t budget = WIDTH_TABLE_DEFAULT_BUDGET;
+static uint32_t use_clock = 0;
+static width_table_stats_t stats;
+
+static void evict(width_slot_t *slot) {
+    stats.bytes -= slot->table.bytes;
+    MEM_FREE(slot->data);
+    slot->data = NULL;
+}
+
+/**
+ * Evict least recently used tables until bytes more fit within the budget
+ */
+static void make_room(size_t bytes) {
+    while (stats.bytes + bytes > budget) {
+        width_slot_t *oldest = NULL;
+        for (int i = 0; i < WIDTH_TABLE_SLOTS; i++) {
+            if (slots[i].data && (!oldest || slots[i].last_use < oldest->last_use)) {
+                oldest = &slots[i];
+            }
+        }
+        if (!oldest) {
+            return;
+        }
+        evict(oldest);
+        stats.evictions++;
+    }
+}
+
+/**
+ * Harmonics of every value: X_h = DTFT_N · Σ_n b_n e^{-j2πhn/bits}, bit n MSB first
+ * (the repetition gain at a harmonic is DTFT_N)
+ */
+static void generate_entries(int bits, int num_harmonics, float *entries) {
+    double tw_re[WIDTH_TABLE_MAX_BITS / 2 + 1][WIDTH_TABLE_MAX_BITS];
+    double tw_im[WIDTH_TABLE_MAX_BITS / 2 + 1][WIDTH_TABLE_MAX_BITS];
+    for (int h = 0; h < num_harmonics; h++) {
+        for (int n = 0; n < bits; n++) {
+            int phase = (h * n) % bits;
+            tw_re[h][n] = phase ? DTFT_N * cos(2.0 * M_PI * phase / bits) : DTFT_N;
+            tw_im[h][n] = phase ? -DTFT_N * sin(2.0 * M_PI * phase / bits) : 0.0;
+        }
+    }
+    for (int value = 0; value < 1 << bits; value++) {
+        for (int h = 0; h < num_harmonics; h++) {
+            double re = 0.0;
+            double im = 0.0;
+            for (int n = 0; n < bits; n++) {
+                if ((value >> (bits - 1 - n)) & 1) {
+                    re += tw_re[h][n];
+                    im += tw_im[h][n];
+                }
+            }
+            *entries++ = (float)re;
+            *entries++ = (float)im;
+        }
+    }
+}
+
+/**
+ * Inverse of the harmonics: b_n = Σ_h c_h Re(X_h e^{j2πhn/bits}) / (DTFT_N·bits)
+ * with c_h = 2 for the bins that stand for a conjugate pair, 1 for DC and
+ * (even widths) the bin at π
+ */
+static void generate_inverse(int bits, int num_harmonics, float *inverse) {
+    for (int n = 0; n < bits; n++) {
+        for (int h = 0; h < num_harmonics; h++) {
+            double weight = (h == 0 || 2 * h == bits ? 1.0 : 2.0) / (DTFT_N * bits);
+            int phase = (h * n) % bits;
+            double angle = 2.0 * M_PI * phase / bits;
+            *inverse++ = (float)(phase ? weight * cos(angle) : weight);
+            *inverse++ = (float)(phase ? -weight * sin(angle) : 0.0);
+        }
+    }
+}
+
+const width_table_t *width_table_get(int bits) {
+    if (bits < WIDTH_TABLE_MIN_BITS || bits > WIDTH_TABLE_MAX_BITS) {
+        return NULL;
+    }
+    width_slot_t *slot = &slots[bits - WIDTH_TABLE_MIN_BITS];
+    slot->last_use = ++use_clock;
+    if (slot->data) {
+        stats.hits++;
+        return &slot->table;
+    }
+
+    // Entries when they fit the budget, otherwise the (much smaller) decode map
+    const int num_harmonics = bits / 2 + 1;
+    const size_t entry_bytes = ((size_t)1 << bits) * num_harmonics * 2 * sizeof(float);
+    const bool has_entries = bits <= WIDTH_TABLE_ENTRY_MAX_BITS && entry_bytes <= budget;
+    const size_t bytes = has_entries ? entry_bytes : (size_t)bits * num_harmonics * 2 * sizeof(float);
+    if (bytes > budget) {
+        printf("Error: %d-bit decode table needs %zu bytes, budget is %zu\n", bits, bytes, budget);
+        return NULL;
+    }
+    make_room(bytes);
+    slot->data = MEM_MALLOC(bytes);
+    if (!slot->data) {
+        printf("Error: out of memory for the %d-bit decode table\n", bits);
+        return NULL;
+    }
+
+    if (has_entries) {
+        generate_entries(bits, num_harmonics, slot->data);
+    } else {
+        generate_inverse(bits, num_harmonics, slot->data);
+    }
+    slot->table.bits = bits;
+    slot->table.num_bins = DTFT_N * bits / 2 + 1;
+    slot->table.num_harmonics = num_harmonics;
+    slot->table.entries = has_entries ? slot->data : NULL;
+    slot->table.inverse = has_entries ? NULL : slot->data;
+    slot->table.bytes = bytes;
+
+    stats.misses++;
+    stats.bytes += bytes;
+    if (stats.bytes > stats.peak_bytes) {
+        stats.peak_bytes = stats.bytes;
+    }
+    return &slot->table;
+}
+
+uint16_t width_table_decode(const width_table_t *table, const float *harmonics) {
+    const int stride = 2 * table->num_harmonics;
+
+    if (!table->entries) {
+        // Decode map: each bit from the inverse transform, thresholded at 1/2
+        const float *weights = table->inverse;
+        uint16_t value = 0;
+        for (int n = 0; n < table->bits; n++, weights += stride) {
+            float level = 0.0f;
+            for (int i = 0; i < stride; i += 2) {
+                level += weights[i] * harmonics[i] + weights[i + 1] * harmonics[i + 1];
+            }
+            value = (uint16_t)(value << 1) | (level > 0.5f);
+        }
+        return value;
+    }
+
+    // Complex distance to every entry
+    const int num_values = 1 << table->bits;
+    const float *entry = table->entries;
+    float min_distance = INFINITY;
+    uint16_t best_match = 0;
+    for (int value = 0; value < num_values; value++, entry += stride) {
+        float distance = 0.0f;
+        for (int i = 0; i < stride; i++) {
+            float diff = harmonics[i] - entry[i];
+            distance += diff * diff;
+        }
+        if (distance < min_distance) {
+            min_distance = distance;
+            best_match = value;
+        }
+    }
+    return best_match;
+}
+
+void width_table_set_budget(size_t bytes) {
+    budget = bytes;
+    make_room(0);
+}
+
+size_t width_table_budget(void) {
+    return budget;
+}
+
+void width_table_clear(void) {
+    for (int i = 0; i < WIDTH_TABLE_SLOTS; i++) {
+        if (slots[i].data) {
+            evict(&slots[i]);
+        }
+    }
+}
+
+void width_table_get_stats(width_table_stats_t *out) {
+    *out = stats;
+}
+
+void width_table_reset_stats(void) {
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.evictions = 0;
+    stats.peak_bytes = stats.bytes;
+}
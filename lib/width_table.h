@@ -0,0 +1,85 @@
+#ifndef WIDTH_TABLE_H
+#define WIDTH_TABLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Decode tables for pattern widths with no table in flash (9-16 bits; 1-7 bits
+// use dtft_depth_table(), 8 bits the n10 table). A width's table is generated
+// into RAM the first time it is needed and kept in an LRU cache within a byte
+// budget, so a stream mixing widths reuses them without recompiling anything.
+// Tables use the reduced depth layout: the harmonic bins k = h*DTFT_N of the
+// value repeated DTFT_N times, on DTFT_N*bits/2 + 1 points from 0 to π.
+// Up to WIDTH_TABLE_ENTRY_MAX_BITS (and within the budget) every value's
+// harmonics are stored and matched by complex distance, as with the depth
+// tables. Wider entry tables would not fit (4.7 MB at 16 bits), so those
+// widths store a decode map instead: the inverse transform from the harmonics
+// to the bits, which are thresholded one by one (the nearest value sample by
+// sample; the same value for received bits).
+#define WIDTH_TABLE_MIN_BITS 9
+#define WIDTH_TABLE_MAX_BITS 16
+#define WIDTH_TABLE_ENTRY_MAX_BITS 9                // 20 KB of entries
+#define WIDTH_TABLE_DEFAULT_BUDGET (32 * 1024)      // Every width fits
+
+typedef struct {
+    int bits;               // Bits per value
+    int num_bins;           // Grid points from 0 to π
+    int num_harmonics;      // Bins k = h * DTFT_N, h = 0..bits/2
+    const float *entries;   // [1 << bits][num_harmonics][re, im], or NULL
+    const float *inverse;   // Decode map [bits][num_harmonics][weight of re, of im], or NULL
+    size_t bytes;           // RAM held by the table
+} width_table_t;
+
+typedef struct {
+    uint32_t hits;          // Lookups served from the cache
+    uint32_t misses;        // Tables generated
+    uint32_t evictions;     // Tables dropped to stay within the budget
+    size_t bytes;           // RAM held by cached tables
+    size_t peak_bytes;
+} width_table_stats_t;
+
+/**
+ * Table for a width, generated on first use
+ * Generating may evict the least recently used tables, so the pointer is
+ * valid until the next width_table_get()
+ * @param bits Bits per value (WIDTH_TABLE_MIN_BITS-WIDTH_TABLE_MAX_BITS)
+ * @return Table, or NULL for other widths, a table larger than the budget or out of memory
+ */
+const width_table_t *width_table_get(int bits);
+
+/**
+ * Value whose spectrum is closest to the given harmonics
+ * @param table Table from width_table_get()
+ * @param harmonics [re, im] of bins k = h * DTFT_N (num_harmonics * 2 floats)
+ * @return Decoded value (0 to 2^bits - 1)
+ */
+uint16_t width_table_decode(const width_table_t *table, const float *harmonics);
+
+/**
+ * Set the RAM budget of the cache, evicting tables until it holds
+ * @param bytes Budget in bytes
+ */
+void width_table_set_budget(size_t bytes);
+
+/**
+ * Current RAM budget of the cache
+ */
+size_t width_table_budget(void);
+
+/**
+ * Free every cached table
+ */
+void width_table_clear(void);
+
+/**
+ * Cache counters since the last reset
+ */
+void width_table_get_stats(width_table_stats_t *stats);
+
+/**
+ * Reset the cache counters (cached tables are kept)
+ */
+void width_table_reset_stats(void);
+
+#endif // WIDTH_TABLE_H
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 
 // Module includes
 #include "lib/lut.h"
@@ -15,17 +16,38 @@
 #include "lib/gpio_control.h"
 #include "lib/signal.h"
 #include "lib/output.h"
-#include "lib/image_data.h"
+#include "lib/image_asset.h"
+#include "lib/receiver.h"
+#include "lib/tile_image.h"
+#include "lib/retransmit.h"
+#include "lib/link_adapt.h"
+#include "lib/dtft_stream.h"
+#include "lib/bit_depth.h"
+#include "lib/pixel_order.h"
+#include "lib/startup.h"
+#include "lib/coop_image.h"
+#include "lib/dtft_matrix.h"
+#include "lib/mem_stats.h"
 
-// Configuration: Number of pixels to transmit (set to IMAGE_SIZE for full image)
+// Configuration: Number of pixels to transmit (clamped to the image asset size)
 // Start with a smaller number for testing (e.g., 100-1000 pixels)
 #define PIXELS_TO_TRANSMIT 8100  // Adjust this value
 
+// Pixels pulled from the image asset reader per read call
+#define IMAGE_READ_CHUNK 64
+
 // Reconstruction mode:
 // 0 = Reconstruct on Pico (slower)
 // 1 = Output spectrum for PC-side reconstruction (faster)
 #define PC_RECONSTRUCTION 0
 
+// Pixel order of the image mode (lib/pixel_order.h): PIXEL_ORDER_RASTER, or
+// PIXEL_ORDER_ADAM7 / PIXEL_ORDER_MIPMAP for an early full-frame preview
+// (PARTIAL_DATA blocks at every progress step, render with progressive_preview.py),
+// PIXEL_ORDER_ZORDER / PIXEL_ORDER_HILBERT for locality. Non-raster orders
+// need the whole image in RAM (at most PIXELS_TO_TRANSMIT pixels)
+#define PIXEL_ORDER PIXEL_ORDER_RASTER
+
 // Verbose output (0 = minimal, 1 = full details)
 #define VERBOSE_OUTPUT 0
 
@@ -36,11 +58,64 @@
 // 8 = Eighth rate (sample every 8th bit = 1 bit)
 #define SAMPLING_RATE_DIVISOR 4
 
+// Receiver DTFT: 1 = transform only the sampled bits and apply the hold as a
+// per-bin factor (SAMPLING_RATE_DIVISOR times less work), 0 = full held signal
+#define ZOH_DTFT 1
+
+// Periods the received pattern is transformed over: 1 = a single period with
+// each bin scaled to the n10 lookup table's repetition gain (same decisions),
+// 10 = the table's own repetitions
+#define DECODE_REPETITIONS 1
+
+// Lazy bins: 1 = compute DTFT bins only as the coarse-to-fine matcher requests
+// them (implies the ZOH transform), 0 = full spectrum before matching
+#define LAZY_BINS 1
+
+// Seeded search (with LAZY_BINS 0): start the candidate search at the previous
+// pixel's value (the pixel above at row start) and stop once a norm bound rules
+// out the rest, 0 = scan all 256 candidates
+#define SEEDED_SEARCH 1
+
+// Receiver channels sampled together in receiver monitor mode (mode 2),
+// on the pins of RECEIVER_GPIO_LIST (1-MAX_RECEIVERS)
+#define NUM_RECEIVERS 4
+
+// Selective retransmission (mode 4): receiver reads per bit, confidence x
+// attempts below which a pixel is resent, and retry passes over the
+// low-confidence pixels (0.5: blanket 3x accuracy at about 2.1 sends per pixel
+// in host/sim/retransmit_demo)
+#define RX_OVERSAMPLE 8
+#define RETRANSMIT_THRESHOLD 0.5f
+#define RETRANSMIT_MAX_RETRIES 3
+
+// Adaptive link (mode 5): bit period and sampling divisor chosen per row from
+// probe patterns. Target is the mean absolute probe error in pixel levels
+#define ADAPT_ERROR_TARGET 1.0f
+#define ADAPT_PROBES 16
+#define ADAPT_INTERVAL_ROWS 4
+
+// Stream capture (mode 6): image pixels sent back to back as one bitstream,
+// its DTFT taken in blocks on both cores at STREAM_BINS points from 0 to π
+#define STREAM_CAPTURE_BITS 262144
+#define STREAM_BINS 41
+
+// Bit depth sweep (mode 7): the image sent at every depth from 1 to 8 bits per
+// pixel, then again at BIT_DEPTH_PREVIEW with its IMAGE_DATA block
+#define BIT_DEPTH_PREVIEW 4
+
 // Array to store reconstructed image pixels (only used if PC_RECONSTRUCTION = 0)
 #if !PC_RECONSTRUCTION
 static uint8_t reconstructed_image[PIXELS_TO_TRANSMIT];
 #endif
 
+// Source pixels for non-raster orders, which read the image out of sequence
+#if PIXEL_ORDER != PIXEL_ORDER_RASTER
+static uint8_t source_image[PIXELS_TO_TRANSMIT];
+#endif
+
+// Predicted value of the next pixel for the seeded search
+static uint8_t pixel_prediction = 0;
+
 /**
  * Process and reconstruct a single pixel value
  * @param pixel_value Original pixel value (0-255)
@@ -81,37 +156,169 @@ uint8_t process_pixel(uint8_t pixel_value) {
         printf("XOR of sampled bits: %d\n", static_ref_parity);
         
         // Process pattern and get reconstructed value
+#if LAZY_BINS
+        reconstructed = process_pattern_lazy_return_value(bits_recv, SAMPLING_RATE_DIVISOR);
+#elif SEEDED_SEARCH
+        reconstructed = process_pattern_seeded_return_value(bits_recv, SAMPLING_RATE_DIVISOR,
+                                                            pixel_prediction);
+#elif ZOH_DTFT
+        reconstructed = process_pattern_zoh_return_value(bits_recv, SAMPLING_RATE_DIVISOR);
+#else
         reconstructed = process_pattern_return_value(bits_recv);
-        free(bits_recv);
+#endif
+        MEM_FREE(bits_recv);
     }
     
     return reconstructed;
 }
 
+#if !PC_RECONSTRUCTION
+/**
+ * Print the reconstructed pixels as an IMAGE_DATA block (parse_reconstructed_image.py)
+ */
+static void print_image_data(int width, int height, int num_pixels) {
+    printf("\n========== RECONSTRUCTED IMAGE DATA ==========\n");
+    printf("IMAGE_DATA_START\n");
+    printf("WIDTH=%d\n", width);
+    printf("HEIGHT=%d\n", height);
+    printf("PIXELS=%d\n", num_pixels);
+    printf("DATA_HEX\n");
+    
+    // Print as hex values, 16 per line for easy copy-paste
+    for (int i = 0; i < num_pixels; i++) {
+        printf("%02X", reconstructed_image[i]);
+        if ((i + 1) % 16 == 0) {
+            printf("\n");
+        } else if (i < num_pixels - 1) {
+            printf(" ");
+        }
+    }
+    if (num_pixels % 16 != 0) {
+        printf("\n");
+    }
+    
+    printf("IMAGE_DATA_END\n");
+}
+
+#if PIXEL_ORDER != PIXEL_ORDER_RASTER
+/**
+ * Print the pixels decoded since the last progress step in transmission order
+ * as a PARTIAL_DATA block (progressive_preview.py places them with the same order)
+ * @param iter Order iterator at the first of those pixels, advanced past them
+ * @param start Transmission index of the first pixel
+ * @param count Pixels in the block
+ * @param width Image width
+ */
+static void print_partial_data(pixel_order_iter_t *iter, int start, int count, int width) {
+    printf("PARTIAL_DATA START=%d COUNT=%d\n", start, count);
+    for (int n = 0; n < count; n++) {
+        uint32_t x, y;
+        pixel_order_next(iter, &x, &y);
+        printf("%02X", reconstructed_image[y * width + x]);
+        if ((n + 1) % 16 == 0) {
+            printf("\n");
+        } else if (n < count - 1) {
+            printf(" ");
+        }
+    }
+    if (count % 16 != 0) {
+        printf("\n");
+    }
+    printf("PARTIAL_DATA_END\n");
+}
+#endif
+#endif
+
 /**
  * Transmit and reconstruct image
  * Sends pixels one by one and reconstructs the image
  */
 void transmit_reconstruct_image(void) {
+    // Stream source pixels from the image asset instead of a full-frame array
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return;
+    }
+    
+    const int image_width = reader.header.width;
+    const int image_height = reader.header.height;
+    const int image_size = image_width * image_height;
+    const int pixels_to_transmit = PIXELS_TO_TRANSMIT < image_size ? PIXELS_TO_TRANSMIT : image_size;
+    
     printf("\n========== IMAGE PROCESSING ==========\n");
-    printf("Image size: %dx%d = %d pixels\n", IMAGE_WIDTH, IMAGE_HEIGHT, IMAGE_SIZE);
-    printf("Processing: %d pixels\n", PIXELS_TO_TRANSMIT);
+    printf("Image size: %dx%d = %d pixels (%d-bit asset)\n",
+           image_width, image_height, image_size, reader.header.bits_per_pixel);
+    printf("Processing: %d pixels\n", pixels_to_transmit);
     printf("Mode: %s\n", PC_RECONSTRUCTION ? "PC reconstruction" : "Pico reconstruction");
+    printf("Order: %s\n", pixel_order_name(PIXEL_ORDER));
     printf("========================================\n\n");
     
+    pixel_order_iter_t order_iter;
+    if (!pixel_order_begin(&order_iter, PIXEL_ORDER, image_width, image_height)) {
+        return;
+    }
+#if PIXEL_ORDER == PIXEL_ORDER_RASTER
+    uint8_t chunk[IMAGE_READ_CHUNK];
+    int chunk_len = 0;
+    int chunk_pos = 0;
+#else
+    if (image_size > PIXELS_TO_TRANSMIT) {
+        printf("Error: %s order needs the whole image in RAM (at most %d pixels)\n",
+               pixel_order_name(PIXEL_ORDER), PIXELS_TO_TRANSMIT);
+        return;
+    }
+    if (image_reader_read(&reader, source_image, image_size) != (uint32_t)image_size) {
+        printf("Error: image asset is shorter than %d pixels\n", image_size);
+        return;
+    }
+#if !PC_RECONSTRUCTION
+    // Pixels not reached when the run stops early stay black
+    memset(reconstructed_image, 0, image_size);
+    pixel_order_iter_t partial_iter = order_iter;
+    int partial_start = 0;
+#endif
+#endif
+#if !PC_RECONSTRUCTION
+    // Accuracy is accumulated on the fly since the source is streamed
+    int correct = 0;
+    int total_error = 0;
+#endif
+    
     absolute_time_t start_time = get_absolute_time();
+    mem_stats_reset();
+#if LAZY_BINS
+    lazy_match_reset_stats();
+#elif SEEDED_SEARCH
+    seeded_match_reset_stats();
+    pixel_prediction = 0;
+#endif
     
     // Transmit and reconstruct each pixel
-    for (int i = 0; i < PIXELS_TO_TRANSMIT; i++) {
-        // Calculate (x, y) position in image
-        int x = i % IMAGE_WIDTH;
-        int y = i / IMAGE_WIDTH;
+    for (int i = 0; i < pixels_to_transmit; i++) {
+        // (x, y) position of the i-th pixel in transmission order
+        uint32_t x, y;
+        pixel_order_next(&order_iter, &x, &y);
+        const int position = y * image_width + x;
         
-        uint8_t original = image_data[i];
+#if PIXEL_ORDER == PIXEL_ORDER_RASTER
+        if (chunk_pos == chunk_len) {
+            chunk_len = image_reader_read(&reader, chunk, IMAGE_READ_CHUNK);
+            chunk_pos = 0;
+            if (chunk_len == 0) {
+                printf("Error: image asset ended at pixel %d\n", i);
+                break;
+            }
+        }
+        uint8_t original = chunk[chunk_pos++];
+#else
+        uint8_t original = source_image[position];
+#endif
         
 #if VERBOSE_OUTPUT
         // Print pixel info (verbose mode only)
-        printf("\n[Pixel %d] Position: (%d, %d)\n", i, x, y);
+        printf("\n[Pixel %d] Position: (%lu, %lu)\n", i, (unsigned long)x, (unsigned long)y);
         printf("  VALUE: 0x%02X (0b", original);
         for (int b = 7; b >= 0; b--) {
             printf("%d", (original >> b) & 1);
@@ -119,12 +326,31 @@ void transmit_reconstruct_image(void) {
         printf(", decimal: %d)\n", original);
 #endif
         
+#if SEEDED_SEARCH && !PC_RECONSTRUCTION && PIXEL_ORDER == PIXEL_ORDER_RASTER
+        // Neighbours are correlated: seed the search with the previous pixel,
+        // or the pixel above at the start of a row
+        if (x > 0) {
+            pixel_prediction = reconstructed_image[position - 1];
+        } else if (y > 0) {
+            pixel_prediction = reconstructed_image[position - image_width];
+        }
+#endif
+
         // Transmit and get spectrum or reconstruct
         // Use process_pixel which includes XOR logic
         uint8_t reconstructed = process_pixel(original);
         
 #if !PC_RECONSTRUCTION
-        reconstructed_image[i] = reconstructed;
+        reconstructed_image[position] = reconstructed;
+#if PIXEL_ORDER != PIXEL_ORDER_RASTER
+        // Other orders: the previously sent pixel is the nearest decoded one
+        pixel_prediction = reconstructed;
+#endif
+        if (original == reconstructed) {
+            correct++;
+        } else {
+            total_error += abs((int)original - (int)reconstructed);
+        }
             
 #if VERBOSE_OUTPUT
         // Print reconstruction result
@@ -138,11 +364,15 @@ void transmit_reconstruct_image(void) {
 #endif
         
         // Progress update every 10%
-        int progress_interval = PIXELS_TO_TRANSMIT / 10;
+        int progress_interval = pixels_to_transmit / 10;
         if (progress_interval > 0 && (i + 1) % progress_interval == 0) {
             printf(">>> Progress: %d/%d pixels (%.0f%%) <<<\n", 
-                   i + 1, PIXELS_TO_TRANSMIT, 
-                   (float)(i + 1) * 100.0f / PIXELS_TO_TRANSMIT);
+                   i + 1, pixels_to_transmit, 
+                   (float)(i + 1) * 100.0f / pixels_to_transmit);
+#if PIXEL_ORDER != PIXEL_ORDER_RASTER && !PC_RECONSTRUCTION
+            print_partial_data(&partial_iter, partial_start, i + 1 - partial_start, image_width);
+            partial_start = i + 1;
+#endif
         }
     }
     
@@ -150,56 +380,405 @@ void transmit_reconstruct_image(void) {
     int64_t total_time = absolute_time_diff_us(start_time, end_time);
     
     printf("\n========== PROCESSING COMPLETE ==========\n");
-    printf("Pixels processed: %d\n", PIXELS_TO_TRANSMIT);
+    printf("Pixels processed: %d\n", pixels_to_transmit);
     printf("Total time: %.2f seconds\n", total_time / 1000000.0f);
     printf("Average time per pixel: %.2f ms\n", 
-           total_time / (float)PIXELS_TO_TRANSMIT / 1000.0f);
+           total_time / (float)pixels_to_transmit / 1000.0f);
+#if LAZY_BINS
+    uint32_t lazy_pixels, lazy_bins;
+    lazy_match_get_stats(&lazy_pixels, &lazy_bins);
+    printf("Average DTFT bins computed per pixel: %.2f of 41\n",
+           lazy_pixels > 0 ? (float)lazy_bins / lazy_pixels : 0.0f);
+#elif SEEDED_SEARCH
+    uint32_t seeded_pixels, seeded_candidates;
+    seeded_match_get_stats(&seeded_pixels, &seeded_candidates);
+    printf("Average candidates evaluated per pixel: %.2f of 256\n",
+           seeded_pixels > 0 ? (float)seeded_candidates / seeded_pixels : 0.0f);
+#endif
+#if MEM_STATS
+    mem_heap_stats_t heap;
+    mem_stats_get_heap(&heap);
+    printf("Heap allocations per pixel: %.2f\n", (float)heap.allocations / pixels_to_transmit);
+    mem_stats_print();
+#endif
     
 #if PC_RECONSTRUCTION
     printf("\nDTFT spectrums output for PC-side reconstruction.\n");
     printf("Run: python3 reconstruct_on_pc.py pico_output.txt\n");
 #else
-    // Calculate accuracy (only available when reconstructing on Pico)
-    int correct = 0;
-    int total_error = 0;
-    for (int i = 0; i < PIXELS_TO_TRANSMIT; i++) {
-        if (image_data[i] == reconstructed_image[i]) {
-            correct++;
-        } else {
-            total_error += abs((int)image_data[i] - (int)reconstructed_image[i]);
-        }
-    }
-    
+    // Accuracy (only available when reconstructing on Pico)
     printf("Correct reconstructions: %d/%d (%.2f%%)\n", 
-           correct, PIXELS_TO_TRANSMIT, 
-           (float)correct * 100.0f / PIXELS_TO_TRANSMIT);
+           correct, pixels_to_transmit, 
+           (float)correct * 100.0f / pixels_to_transmit);
     printf("Average error per incorrect pixel: %.2f\n", 
-           (PIXELS_TO_TRANSMIT - correct) > 0 ? 
-           (float)total_error / (PIXELS_TO_TRANSMIT - correct) : 0.0f);
+           (pixels_to_transmit - correct) > 0 ? 
+           (float)total_error / (pixels_to_transmit - correct) : 0.0f);
     
     // ALWAYS output reconstructed image data (regardless of VERBOSE_OUTPUT)
-    printf("\n========== RECONSTRUCTED IMAGE DATA ==========\n");
-    printf("IMAGE_DATA_START\n");
-    printf("WIDTH=%d\n", IMAGE_WIDTH);
-    printf("HEIGHT=%d\n", IMAGE_HEIGHT);
-    printf("PIXELS=%d\n", PIXELS_TO_TRANSMIT);
-    printf("DATA_HEX\n");
-    
-    // Print as hex values, 16 per line for easy copy-paste
-    for (int i = 0; i < PIXELS_TO_TRANSMIT; i++) {
-        printf("%02X", reconstructed_image[i]);
-        if ((i + 1) % 16 == 0) {
-            printf("\n");
-        } else if (i < PIXELS_TO_TRANSMIT - 1) {
-            printf(" ");
+    // Non-raster orders output the whole frame
+    print_image_data(image_width, image_height,
+                     PIXEL_ORDER == PIXEL_ORDER_RASTER ? pixels_to_transmit : image_size);
+#endif
+    printf("==============================================\n\n");
+}
+
+/**
+ * tile_image_process() pixel transfer: send, sample and decode one pixel
+ */
+static uint8_t tile_pixel_transfer(uint8_t value, void *ctx) {
+    (void)ctx;
+    return process_pixel(value);
+}
+
+/**
+ * Transmit and reconstruct an image of any size tile by tile
+ * Tiles are streamed out as TILE_START/TILE_END blocks as soon as they are
+ * decoded (reassemble with reassemble_tiles.py); nothing is kept per image
+ */
+void transmit_reconstruct_image_tiled(void) {
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open(&reader, asset, asset_size)) {
+        return;
+    }
+
+    printf("\n========== TILED IMAGE PROCESSING ==========\n");
+    tile_image_print_header(&reader);
+
+    tile_image_stats_t stats;
+    if (!tile_image_process(&reader, tile_pixel_transfer, tile_image_print_tile, NULL, &stats)) {
+        printf("Error: tiled processing stopped after %lu tiles\n", (unsigned long)stats.tiles);
+    }
+    printf("TILED_IMAGE_END\n");
+    tile_image_print_summary(&stats);
+}
+
+/**
+ * Transmit and reconstruct an image with confidence-gated retransmission
+ * Pixels are received soft (RX_OVERSAMPLE reads per bit); those decoded with
+ * low confidence are resent in batched retry passes and their reads combined
+ */
+void transmit_reconstruct_image_retransmit(void) {
+#if PC_RECONSTRUCTION
+    printf("Error: retransmission needs on-Pico reconstruction (PC_RECONSTRUCTION 0)\n");
+#else
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return;
+    }
+
+    uint32_t num_pixels = reader.header.width * reader.header.height;
+    if (num_pixels > PIXELS_TO_TRANSMIT) {
+        num_pixels = PIXELS_TO_TRANSMIT;
+    }
+
+    printf("\n========== IMAGE WITH RETRANSMISSION ==========\n");
+    printf("Pixels: %lu, oversample: %d, threshold: %.2f, max retries: %d\n",
+           (unsigned long)num_pixels, RX_OVERSAMPLE, RETRANSMIT_THRESHOLD, RETRANSMIT_MAX_RETRIES);
+
+    const retransmit_config_t config = {
+        .threshold = RETRANSMIT_THRESHOLD,
+        .max_retries = RETRANSMIT_MAX_RETRIES,
+        .oversample = RX_OVERSAMPLE,
+    };
+    retransmit_stats_t stats;
+    if (!retransmit_image(&reader, num_pixels, &config, reconstructed_image, &stats)) {
+        printf("Error: retransmission failed\n");
+        return;
+    }
+
+    // Compare with the source image
+    image_reader_rewind(&reader);
+    uint32_t correct = 0;
+    for (uint32_t i = 0; i < stats.pixels; i++) {
+        uint8_t value;
+        image_reader_read(&reader, &value, 1);
+        if (value == reconstructed_image[i]) {
+            correct++;
         }
     }
-    if (PIXELS_TO_TRANSMIT % 16 != 0) {
-        printf("\n");
+
+    retransmit_print_stats(&stats);
+    printf("Accuracy: %lu/%lu (%.2f%%)\n", (unsigned long)correct, (unsigned long)stats.pixels,
+           stats.pixels > 0 ? 100.0f * correct / stats.pixels : 0.0f);
+#endif
+}
+
+/**
+ * link_adapt_image() pixel transfer: send at the current bit period, decode
+ * with the divisor the controller chose
+ */
+static uint8_t adaptive_pixel_transfer(uint8_t value, int sample_divisor, void *ctx) {
+    (void)ctx;
+    uint8_t *bits_recv = send_receive_data(value, 8, (uint8_t)sample_divisor);
+    if (!bits_recv) {
+        return 0;
     }
-    
-    printf("IMAGE_DATA_END\n");
+#if LAZY_BINS
+    uint8_t reconstructed = process_pattern_lazy_return_value(bits_recv, sample_divisor);
+#elif ZOH_DTFT
+    uint8_t reconstructed = process_pattern_zoh_return_value(bits_recv, sample_divisor);
+#else
+    uint8_t reconstructed = process_pattern_return_value(bits_recv);
+#endif
+    MEM_FREE(bits_recv);
+    return reconstructed;
+}
+
+/**
+ * Transmit and reconstruct an image with the adaptive link controller
+ * ADAPT_PROBE / ADAPT_DECISION lines record every probe and setting change
+ */
+void transmit_reconstruct_image_adaptive(void) {
+#if PC_RECONSTRUCTION
+    printf("Error: adaptive link needs on-Pico reconstruction (PC_RECONSTRUCTION 0)\n");
+#else
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return;
+    }
+
+    uint32_t num_pixels = reader.header.width * reader.header.height;
+    if (num_pixels > PIXELS_TO_TRANSMIT) {
+        num_pixels = PIXELS_TO_TRANSMIT;
+    }
+
+    const link_adapt_config_t config = {
+        .periods_us = {1000, 400, 200, 100, 50, 20, 10, 0},
+        .num_periods = 8,
+        .divisors = {1, 2, 4, 8},
+        .num_divisors = 4,
+        .error_target = ADAPT_ERROR_TARGET,
+        .probes = ADAPT_PROBES,
+        .interval_rows = ADAPT_INTERVAL_ROWS,
+    };
+    link_adapt_t adapt;
+    if (!link_adapt_init(&adapt, &config)) {
+        return;
+    }
+
+    printf("\n========== IMAGE WITH ADAPTIVE LINK ==========\n");
+    printf("Pixels: %lu, error target: %.2f, %d probes every %d rows\n",
+           (unsigned long)num_pixels, ADAPT_ERROR_TARGET, ADAPT_PROBES, ADAPT_INTERVAL_ROWS);
+
+    link_adapt_image_stats_t stats;
+    link_adapt_image(&adapt, &reader, num_pixels, adaptive_pixel_transfer, NULL,
+                     reconstructed_image, &stats);
+    link_adapt_print_stats(&adapt, &stats);
+    set_bit_period_us(BIT_PERIOD_US);
 #endif
+}
+
+/**
+ * Send the image as one long bitstream and compare the DTFT of the capture
+ * with that of the sent stream (blocked long-stream DTFT on both cores)
+ */
+void analyze_stream_capture(void) {
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open(&reader, asset, asset_size)) {
+        return;
+    }
+
+    const uint32_t num_bytes = STREAM_CAPTURE_BITS / 8;
+    uint8_t *tx = MEM_MALLOC(num_bytes);
+    uint8_t *rx = MEM_MALLOC(num_bytes);
+    float *tx_spectrum = MEM_MALLOC(STREAM_BINS * 2 * sizeof(float));
+    float *rx_spectrum = MEM_MALLOC(STREAM_BINS * 2 * sizeof(float));
+    dtft_stream_plan_t plan;
+    if (!tx || !rx || !tx_spectrum || !rx_spectrum || !dtft_stream_plan_init(&plan, STREAM_BINS)) {
+        printf("Error: out of memory for the stream capture\n");
+        MEM_FREE(tx);
+        MEM_FREE(rx);
+        MEM_FREE(tx_spectrum);
+        MEM_FREE(rx_spectrum);
+        return;
+    }
+
+    // Pixels back to back, image repeated if it is shorter than the stream
+    for (uint32_t j = 0; j < num_bytes; j++) {
+        if (image_reader_read(&reader, &tx[j], 1) != 1) {
+            image_reader_rewind(&reader);
+            image_reader_read(&reader, &tx[j], 1);
+        }
+    }
+
+    printf("\n========== STREAM CAPTURE ==========\n");
+    absolute_time_t start_time = get_absolute_time();
+    if (send_receive_stream(tx, STREAM_CAPTURE_BITS, SAMPLING_RATE_DIVISOR, rx)) {
+        int64_t link_time = absolute_time_diff_us(start_time, get_absolute_time());
+
+        uint32_t bit_errors = 0;
+        for (uint32_t j = 0; j < num_bytes; j++) {
+            bit_errors += __builtin_popcount(tx[j] ^ rx[j]);
+        }
+
+        start_time = get_absolute_time();
+        dtft_stream(&plan, rx, STREAM_CAPTURE_BITS, rx_spectrum);
+        int64_t dtft_time = absolute_time_diff_us(start_time, get_absolute_time());
+        dtft_stream(&plan, tx, STREAM_CAPTURE_BITS, tx_spectrum);
+
+        printf("Bits: %d, sampling 1/%d, bit errors: %lu (%.3f%%)\n", STREAM_CAPTURE_BITS,
+               SAMPLING_RATE_DIVISOR, (unsigned long)bit_errors, 100.0f * bit_errors / STREAM_CAPTURE_BITS);
+        printf("Link time: %.2f s, DTFT time: %lld us (%.1f Msamples/s)\n", link_time / 1000000.0f,
+               (long long)dtft_time, dtft_time > 0 ? (float)STREAM_CAPTURE_BITS / dtft_time : 0.0f);
+        for (int k = 0; k < STREAM_BINS; k++) {
+            printf("STREAM_BIN %d TX=%.1f RX=%.1f\n", k,
+                   sqrtf(tx_spectrum[2*k] * tx_spectrum[2*k] + tx_spectrum[2*k + 1] * tx_spectrum[2*k + 1]),
+                   sqrtf(rx_spectrum[2*k] * rx_spectrum[2*k] + rx_spectrum[2*k + 1] * rx_spectrum[2*k + 1]));
+        }
+    }
+
+    dtft_stream_plan_free(&plan);
+    MEM_FREE(tx);
+    MEM_FREE(rx);
+    MEM_FREE(tx_spectrum);
+    MEM_FREE(rx_spectrum);
+}
+
+/**
+ * Send the image at every bit depth and report PSNR and throughput, then
+ * output the image at BIT_DEPTH_PREVIEW
+ */
+void transmit_image_bit_depths(void) {
+#if PC_RECONSTRUCTION
+    printf("Error: bit depth sweep needs on-Pico reconstruction (PC_RECONSTRUCTION 0)\n");
+#else
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return;
+    }
+
+    uint32_t num_pixels = reader.header.width * reader.header.height;
+    if (num_pixels > PIXELS_TO_TRANSMIT) {
+        num_pixels = PIXELS_TO_TRANSMIT;
+    }
+
+    printf("\n========== IMAGE BIT DEPTHS ==========\n");
+    printf("Pixels: %lu, sampling 1/%d\n", (unsigned long)num_pixels, SAMPLING_RATE_DIVISOR);
+    bit_depth_print_header();
+    bit_depth_stats_t stats;
+    for (int bits = BIT_DEPTH_MIN; bits <= BIT_DEPTH_MAX; bits++) {
+        image_reader_rewind(&reader);
+        if (!bit_depth_image(&reader, num_pixels, bits, SAMPLING_RATE_DIVISOR, reconstructed_image, &stats)) {
+            return;
+        }
+        bit_depth_print_stats(&stats);
+    }
+
+    image_reader_rewind(&reader);
+    if (bit_depth_image(&reader, num_pixels, BIT_DEPTH_PREVIEW, SAMPLING_RATE_DIVISOR,
+                        reconstructed_image, &stats)) {
+        printf("\nPreview at %d bits per pixel\n", BIT_DEPTH_PREVIEW);
+        print_image_data(reader.header.width, reader.header.height, stats.pixels);
+    }
+    printf("==============================================\n\n");
+#endif
+}
+
+/**
+ * Send the image blocking, then with decode, output formatting and draining
+ * run in the transmitter's waits (coop_image.h); compare time, pixels/s and
+ * Core0 utilization. Each run prints its IMAGE_DATA block.
+ */
+void transmit_image_cooperative(void) {
+#if PC_RECONSTRUCTION
+    printf("Error: cooperative transmit needs on-Pico reconstruction (PC_RECONSTRUCTION 0)\n");
+#else
+    uint32_t asset_size;
+    const uint8_t *asset = image_asset_get(&asset_size);
+    image_reader_t reader;
+    if (!image_reader_open_raster(&reader, asset, asset_size)) {
+        return;
+    }
+
+    uint32_t num_pixels = reader.header.width * reader.header.height;
+    if (num_pixels > PIXELS_TO_TRANSMIT) {
+        num_pixels = PIXELS_TO_TRANSMIT;
+    }
+
+    printf("\n========== COOPERATIVE TRANSMIT ==========\n");
+    printf("Pixels: %lu, sampling 1/%d, bit period %lu us\n", (unsigned long)num_pixels,
+           SAMPLING_RATE_DIVISOR, (unsigned long)get_bit_period_us());
+    coop_image_stats_t stats[2];
+    for (int cooperative = 0; cooperative < 2; cooperative++) {
+        image_reader_rewind(&reader);
+        if (!coop_image_transfer(&reader, num_pixels, SAMPLING_RATE_DIVISOR, cooperative, stdout,
+                                 reconstructed_image, &stats[cooperative])) {
+            return;
+        }
+    }
+    coop_image_print_header();
+    coop_image_print_stats(&stats[0]);
+    coop_image_print_stats(&stats[1]);
+    printf("==============================================\n\n");
+#endif
+}
+
+/**
+ * Time the DTFT kernels on all 256 patterns at SAMPLING_RATE_DIVISOR: the
+ * per-sample LUT kernel (41 compute_dtft_magnitude() calls on the held signal),
+ * the specialized kernel (calculate_dtft_zoh()) and the DFT matrix engine
+ * (dtft_matrix.h) per pixel (GEMV) and batched (GEMM) in each format
+ */
+void benchmark_dtft_kernels(void) {
+    static const dtft_matrix_format_t formats[] = {DTFT_MATRIX_F32, DTFT_MATRIX_F16, DTFT_MATRIX_Q15};
+    static uint8_t held[256][8 * 10];
+    static uint8_t samples[256][8];
+    static float spectra[256][41 * 2];
+    volatile float sink = 0.0f;
+
+    for (int value = 0; value < 256; value++) {
+        for (int m = 0; m < 8 / SAMPLING_RATE_DIVISOR; m++) {
+            samples[value][m] = (value >> (7 - m * SAMPLING_RATE_DIVISOR)) & 1;
+        }
+        for (int n = 0; n < 8 * 10; n++) {
+            held[value][n] = samples[value][(n % 8) / SAMPLING_RATE_DIVISOR];
+        }
+    }
+
+    printf("\n========== DTFT KERNELS ==========\n");
+    printf("256 patterns, sampling 1/%d, 41 bins, us per pixel\n", SAMPLING_RATE_DIVISOR);
+    absolute_time_t start_time = get_absolute_time();
+    for (int value = 0; value < 256; value++) {
+        for (int k = 0; k < 41; k++) {
+            sink += compute_dtft_magnitude(held[value], 8 * 10, (float)M_PI * k / 40);
+        }
+    }
+    printf("%-12s %8.2f\n", "lut", absolute_time_diff_us(start_time, get_absolute_time()) / 256.0f);
+
+    start_time = get_absolute_time();
+    for (int value = 0; value < 256; value++) {
+        calculate_dtft_zoh(samples[value], 8, SAMPLING_RATE_DIVISOR, 10, 41, spectra[value]);
+    }
+    printf("%-12s %8.2f\n", "fixed", absolute_time_diff_us(start_time, get_absolute_time()) / 256.0f);
+
+    for (unsigned f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+        dtft_matrix_t matrix;
+        if (!dtft_matrix_init(&matrix, 8, SAMPLING_RATE_DIVISOR, 10, 41, formats[f])) {
+            return;
+        }
+        start_time = get_absolute_time();
+        for (int value = 0; value < 256; value++) {
+            dtft_matrix_gemv(&matrix, samples[value], spectra[value]);
+        }
+        int64_t gemv_time = absolute_time_diff_us(start_time, get_absolute_time());
+        start_time = get_absolute_time();
+        dtft_matrix_gemm(&matrix, &samples[0][0], 8, 256, &spectra[0][0]);
+        int64_t gemm_time = absolute_time_diff_us(start_time, get_absolute_time());
+        printf("%s gemv %8.2f  gemm %8.2f  (%u bytes)\n", dtft_matrix_format_name(formats[f]),
+               gemv_time / 256.0f, gemm_time / 256.0f, (unsigned)dtft_matrix_bytes(&matrix));
+        dtft_matrix_free(&matrix);
+    }
+    (void)sink;
     printf("==============================================\n\n");
 }
 
@@ -226,28 +805,86 @@ void test_pattern(uint8_t pattern) {
            (pattern == reconstructed) ? "✓ MATCH" : "✗ MISMATCH");
 }
 
+/**
+ * Monitor several receiver links at once: transmit a pattern sequence, sample
+ * all receivers on each clock and decode them in one batch
+ * In loopback every channel is expected to return the transmitted pattern
+ */
+void monitor_receivers(void) {
+    static const uint8_t patterns[] = {0x4C, 0x4F, 0xAA, 0x55, 0xFF, 0x00, 0x0F, 0xF0};
+    const int num_patterns = sizeof(patterns) / sizeof(patterns[0]);
+
+    receiver_set_t receivers;
+    if (!receiver_set_init(&receivers, NUM_RECEIVERS, SAMPLING_RATE_DIVISOR)) {
+        return;
+    }
+
+    absolute_time_t start_time = get_absolute_time();
+    for (int i = 0; i < num_patterns; i++) {
+        uint8_t expected[MAX_RECEIVERS];
+        uint8_t values[MAX_RECEIVERS];
+        for (int c = 0; c < NUM_RECEIVERS; c++) {
+            expected[c] = patterns[i];
+        }
+        if (!receiver_set_transfer(&receivers, patterns[i], 8, expected, values)) {
+            break;
+        }
+        printf("Sent 0x%02X ->", patterns[i]);
+        for (int c = 0; c < NUM_RECEIVERS; c++) {
+            printf(" RX%d=0x%02X", c, values[c]);
+        }
+        printf("\n");
+    }
+    int64_t total_time = absolute_time_diff_us(start_time, get_absolute_time());
+
+    printf("\n=== Receiver Monitor ===\n");
+    receiver_set_print_stats(&receivers);
+    printf("Throughput: %.1f patterns/s over %d channels\n",
+           receivers.transfers * NUM_RECEIVERS * 1000000.0f / (total_time > 0 ? total_time : 1),
+           NUM_RECEIVERS);
+}
 
 int main() {
+    // Watermark Core0's stack before anything else runs on it (Core1 paints its own)
+    mem_stack_paint();
+
+    // Boot steps are timed per core (startup report at the first decoded pixel)
+    // Initialize Core1 for parallel DTFT computation first, so it can build
+    // the matcher tables while Core0 does the rest and sends the first pixel
+    startup_step_begin("core1 launch");
+    init_core1_dtft();
+    startup_step_end();
+    startup_tables_begin();
+
     // Initialize stdio only in DEBUG to avoid USB overhead in performance runs
+    startup_step_begin("stdio");
     stdio_init_all();
+    startup_step_end();
     
     // Initialize cycle counter for performance measurement
     init_cycle_counter();
     
     // Initialize trigonometric look-up tables
+    startup_step_begin("trig lookup tables");
     init_trig_lut();
-    
-    // Initialize Core1 for parallel DTFT computation
-    init_core1_dtft();
+    startup_step_end();
+    set_decode_repetitions(DECODE_REPETITIONS);
     printf("Dual-core DTFT enabled (Core0 + Core1)\n");
 
+    startup_step_begin("gpio");
     int rc = pico_led_init();
     hard_assert(rc == PICO_OK);
     
     // Initialize GPIO pins for signal transmission
     init_signal_gpio();
+    startup_step_end();
     
-    // Choose mode: 0 = single pattern test, 1 = image transmission
+    // Choose mode: 0 = single pattern test, 1 = image transmission, 2 = receiver monitor,
+    // 3 = tiled image transmission (any image size), 4 = image with selective retransmission,
+    // 5 = image over the adaptive link, 6 = long stream capture analysis,
+    // 7 = image at every bit depth (1-8 bits per pixel),
+    // 8 = image blocking vs cooperative transmit (work in the link waits),
+    // 9 = DTFT kernel benchmark (per-sample LUT, specialized, DFT matrix)
     int mode = 0;  // Change to 0 for single pattern testing
     
     if (mode == 0) {
@@ -270,6 +907,54 @@ int main() {
             // Wait before starting the sequence again
             sleep_ms(3000);  // 3 second interval
         }
+    } else if (mode == 2) {
+        // Multi-receiver monitoring mode
+        while (true) {
+            monitor_receivers();
+            sleep_ms(3000);
+        }
+    } else if (mode == 3) {
+        // Tiled image transmission mode
+        while (true) {
+            transmit_reconstruct_image_tiled();
+            sleep_ms(60000);
+        }
+    } else if (mode == 4) {
+        // Confidence-gated retransmission mode
+        while (true) {
+            transmit_reconstruct_image_retransmit();
+            sleep_ms(60000);
+        }
+    } else if (mode == 5) {
+        // Adaptive bit period / divisor mode
+        while (true) {
+            transmit_reconstruct_image_adaptive();
+            sleep_ms(60000);
+        }
+    } else if (mode == 6) {
+        // Long stream capture analysis mode
+        while (true) {
+            analyze_stream_capture();
+            sleep_ms(60000);
+        }
+    } else if (mode == 7) {
+        // Reduced bit depth sweep mode
+        while (true) {
+            transmit_image_bit_depths();
+            sleep_ms(60000);
+        }
+    } else if (mode == 8) {
+        // Cooperative transmit comparison mode
+        while (true) {
+            transmit_image_cooperative();
+            sleep_ms(60000);
+        }
+    } else if (mode == 9) {
+        // DTFT kernel benchmark mode
+        while (true) {
+            benchmark_dtft_kernels();
+            sleep_ms(10000);
+        }
     } else {
         // Image transmission mode
         while (true) {
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Pixel transmission orders shared with the firmware (lib/pixel_order.c)
+order_indices() returns the raster index of every pixel in transmission order.
+As a script, prints an order or checks it against a dump from
+host/pixel_order_check --dump
+"""
+import numpy as np
+import argparse
+import sys
+
+ORDERS = ['raster', 'adam7', 'mipmap', 'zorder', 'hilbert']
+
+# Adam7 passes: first column, first row, column step, row step
+ADAM7_PASSES = [(0, 0, 8, 8), (4, 0, 8, 8), (0, 4, 4, 8), (2, 0, 4, 4),
+                (0, 2, 2, 4), (1, 0, 2, 2), (0, 1, 1, 2)]
+
+def curve_side(width, height):
+    """
+    Side of the enclosing power-of-two square
+    """
+    side = 1
+    while side < max(width, height):
+        side <<= 1
+    return side
+
+def grid_indices(width, x0, y0, dx, dy, height):
+    ys, xs = np.mgrid[y0:height:dy, x0:width:dx]
+    return (ys * width + xs).ravel()
+
+def adam7(width, height):
+    return np.concatenate([grid_indices(width, x0, y0, dx, dy, height)
+                           for x0, y0, dx, dy in ADAM7_PASSES])
+
+def mipmap(width, height):
+    side = curve_side(width, height)
+    step = side >> 1 if side > 1 else 1
+    levels = []
+    top = True
+    while step > 0:
+        ys, xs = np.mgrid[0:height:step, 0:width:step]
+        if not top:
+            # Points on the coarser grid were sent by an earlier level
+            new = ((xs & step) != 0) | ((ys & step) != 0)
+            ys, xs = ys[new], xs[new]
+        levels.append((ys * width + xs).ravel())
+        step >>= 1
+        top = False
+    return np.concatenate(levels)
+
+def zorder(width, height):
+    side = curve_side(width, height)
+    index = np.arange(side * side, dtype=np.int64)
+    xs = np.zeros_like(index)
+    ys = np.zeros_like(index)
+    for bit in range(16):
+        xs |= ((index >> (2 * bit)) & 1) << bit
+        ys |= ((index >> (2 * bit + 1)) & 1) << bit
+    inside = (xs < width) & (ys < height)
+    return ys[inside] * width + xs[inside]
+
+def hilbert(width, height):
+    side = curve_side(width, height)
+    t = np.arange(side * side, dtype=np.int64)
+    xs = np.zeros_like(t)
+    ys = np.zeros_like(t)
+    s = 1
+    while s < side:
+        rx = 1 & (t >> 1)
+        ry = 1 & (t ^ rx)
+        flip = (ry == 0) & (rx == 1)
+        xs = np.where(flip, s - 1 - xs, xs)
+        ys = np.where(flip, s - 1 - ys, ys)
+        swap = ry == 0
+        xs, ys = np.where(swap, ys, xs), np.where(swap, xs, ys)
+        xs += s * rx
+        ys += s * ry
+        t >>= 2
+        s <<= 1
+    inside = (xs < width) & (ys < height)
+    return ys[inside] * width + xs[inside]
+
+def order_indices(order, width, height):
+    """
+    Raster index (y * width + x) of each pixel in transmission order
+    """
+    if order == 'raster':
+        return np.arange(width * height)
+    if order == 'adam7':
+        return adam7(width, height)
+    if order == 'mipmap':
+        return mipmap(width, height)
+    if order == 'zorder':
+        return zorder(width, height)
+    if order == 'hilbert':
+        return hilbert(width, height)
+    raise ValueError(f"unknown pixel order '{order}'")
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('order', choices=ORDERS)
+    parser.add_argument('width', type=int)
+    parser.add_argument('height', type=int)
+    parser.add_argument('--verify', metavar='DUMP',
+                        help='Compare with "x y" lines from pixel_order_check --dump (- for stdin)')
+    args = parser.parse_args()
+
+    indices = order_indices(args.order, args.width, args.height)
+    if not args.verify:
+        for index in indices:
+            print(index % args.width, index // args.width)
+        return
+
+    with (sys.stdin if args.verify == '-' else open(args.verify)) as f:
+        dump = np.array([[int(v) for v in line.split()] for line in f if line.strip()])
+    dumped = dump[:, 1] * args.width + dump[:, 0] if len(dump) else np.array([], dtype=int)
+    if len(dumped) == len(indices) and np.array_equal(dumped, indices):
+        print(f"OK: {args.order} {args.width}x{args.height} matches ({len(indices)} pixels)")
+    else:
+        mismatch = next((i for i, (a, b) in enumerate(zip(dumped, indices)) if a != b),
+                        min(len(dumped), len(indices)))
+        print(f"MISMATCH: {args.order} {args.width}x{args.height} differs from pixel {mismatch} "
+              f"({len(dumped)} vs {len(indices)} pixels)")
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""
+Render partial images from a progressive (non-raster order) Pico run
+Reads the image mode log ("Order:" header, PARTIAL_DATA blocks at each progress
+step, final IMAGE_DATA block), places the pixels with the shared pixel order
+(pixel_order.py) and fills the missing ones by push-pull interpolation.
+--simulate instead measures preview PSNR against a source image for every
+order after a growing fraction of the pixels.
+"""
+from PIL import Image
+import numpy as np
+import argparse
+import re
+import sys
+
+from pixel_order import ORDERS, order_indices
+
+SIZE_RE = re.compile(r'Image size: (\d+)x(\d+)')
+ORDER_RE = re.compile(r'^Order: (\w+)')
+PARTIAL_RE = re.compile(r'PARTIAL_DATA START=(\d+) COUNT=(\d+)')
+
+def fill_missing(values, known):
+    """
+    Push-pull interpolation: average the known pixels into a pyramid of
+    halved resolutions until every cell has data, then fill each level's
+    empty cells from the bilinearly upsampled level above
+    """
+    if known.all() or not known.any():
+        return values.astype(np.float32)
+    weights = known.astype(np.float64)
+    levels = [(values * weights, weights)]
+    while not (levels[-1][1] > 0).all():
+        sums, weights = levels[-1]
+        h, w = sums.shape
+        sums = np.pad(sums, ((0, h % 2), (0, w % 2)))
+        weights = np.pad(weights, ((0, h % 2), (0, w % 2)))
+        shape = (sums.shape[0] // 2, 2, sums.shape[1] // 2, 2)
+        levels.append((sums.reshape(shape).sum(axis=(1, 3)), weights.reshape(shape).sum(axis=(1, 3))))
+
+    sums, weights = levels[-1]
+    estimate = sums / weights
+    for sums, weights in reversed(levels[:-1]):
+        h, w = sums.shape
+        up = Image.fromarray(estimate.astype(np.float32), mode='F')
+        # Upsample the even-padded grid, then crop to this level
+        up = up.resize((estimate.shape[1] * 2, estimate.shape[0] * 2), Image.BILINEAR)
+        up = np.asarray(up)[:h, :w]
+        estimate = np.where(weights > 0, sums / np.maximum(weights, 1e-12), up)
+    return estimate.astype(np.float32)
+
+def preview(source_flat, indices, count, width, height):
+    """
+    Image after the first `count` pixels of an order, missing pixels interpolated
+    """
+    values = np.zeros(width * height, dtype=np.float64)
+    known = np.zeros(width * height, dtype=bool)
+    sent = indices[:count]
+    values[sent] = source_flat[sent]
+    known[sent] = True
+    return fill_missing(values.reshape(height, width), known.reshape(height, width))
+
+def psnr(a, b):
+    mse = np.mean((a.astype(np.float64) - b.astype(np.float64)) ** 2)
+    return float('inf') if mse == 0 else 10.0 * np.log10(255.0 ** 2 / mse)
+
+def to_image(array):
+    return Image.fromarray(np.clip(np.rint(array), 0, 255).astype(np.uint8), mode='L')
+
+def simulate(args):
+    source = np.array(Image.open(args.simulate).convert('L'), dtype=np.uint8)
+    height, width = source.shape
+    total = width * height
+    fractions = [0.005, 0.01, 0.02, 0.05, 0.1, 0.25, 0.5, 1.0]
+    orders = [args.order] if args.order else ORDERS
+
+    print(f"Source: {args.simulate} ({width}x{height}), preview target {args.target:.1f} dB")
+    print(f"{'order':<8}" + "".join(f"{f * 100:>8.1f}%" for f in fractions) + f"{'to target':>12}")
+    for order in orders:
+        indices = order_indices(order, width, height)
+        row = [psnr(preview(source.ravel(), indices, max(1, int(total * f)), width, height), source)
+               for f in fractions]
+
+        # Fewest pixels reaching the target (bisection; PSNR grows with pixels sent)
+        lo, hi = 1, total
+        while lo < hi:
+            mid = (lo + hi) // 2
+            if psnr(preview(source.ravel(), indices, mid, width, height), source) >= args.target:
+                hi = mid
+            else:
+                lo = mid + 1
+        print(f"{order:<8}" + "".join(f"{v:>9.1f}" for v in row) + f"{lo * 100.0 / total:>11.2f}%")
+
+        if args.output:
+            for f in fractions:
+                count = max(1, int(total * f))
+                to_image(preview(source.ravel(), indices, count, width, height)).save(
+                    f"{args.output}_{order}_{f * 100:g}.png")
+
+def parse_log(input_file):
+    """
+    Image size, order and the (start, values) partial blocks of a run; the
+    final IMAGE_DATA block (raster order) is returned separately if present
+    """
+    width = height = None
+    order = 'raster'
+    blocks = []
+    final = None
+    block = None
+    in_image = False
+
+    with open(input_file, 'r', encoding='utf-8', errors='ignore') as f:
+        for line in f:
+            line = line.strip()
+            match = SIZE_RE.search(line)
+            if match:
+                width, height = int(match.group(1)), int(match.group(2))
+                blocks, final = [], None
+                continue
+            match = ORDER_RE.match(line)
+            if match:
+                order = match.group(1)
+                continue
+            match = PARTIAL_RE.search(line)
+            if match:
+                block = (int(match.group(1)), int(match.group(2)), [])
+                continue
+            if line == 'PARTIAL_DATA_END' and block:
+                blocks.append((block[0], block[2][:block[1]]))
+                block = None
+                continue
+            if line == 'DATA_HEX':
+                in_image, final = True, []
+                continue
+            if line == 'IMAGE_DATA_END':
+                in_image = False
+                continue
+            if (block or in_image) and re.fullmatch(r'[0-9A-Fa-f]{2}( [0-9A-Fa-f]{2})*', line):
+                (block[2] if block else final).extend(bytes.fromhex(line))
+
+    return width, height, order, blocks, final
+
+def render_log(args):
+    width, height, order, blocks, final = parse_log(args.input)
+    if width is None:
+        print("Error: Could not find the 'Image size:' header")
+        sys.exit(1)
+    if order not in ORDERS:
+        print(f"Error: Unknown pixel order '{order}'")
+        sys.exit(1)
+    print(f"Image: {width}x{height}, order: {order}, {len(blocks)} partial blocks")
+
+    indices = order_indices(order, width, height)
+    values = np.zeros(width * height, dtype=np.float64)
+    known = np.zeros(width * height, dtype=bool)
+    for start, data in blocks:
+        positions = indices[start:start + len(data)]
+        values[positions] = data[:len(positions)]
+        known[positions] = True
+        sent = start + len(data)
+        path = f"{args.output}_{sent * 100 // (width * height):03d}.png"
+        to_image(fill_missing(values.reshape(height, width), known.reshape(height, width))).save(path)
+        print(f"  {sent}/{width * height} pixels -> {path}")
+
+    if final:
+        path = f"{args.output}_final.png"
+        image = np.zeros(width * height, dtype=np.uint8)
+        image[:len(final)] = final[:width * height]
+        to_image(image.reshape(height, width)).save(path)
+        print(f"  IMAGE_DATA ({len(final)} pixels) -> {path}")
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('input', nargs='?', help='Serial log of a progressive image run')
+    parser.add_argument('-o', '--output', default='preview',
+                        help='Output prefix: <prefix>_<percent>.png per block (default preview)')
+    parser.add_argument('--simulate', metavar='IMAGE',
+                        help='Measure preview PSNR for every order on a source image')
+    parser.add_argument('--order', choices=ORDERS, help='Only simulate this order')
+    parser.add_argument('--target', type=float, default=20.0,
+                        help='Preview PSNR reported as "to target" (default 20 dB)')
+    args = parser.parse_args()
+
+    if args.simulate:
+        if args.output == 'preview':
+            args.output = None
+        simulate(args)
+    elif args.input:
+        render_log(args)
+    else:
+        parser.error("give a log file or --simulate IMAGE")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+Reassemble a tiled image from Pico serial output
+Reads the TILED_IMAGE_START / TILE_START..TILE_END blocks printed by the
+tiled image mode (lib/tile_image.c) and writes a PNG plus per-tile statistics
+"""
+from PIL import Image
+import numpy as np
+import argparse
+import csv
+import re
+import sys
+
+HEADER_RE = re.compile(r'TILED_IMAGE_START WIDTH=(\d+) HEIGHT=(\d+) '
+                       r'TILE_WIDTH=(\d+) TILE_HEIGHT=(\d+) TILES=(\d+)')
+TILE_START_RE = re.compile(r'TILE_START (\d+) X=(\d+) Y=(\d+) W=(\d+) H=(\d+)')
+TILE_END_RE = re.compile(r'TILE_END (\d+) CORRECT=(\d+) PIXELS=(\d+) ERROR=(\d+) TIME_US=(-?\d+)')
+
+def parse_tiles(input_file):
+    """
+    Stream the log once, placing tile pixels as they are read
+    Returns the image array, the per-tile statistics and the expected tile count
+    """
+    image = None
+    expected_tiles = 0
+    stats = []
+    tile = None
+    rows = []
+
+    with open(input_file, 'r', encoding='utf-8', errors='ignore') as f:
+        for line in f:
+            line = line.strip()
+            match = HEADER_RE.search(line)
+            if match:
+                width, height = int(match.group(1)), int(match.group(2))
+                expected_tiles = int(match.group(5))
+                image = np.zeros((height, width), dtype=np.uint8)
+                continue
+            match = TILE_START_RE.search(line)
+            if match:
+                tile = [int(v) for v in match.groups()]
+                rows = []
+                continue
+            match = TILE_END_RE.search(line)
+            if match and tile is not None:
+                index, x, y, w, h = tile
+                if image is None:
+                    print("Error: TILE block before TILED_IMAGE_START")
+                    return None, None, 0
+                if len(rows) != h or any(len(r) != w for r in rows):
+                    print(f"Warning: tile {index} is incomplete, skipped")
+                else:
+                    image[y:y + h, x:x + w] = np.array(rows, dtype=np.uint8)
+                correct, pixels, error, time_us = (int(v) for v in match.groups()[1:])
+                stats.append({'tile': index, 'x': x, 'y': y, 'width': w, 'height': h,
+                              'correct': correct, 'pixels': pixels, 'error': error,
+                              'time_us': time_us})
+                tile = None
+                continue
+            if tile is not None and re.fullmatch(r'(?:[0-9A-Fa-f]{2})+', line):
+                rows.append(list(bytes.fromhex(line)))
+
+    return image, stats, expected_tiles
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('input', help='Serial log containing the tiled image blocks')
+    parser.add_argument('-o', '--output', default='reconstructed_tiled.png')
+    parser.add_argument('--stats', help='Write per-tile statistics as CSV')
+    args = parser.parse_args()
+
+    image, stats, expected_tiles = parse_tiles(args.input)
+    if image is None:
+        print("Error: Could not find TILED_IMAGE_START block")
+        sys.exit(1)
+
+    Image.fromarray(image, mode='L').save(args.output)
+    height, width = image.shape
+    print(f"Created reconstructed image: {args.output} ({width}x{height})")
+    print(f"Tiles: {len(stats)}/{expected_tiles}")
+
+    if stats:
+        pixels = sum(s['pixels'] for s in stats)
+        correct = sum(s['correct'] for s in stats)
+        worst = max(stats, key=lambda s: s['pixels'] - s['correct'])
+        print(f"Correct reconstructions: {correct}/{pixels} ({100.0 * correct / pixels:.2f}%)")
+        print(f"Worst tile: {worst['tile']} at ({worst['x']}, {worst['y']}), "
+              f"{worst['pixels'] - worst['correct']} mismatches")
+
+    if args.stats:
+        with open(args.stats, 'w', newline='') as f:
+            writer = csv.DictWriter(f, fieldnames=['tile', 'x', 'y', 'width', 'height',
+                                                   'correct', 'pixels', 'error', 'time_us'])
+            writer.writeheader()
+            writer.writerows(stats)
+        print(f"Per-tile statistics: {args.stats}")
+
+if __name__ == "__main__":
+    main()
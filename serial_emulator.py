@@ -0,0 +1,327 @@
+#!/usr/bin/env python3
+"""
+Emulate the Pico serial output over a pseudo-terminal for host load testing
+Replays a captured log, or synthesizes the firmware's image mode output
+(progress lines and the IMAGE_DATA block) or PC reconstruction output
+(DTFT_SPECTRUM records) from an image, at a configurable byte rate. Host
+tools open the printed pty path like the Pico's USB serial port.
+"""
+from PIL import Image
+import numpy as np
+import argparse
+import fcntl
+import os
+import select
+import struct
+import sys
+import termios
+import threading
+import time
+import tty
+
+from pixel_order import ORDERS, order_indices
+
+NUM_BINS = 41        # DTFT points from 0 to pi
+REPETITIONS = 10     # Pattern repetitions per transfer
+
+def parse_rate(text):
+    """
+    Bytes per second with an optional k/M suffix (0 = unlimited)
+    """
+    scale = {'k': 1e3, 'K': 1e3, 'm': 1e6, 'M': 1e6}.get(text[-1:], 1)
+    return float(text[:-1] if scale != 1 else text) * scale
+
+def load_pixels(path, size):
+    image = Image.open(path).convert('L')
+    if size:
+        width, height = (int(v) for v in size.lower().split('x'))
+        image = image.resize((width, height), Image.LANCZOS)
+    return np.array(image, dtype=np.uint8)
+
+def spectrum_lines():
+    """
+    DTFT_SPECTRUM record body for every pixel value, formatted as
+    process_pattern_output_spectrum() prints it (magnitudes, not squared)
+    """
+    values = np.arange(256)
+    bits = (values[:, None] >> np.arange(7, -1, -1)) & 1
+    signal = np.tile(bits, (1, REPETITIONS)).astype(np.float64)
+    n = np.arange(signal.shape[1])
+    omega = np.pi * np.arange(NUM_BINS) / (NUM_BINS - 1)
+    magnitudes = np.abs(signal @ np.exp(-1j * np.outer(n, omega)))
+    return [("DTFT_SPECTRUM_START\n" + " ".join(f"{m:.6f}" for m in row) +
+             "\nDTFT_SPECTRUM_END\n").encode() for row in magnitudes]
+
+def image_header(width, height, num_pixels, mode, order):
+    return ("\n========== IMAGE PROCESSING ==========\n"
+            f"Image size: {width}x{height} = {width * height} pixels (8-bit asset)\n"
+            f"Processing: {num_pixels} pixels\n"
+            f"Mode: {mode}\n"
+            f"Order: {order}\n"
+            "========================================\n\n").encode()
+
+def hex_lines(values):
+    """
+    Values as space-separated hex, 16 per line
+    """
+    text = values.tobytes().hex(' ').upper()
+    return "".join(text[i:i + 16 * 3 - 1] + "\n" for i in range(0, len(text), 16 * 3)).encode()
+
+def progress_line(done, total):
+    return f">>> Progress: {done}/{total} pixels ({done * 100.0 / total:.0f}%) <<<\n".encode()
+
+def synthesize_image(pixels, pixel_us, error_rate, rng, order):
+    """
+    Pico reconstruction output: header, progress, summary and IMAGE_DATA block,
+    with PARTIAL_DATA blocks at each progress step for non-raster orders
+    Yields (data, records) with one record per pixel
+    """
+    height, width = pixels.shape
+    source = pixels.ravel()
+    total = source.size
+    reconstructed = source.copy()
+    if error_rate > 0:
+        wrong = rng.random(total) < error_rate
+        reconstructed[wrong] ^= rng.integers(1, 256, int(wrong.sum()), dtype=np.uint8)
+
+    yield image_header(width, height, total, "Pico reconstruction", order), 0
+    indices = order_indices(order, width, height)
+    interval = total // 10
+    if interval > 0:
+        for done in range(interval, total + 1, interval):
+            data = progress_line(done, total)
+            if order != 'raster':
+                start = done - interval
+                data += (f"PARTIAL_DATA START={start} COUNT={interval}\n".encode() +
+                         hex_lines(reconstructed[indices[start:done]]) + b"PARTIAL_DATA_END\n")
+            yield data, 0
+
+    errors = reconstructed != source
+    incorrect = int(errors.sum())
+    total_error = int(np.abs(reconstructed.astype(int) - source)[errors].sum())
+    total_s = total * pixel_us / 1e6
+    yield ("\n========== PROCESSING COMPLETE ==========\n"
+           f"Pixels processed: {total}\n"
+           f"Total time: {total_s:.2f} seconds\n"
+           f"Average time per pixel: {pixel_us / 1000:.2f} ms\n"
+           f"Correct reconstructions: {total - incorrect}/{total} "
+           f"({(total - incorrect) * 100.0 / total:.2f}%)\n"
+           f"Average error per incorrect pixel: {total_error / incorrect if incorrect else 0:.2f}\n"
+           "\n========== RECONSTRUCTED IMAGE DATA ==========\n"
+           "IMAGE_DATA_START\n"
+           f"WIDTH={width}\nHEIGHT={height}\nPIXELS={total}\nDATA_HEX\n").encode(), 0
+
+    # In blocks of lines to keep writes large
+    hex_rows = 4096
+    for start in range(0, total, 16 * hex_rows):
+        block = reconstructed[start:start + 16 * hex_rows]
+        yield hex_lines(block), len(block)
+
+    yield b"IMAGE_DATA_END\n==============================================\n\n", 0
+
+def synthesize_spectra(pixels, pixel_us):
+    """
+    PC reconstruction output: one DTFT_SPECTRUM record per pixel
+    """
+    height, width = pixels.shape
+    total = pixels.size
+    records = spectrum_lines()
+    yield image_header(width, height, total, "PC reconstruction", "raster"), 0
+
+    interval = total // 10
+    batch = []
+    batch_start = 0
+    for i, value in enumerate(pixels.ravel().tolist()):
+        batch.append(f"[Pixel {i}] Position: ({i % width}, {i // width})\n".encode())
+        batch.append(records[value])
+        if interval > 0 and (i + 1) % interval == 0:
+            batch.append(progress_line(i + 1, total))
+        if i + 1 - batch_start == 256:
+            yield b"".join(batch), i + 1 - batch_start
+            batch = []
+            batch_start = i + 1
+    if batch:
+        yield b"".join(batch), total - batch_start
+
+    total_s = total * pixel_us / 1e6
+    yield ("\n========== PROCESSING COMPLETE ==========\n"
+           f"Pixels processed: {total}\n"
+           f"Total time: {total_s:.2f} seconds\n"
+           f"Average time per pixel: {pixel_us / 1000:.2f} ms\n"
+           "\nDTFT spectrums output for PC-side reconstruction.\n"
+           "Run: python3 reconstruct_on_pc.py pico_output.txt\n"
+           "==============================================\n\n").encode(), 0
+
+def replay(path):
+    """
+    A captured log, verbatim; records are counted by their end markers
+    """
+    with open(path, 'rb') as f:
+        while True:
+            data = f.read(1 << 16)
+            if not data:
+                break
+            yield data, data.count(b"_END")
+
+class Sender:
+    """
+    Writes the stream to a file descriptor on a byte-rate schedule
+    """
+    def __init__(self, fd, rate, chunk):
+        self.fd = fd
+        self.rate = rate
+        self.chunk = chunk
+        self.bytes = 0
+        self.lines = 0
+        self.records = 0
+        self.blocked_s = 0.0
+        self.start = None
+
+    def send(self, data, records):
+        if self.start is None:
+            self.start = time.monotonic()
+        view = memoryview(data)
+        for offset in range(0, len(view), self.chunk):
+            part = view[offset:offset + self.chunk]
+            if self.rate > 0:
+                # Pace by the total sent so far so short sleeps don't accumulate drift
+                wait = self.start + self.bytes / self.rate - time.monotonic()
+                if wait > 0:
+                    time.sleep(wait)
+            while len(part):
+                before = time.monotonic()
+                written = os.write(self.fd, part)
+                self.blocked_s += time.monotonic() - before
+                part = part[written:]
+                self.bytes += written
+        self.lines += data.count(b"\n")
+        self.records += records
+
+    def report(self, out):
+        elapsed = time.monotonic() - self.start if self.start else 0.0
+        print(f"Sent: {self.bytes} bytes, {self.lines} lines, {self.records} records "
+              f"in {elapsed:.2f} s", file=out)
+        if elapsed > 0:
+            print(f"Rate: {self.bytes / elapsed / 1e6:.2f} MB/s, "
+                  f"{self.records / elapsed:.0f} records/s", file=out)
+            print(f"Blocked in write (reader backpressure): {self.blocked_s:.2f} s "
+                  f"({self.blocked_s * 100.0 / elapsed:.1f}%)", file=out)
+
+def drain(fd, stop):
+    """
+    Read and discard the slave side, to measure the emulator's own ceiling
+    """
+    while not stop.is_set():
+        ready, _, _ = select.select([fd], [], [], 0.1)
+        if ready:
+            try:
+                os.read(fd, 1 << 16)
+            except OSError:
+                break
+
+def wait_for_reader(slave, timeout):
+    """
+    Wait until the reader has taken everything still queued on the slave side;
+    closing the master discards it
+    """
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        queued = struct.unpack('i', fcntl.ioctl(slave, termios.FIONREAD, b'\0' * 4))[0]
+        if queued == 0:
+            return True
+        time.sleep(0.01)
+    return False
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('--replay', metavar='LOG', help='Send a captured serial log verbatim')
+    parser.add_argument('--format', choices=['image', 'spectra'], default='image',
+                        help='Synthesized output: Pico reconstruction (IMAGE_DATA) or '
+                             'PC reconstruction (DTFT_SPECTRUM records)')
+    parser.add_argument('--image', default='image.jpg', help='Source image for synthesis')
+    parser.add_argument('--size', metavar='WxH', help='Resize the source image')
+    parser.add_argument('--order', choices=ORDERS, default='raster',
+                        help='Pixel order of image output (PARTIAL_DATA blocks unless raster)')
+    parser.add_argument('--error-rate', type=float, default=0.0,
+                        help='Fraction of wrongly reconstructed pixels in image output')
+    parser.add_argument('--pixel-us', type=float, default=2000.0,
+                        help='Per-pixel time reported in the summary (default 2000)')
+    parser.add_argument('--rate', type=parse_rate, default=parse_rate('1M'),
+                        help='Bytes per second, k/M suffixes, 0 = unlimited (default 1M)')
+    parser.add_argument('--chunk', type=int, default=4096, help='Bytes per write (default 4096)')
+    parser.add_argument('--repeat', type=int, default=1, help='Send the stream N times')
+    parser.add_argument('--delay', type=float, default=1.0,
+                        help='Seconds to wait after opening the pty, for the reader to attach')
+    parser.add_argument('--link', metavar='PATH', help='Symlink the pty slave to PATH')
+    parser.add_argument('--stdout', action='store_true', help='Write to stdout instead of a pty')
+    parser.add_argument('--drain', action='store_true',
+                        help='Read the pty internally (no external reader)')
+    parser.add_argument('--hold', action='store_true',
+                        help='Keep the pty open after sending until Ctrl-C')
+    parser.add_argument('--seed', type=int, default=0)
+    args = parser.parse_args()
+    if args.chunk < 1 or args.repeat < 1 or args.rate < 0:
+        parser.error("--chunk and --repeat must be positive, --rate non-negative")
+
+    pixels = None
+    if not args.replay:
+        try:
+            pixels = load_pixels(args.image, args.size)
+        except (OSError, ValueError) as e:
+            print(f"Error: Could not load {args.image}: {e}", file=sys.stderr)
+            sys.exit(1)
+
+    def stream():
+        rng = np.random.default_rng(args.seed)
+        for _ in range(args.repeat):
+            if args.replay:
+                yield from replay(args.replay)
+            elif args.format == 'spectra':
+                yield from synthesize_spectra(pixels, args.pixel_us)
+            else:
+                yield from synthesize_image(pixels, args.pixel_us, args.error_rate, rng, args.order)
+
+    # Status goes to stderr so --stdout carries only the emulated stream
+    status = sys.stderr
+    stop = threading.Event()
+    drainer = None
+    if args.stdout:
+        fd = sys.stdout.fileno()
+    else:
+        fd, slave = os.openpty()
+        # Raw mode: no echo, no line discipline rewriting "\n" to "\r\n"
+        tty.setraw(slave)
+        slave_path = os.ttyname(slave)
+        if args.link:
+            if os.path.islink(args.link):
+                os.unlink(args.link)
+            os.symlink(slave_path, args.link)
+            slave_path = f"{args.link} -> {slave_path}"
+        print(f"Serial emulator on {slave_path}", file=status)
+        if args.drain:
+            drainer = threading.Thread(target=drain, args=(slave, stop), daemon=True)
+            drainer.start()
+        time.sleep(args.delay)
+
+    sender = Sender(fd, args.rate, args.chunk)
+    try:
+        for data, records in stream():
+            sender.send(data, records)
+        if not args.stdout and not wait_for_reader(slave, 5.0):
+            print("Warning: reader did not take the last queued bytes", file=status)
+        sender.report(status)
+        if args.hold and not args.stdout:
+            print("Holding the pty open, Ctrl-C to exit", file=status)
+            while True:
+                time.sleep(1)
+    except (KeyboardInterrupt, BrokenPipeError):
+        sender.report(status)
+    finally:
+        stop.set()
+        if drainer:
+            drainer.join()
+        if args.link and os.path.islink(args.link):
+            os.unlink(args.link)
+
+if __name__ == "__main__":
+    main()